@@ -823,6 +823,24 @@ static void MTest_addEvent(mtest::MTest& m,
   m.addEvent(n, std::vector<mtest::real>(1u, t));
 }  // end of MTest_addEvent
 
+static void MTest_setNumericalTangentOperatorFiniteDifferenceScheme(
+    mtest::MTest& t, const std::string& s) {
+  if (s == "Centred") {
+    t.setNumericalTangentOperatorFiniteDifferenceScheme(
+        mtest::MTest::CENTREDDIFFERENCE);
+  } else if (s == "Forward") {
+    t.setNumericalTangentOperatorFiniteDifferenceScheme(
+        mtest::MTest::FORWARDDIFFERENCE);
+  } else {
+    tfel::raise(
+        "MTest::setNumericalTangentOperatorFiniteDifferenceScheme: "
+        "invalid finite difference scheme ('" +
+        s +
+        "').\n"
+        "Valid finite difference schemes are 'Centred' and 'Forward'");
+  }
+}  // end of MTest_setNumericalTangentOperatorFiniteDifferenceScheme
+
 void declareMTest();
 
 void declareMTest() {
@@ -1292,6 +1310,14 @@ void declareMTest() {
       .def("setNumericalTangentOperatorPerturbationValue",
            &MTest::setNumericalTangentOperatorPerturbationValue,
            "set the perburtation of the gradient used to compute a numerical "
+           "approximation of the tangent operator")
+      .def("setNumericalTangentOperatorFiniteDifferenceScheme",
+           &MTest_setNumericalTangentOperatorFiniteDifferenceScheme,
+           "set the finite difference scheme used to compute a numerical "
+           "approximation of the tangent operator. Valid values are "
+           "'Centred' (default) and 'Forward'")
+      .def("setNumberOfThreads", &MTest::setNumberOfThreads,
+           "set the number of threads used to compute a numerical "
            "approximation of the tangent operator");
 
 }  // end of declareExternalLibraryManager
@@ -47,6 +47,8 @@ void declareMTestParser() {
       .def("execute", execute)
       .def("execute", execute2)
       .def("execute", execute3)
-      .def("parseString", &MTestParser::parseString);
+      .def("parseString", static_cast<void (MTestParser::*)(
+                              MTest&, const std::string&)>(
+                              &MTestParser::parseString));
 
 }  // end of declareExternalLibraryManager
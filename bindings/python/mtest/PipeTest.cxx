@@ -160,6 +160,21 @@ static void PipeTest_setElementType(mtest::PipeTest& t, const std::string& e) {
   }
 }  // end of PipeTest_setElementType
 
+static void PipeTest_setLinearSolver(mtest::PipeTest& t, const std::string& s) {
+  if (s == "Banded") {
+    t.setLinearSolver(mtest::PipeTest::BANDED);
+  } else if (s == "Dense") {
+    t.setLinearSolver(mtest::PipeTest::DENSE);
+  } else {
+    tfel::raise(
+        "PipeTest::setLinearSolver: "
+        "invalid linear solver ('" +
+        s +
+        "').\n"
+        "Valid linear solvers are 'Banded' and 'Dense'");
+  }
+}  // end of PipeTest_setLinearSolver
+
 void declarePipeTest();
 
 void declarePipeTest() {
@@ -292,6 +307,12 @@ void declarePipeTest() {
            "is user-specified. See the 'setOuterRadiusEvolution' "
            "method for details.\n")
       .def("setElementType", &PipeTest_setElementType)
+      .def("setLinearSolver", &PipeTest_setLinearSolver,
+           "set the linear solver used to solve the equilibrium "
+           "equations. Valid values are 'Banded' and 'Dense' (default)")
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour "
+           "over the elements")
       .def("addProfile", &PipeTest::addProfile)
       .def("computeMinimumValue",
            static_cast<real (PipeTest::*)(const StudyCurrentState&,
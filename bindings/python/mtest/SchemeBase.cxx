@@ -88,6 +88,19 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFormat(mtest::SchemeBase& s, const std::string& v) {
+  if (v == "text") {
+    s.setOutputFormat(mtest::SchemeBase::TEXTOUTPUT);
+  } else if (v == "binary") {
+    s.setOutputFormat(mtest::SchemeBase::BINARYOUTPUT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFormat: "
+        "invalid format '" +
+        v + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
@@ -296,6 +309,13 @@ void declareSchemeBase() {
            "- 'EveryIteration': the outputs are written after each "
            "successful iteration.\n"
            "Note : These options only differs in case of substepping.")
+      .def("setOutputFormat", setOutputFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) specify the choosen format. "
+           "The two allowed formats are:\n"
+           "- 'text': the results are written in a text file (default).\n"
+           "- 'binary': the results are written in a binary file which "
+           "can be read using the 'tfel.utilities.BinaryData' class.")
       .def("resetOutputFile", &SchemeBase::resetOutputFile,
            "close and reopen the output files");
 }
@@ -0,0 +1,51 @@
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+
+import numpy
+import tfel.math
+
+
+class EvaluatorGetValuesTest(unittest.TestCase):
+    def check(self, r, x, y):
+        eps = 1.e-14
+        self.assertTrue(len(r) == len(x))
+        for i in range(len(x)):
+            v = 2 * x[i] + y[i] * y[i]
+            self.assertTrue(abs(r[i] - v) < eps * max(1, abs(v)))
+
+    def test_arrays(self):
+        e = tfel.math.Evaluator("2*x+y*y")
+        x = numpy.array([1., 2., 3., 4.])
+        y = numpy.array([-1., 0.5, 2., 3.])
+        self.check(e.getValues({'x': x, 'y': y}), x, y)
+        e.compile()
+        self.check(e.getValues({'x': x, 'y': y}), x, y)
+
+    def test_scalars(self):
+        e = tfel.math.Evaluator("2*x+y*y")
+        e.setVariableValue('y', 5.)
+        x = numpy.array([1., 2., 3.])
+        r = e.getValues({'x': x, 'y': 3.})
+        self.check(r, x, [3., 3., 3.])
+        # the value of the variable `y` is left unchanged
+        r = e.getValues({'x': x})
+        self.check(r, x, [5., 5., 5.])
+        e.setVariableValue('x', 1.)
+        self.assertTrue(abs(e.getValue() - 27.) < 1.e-14)
+
+    def test_strided_arrays(self):
+        e = tfel.math.Evaluator("2*x+y*y")
+        a = numpy.array([1., -1., 2., -1., 3., -1., 4., -1.])
+        x = a[::2]
+        y = a[1::2]
+        self.assertFalse(x.flags['C_CONTIGUOUS'])
+        self.check(e.getValues({'x': x, 'y': y}), x, y)
+        # integer arrays are converted
+        xi = numpy.array([1, 2, 3, 4])
+        self.check(e.getValues({'x': xi, 'y': 2.}), xi, [2., 2., 2., 2.])
+
+
+if __name__ == '__main__':
+    unittest.main()
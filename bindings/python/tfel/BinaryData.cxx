@@ -0,0 +1,88 @@
+/*!
+ * \file  bindings/python/tfel/BinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#endif /* TFEL_NUMPY_SUPPORT */
+#include "TFEL/Utilities/BinaryData.hxx"
+
+#ifdef TFEL_NUMPY_SUPPORT
+
+/*!
+ * \return a read-only numpy array sharing the memory of the specified
+ * column. The array keeps the `BinaryData` object alive.
+ * \param[in] o: python object holding the `BinaryData` object
+ * \param[in] c: column number
+ */
+static boost::python::numpy::ndarray BinaryData_getColumnView(
+    const boost::python::object& o,
+    const tfel::utilities::BinaryData::size_type c) {
+  namespace np = boost::python::numpy;
+  const auto& d =
+      boost::python::extract<const tfel::utilities::BinaryData&>(o)();
+  const auto v = d.getColumnView(c);
+  return np::from_data(
+      v.values, np::dtype::get_builtin<double>(),
+      boost::python::make_tuple(v.size()),
+      boost::python::make_tuple(v.stride * sizeof(double)), o);
+}  // end of BinaryData_getColumnView
+
+/*!
+ * \return a read-only two dimensional numpy array sharing the memory of
+ * the values. The array keeps the `BinaryData` object alive.
+ * \param[in] o: python object holding the `BinaryData` object
+ */
+static boost::python::numpy::ndarray BinaryData_getValues(
+    const boost::python::object& o) {
+  namespace np = boost::python::numpy;
+  const auto& d =
+      boost::python::extract<const tfel::utilities::BinaryData&>(o)();
+  const auto nc = d.getNumberOfColumns();
+  return np::from_data(
+      d.data(), np::dtype::get_builtin<double>(),
+      boost::python::make_tuple(d.getNumberOfRows(), nc),
+      boost::python::make_tuple(nc * sizeof(double), sizeof(double)), o);
+}  // end of BinaryData_getValues
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
+void declareBinaryData();
+
+void declareBinaryData() {
+  using namespace boost::python;
+  using namespace tfel::utilities;
+
+  class_<BinaryData, boost::noncopyable>("BinaryData", no_init)
+      .def(init<std::string>())
+      .def("isBinaryDataFile", &BinaryData::isBinaryDataFile)
+      .staticmethod("isBinaryDataFile")
+      .def("getNumberOfColumns", &BinaryData::getNumberOfColumns)
+      .def("getNumberOfRows", &BinaryData::getNumberOfRows)
+      .def("getLegends", &BinaryData::getLegends,
+           return_value_policy<copy_const_reference>())
+      .def("getLegend", &BinaryData::getLegend,
+           return_value_policy<copy_const_reference>())
+      .def("findColumn", &BinaryData::findColumn)
+#ifdef TFEL_NUMPY_SUPPORT
+      .def("getColumnView", BinaryData_getColumnView,
+           "return a read-only numpy array sharing the memory of the "
+           "specified column (no copy is made)")
+      .def("getValues", BinaryData_getValues,
+           "return a read-only two dimensional numpy array sharing the "
+           "memory of the values (no copy is made)")
+#endif /* TFEL_NUMPY_SUPPORT */
+      .def("getColumn", &BinaryData::getColumn,
+           "return a copy of the specified column");
+
+}  // end of declareBinaryData
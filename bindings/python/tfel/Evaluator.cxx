@@ -11,9 +11,89 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Numpy/ndarray.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "TFEL/Math/Evaluator.hxx"
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+/*!
+ * \brief evaluate the formula on a set of points
+ * \param[in] e: evaluator
+ * \param[in] d: dictionary associating the name of a variable to an
+ * one-dimensional array of values or to a scalar value
+ *
+ * Arrays which are not C-contiguous or whose values are not double
+ * precision floating point numbers are copied. Scalar values are broadcast
+ * to all points: the values of the variables stored in the evaluator are
+ * left unchanged.
+ */
+static boost::python::numpy::ndarray Evaluator_getValues(
+    tfel::math::Evaluator& e, const boost::python::dict& d) {
+  using namespace boost::python;
+  const auto dt = numpy::dtype::get_builtin<double>();
+  // arrays kept alive during the evaluation
+  auto arrays = std::vector<std::pair<std::string, numpy::ndarray>>{};
+  auto scalars = std::vector<std::pair<std::string, double>>{};
+  auto n = size_t{};
+  auto first = true;
+  const auto items = d.items();
+  for (long i = 0; i != len(items); ++i) {
+    const auto n_v = extract<std::string>(items[i][0]);
+    tfel::raise_if(!n_v.check(),
+                   "Evaluator::getValues: "
+                   "variable names must be strings");
+    const auto vn = std::string(n_v);
+    const auto s_v = extract<double>(items[i][1]);
+    if (s_v.check()) {
+      scalars.emplace_back(vn, s_v());
+      continue;
+    }
+    const auto a_v = extract<numpy::ndarray>(items[i][1]);
+    tfel::raise_if(!a_v.check(),
+                   "Evaluator::getValues: "
+                   "invalid value for variable '" +
+                       vn + "'");
+    auto a = a_v();
+    if (a.get_dtype() != dt) {
+      a = a.astype(dt);
+    }
+    if (!(a.get_flags() & numpy::ndarray::C_CONTIGUOUS)) {
+      a = a.copy();
+    }
+    const auto s = tfel::numpy::get_size(a);
+    tfel::raise_if((!first) && (s != n),
+                   "Evaluator::getValues: "
+                   "unmatched array sizes");
+    n = s;
+    first = false;
+    arrays.emplace_back(vn, a);
+  }
+  auto args = std::map<std::string, const double*>{};
+  for (const auto& a : arrays) {
+    args[a.first] = tfel::numpy::get_data(a.second);
+  }
+  auto values = std::vector<std::vector<double>>{};
+  values.reserve(scalars.size());
+  for (const auto& v : scalars) {
+    values.emplace_back(n, v.second);
+    args[v.first] = values.back().data();
+  }
+  auto r = numpy::empty(make_tuple(n), dt);
+  e.getValues(tfel::numpy::get_data(r), args, n);
+  return r;
+}  // end of Evaluator_getValues
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareEvaluator();
 
 void declareEvaluator() {
@@ -36,5 +116,17 @@ void declareEvaluator() {
       .def("getVariablesNames", &Evaluator::getVariablesNames,
            "return the variable names")
       .def("removeDependencies", &Evaluator::removeDependencies,
-           "resolves dependencies and removes them");
+           "resolves dependencies and removes them")
+      .def("compile", &Evaluator::compile,
+           "compiles the formula in a flat program to speed up its "
+           "evaluation")
+      .def("isCompiled", &Evaluator::isCompiled,
+           "return if the formula has been compiled")
+#ifdef TFEL_NUMPY_SUPPORT
+      .def("getValues", Evaluator_getValues,
+           "evaluates the formula on a set of points. The argument is a "
+           "dictionary associating the name of a variable to an "
+           "one-dimensional array of values or to a scalar value")
+#endif /* TFEL_NUMPY_SUPPORT */
+      ;
 }
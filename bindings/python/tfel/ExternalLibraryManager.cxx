@@ -72,6 +72,21 @@ static void ELM_setDoubleParameter2(tfel::system::ExternalLibraryManager& elm,
   elm.setParameter(l, n, h, p, v);
 }
 
+static boost::python::dict ELM_getProfilingMeasures(
+    tfel::system::ExternalLibraryManager& elm,
+    const std::string& l,
+    const std::string& f) {
+  auto calls = std::vector<intmax_t>{};
+  auto times = std::vector<intmax_t>{};
+  const auto names = elm.getProfilingCodeBlocks(l, f);
+  elm.getProfilingMeasures(calls, times, l, f);
+  boost::python::dict r;
+  for (decltype(names.size()) i = 0; i != names.size(); ++i) {
+    r[names[i]] = boost::python::make_tuple(calls[i], times[i]);
+  }
+  return r;
+}
+
 void declareExternalLibraryManager() {
   using namespace boost;
   using namespace boost::python;
@@ -142,11 +157,28 @@ void declareExternalLibraryManager() {
       const std::string&, const std::string&, const std::string&) =
       &ELM::getUpperPhysicalBound;
 
+  class_<ExternalLibraryIndex, noncopyable>("ExternalLibraryIndex", no_init)
+      .def("getLibraryName", &ExternalLibraryIndex::getLibraryName,
+           return_value_policy<copy_const_reference>(),
+           "return the name of the library")
+      .def("contains", &ExternalLibraryIndex::contains,
+           "return true if the given symbol is defined")
+      .def("getSymbols", &ExternalLibraryIndex::getSymbols,
+           return_value_policy<copy_const_reference>(),
+           "return the list of the symbols exported by the library")
+      .def("getEntryPoints", &ExternalLibraryIndex::getEntryPoints,
+           return_value_policy<copy_const_reference>(),
+           "return the list of all mfront generated entry points\n"
+           "in the library");
+
   class_<ELM, noncopyable>("ExternalLibraryManager", no_init)
       .def("getExternalLibraryManager", ELM::getExternalLibraryManager,
            return_value_policy<reference_existing_object>())
       .staticmethod("getExternalLibraryManager")
       .def("loadLibrary", ELM_loadLibrary)
+      .def("getLibraryIndex", &ELM::getLibraryIndex,
+           return_value_policy<reference_existing_object>(),
+           "return the index of the symbols of a library")
       .def("getAuthor", &ELM::getAuthor)
       .def("getDate", &ELM::getDate)
       .def("getDescription", &ELM::getDescription)
@@ -235,6 +267,18 @@ void declareExternalLibraryManager() {
            "return the upper physical bound of a variable")
 
       .def("contains", &ELM::contains)
+      .def("hasProfilingSupport", &ELM::hasProfilingSupport,
+           "return if the given behaviour has been compiled with "
+           "profiling support")
+      .def("getProfilingCodeBlocks", &ELM::getProfilingCodeBlocks,
+           "return the names of the profiled code blocks of a behaviour")
+      .def("getProfilingMeasures", ELM_getProfilingMeasures,
+           "return a dictionary associating to each profiled code block "
+           "of a behaviour its number of calls and the time spent in it "
+           "(in nanoseconds) since the library was loaded or since the "
+           "last call to `resetProfilingMeasures`")
+      .def("resetProfilingMeasures", &ELM::resetProfilingMeasures,
+           "reset the profiling measures of a behaviour")
       .def("getUMATBehaviourType", &ELM::getUMATBehaviourType)
       .def("getUMATSymmetryType", &ELM::getUMATSymmetryType)
       .def("getUMATElasticSymmetryType", &ELM::getUMATElasticSymmetryType)
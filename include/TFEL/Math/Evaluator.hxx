@@ -23,6 +23,7 @@
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/EvaluatorBase.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -170,6 +171,81 @@ namespace tfel::math {
         const std::vector<std::string>&,
         const std::string&,
         std::shared_ptr<tfel::math::parser::ExternalFunctionManager>&);
+    /*!
+     * \brief compile the expression tree in a flat program (see the
+     * `Bytecode` class) which is used by the `getValue` method afterwards.
+     *
+     * The expression tree is kept. Copies of the evaluator are compiled
+     * if the evaluator is compiled. The compilation is preserved by the
+     * `removeDependencies` and `resolveDependencies` methods.
+     *
+     * \note if the expression is too deep, the expression tree is still
+     * used by the `getValue` method.
+     */
+    void compile();
+    //! \return if the expression has been compiled
+    bool isCompiled() const noexcept;
+    /*!
+     * \brief mutable state used to evaluate an evaluator.
+     *
+     * The evaluator is not modified by an evaluation using a context, so
+     * several threads can share the same evaluator, each thread using its
+     * own context. A context must not be used by several threads at the
+     * same time.
+     */
+    struct EvaluationContext {
+      //! \brief values of the variables
+      std::vector<double> variables;
+      /*!
+       * \brief private copy of the evaluator, used if the evaluator is not
+       * reentrant (see the `isReentrant` method). The external functions
+       * called by this copy are also private copies, so this copy does not
+       * share any mutable state with other evaluators.
+       */
+      std::unique_ptr<Evaluator> evaluator;
+    };
+    /*!
+     * \return a new evaluation context. The values of the variables are
+     * initialized by the current values of the variables of the evaluator.
+     * \note if the evaluator is not reentrant, the context holds a private
+     * copy of the evaluator. Building a context can thus be costly and a
+     * context shall be reused for many evaluations.
+     */
+    EvaluationContext makeEvaluationContext() const;
+    /*!
+     * \brief set the value of a variable in an evaluation context
+     * \param[in] c: evaluation context
+     * \param[in] n: name of the variable
+     * \param[in] v: value
+     */
+    void setVariableValue(EvaluationContext&,
+                          const std::string&,
+                          const double) const;
+    /*!
+     * \brief set the value of a variable in an evaluation context
+     * \param[in] c: evaluation context
+     * \param[in] p: position of the variable
+     * \param[in] v: value
+     */
+    void setVariableValue(EvaluationContext&,
+                          const std::vector<double>::size_type,
+                          const double) const;
+    /*!
+     * \brief evaluate the formula using the values of the variables given
+     * by an evaluation context.
+     * \return the result of the evaluation
+     * \param[in] c: evaluation context
+     * \note no lock is involved: if the evaluator is not reentrant (see
+     * the `isReentrant` method), the private copy of the evaluator held by
+     * the context is used.
+     */
+    double getValue(const EvaluationContext&) const;
+    /*!
+     * \return if the evaluator can be evaluated directly on the values of
+     * the variables of an evaluation context. This requires the evaluator
+     * to be compiled and not to call external functions.
+     */
+    bool isReentrant() const noexcept;
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -186,6 +262,53 @@ namespace tfel::math {
      * have been set with the `setVariableValue` method.
      */
     double getValue(const std::map<std::string, double>&);
+    /*!
+     * \brief evaluate the formula and its derivatives with respect to some
+     * variables.
+     *
+     * The formula and its derivatives are compiled in a single program, so
+     * that the sub-expressions shared by the formula and its derivatives
+     * are evaluated only once (see the `Bytecode` class). This program is
+     * built at the first call and reused as long as the derivatives with
+     * respect to the same variables are requested.
+     *
+     * \return the value of the formula
+     * \param[out] g: derivatives
+     * \param[in] vs: positions of the variables
+     * \note variables values shall have been set with the
+     * `setVariableValue` method.
+     */
+    double getValueAndGradient(
+        double* const, const std::vector<std::vector<double>::size_type>&);
+    /*!
+     * \brief evaluate the formula on a set of points.
+     *
+     * The variables are bound by position once for all the points. If the
+     * formula can be compiled, it is evaluated by blocks of points (see the
+     * `Bytecode` class).
+     *
+     * \param[out] r: results
+     * \param[in] args: values of the variables. The i-th element points to
+     * the values of the i-th variable. If this pointer is null, the current
+     * value of the variable is used for all points.
+     * \param[in] n: number of points
+     * \note the values of the variables stored in the evaluator are left
+     * unchanged.
+     */
+    void getValues(double* const,
+                   const std::vector<const double*>&,
+                   const std::vector<double>::size_type) override;
+    /*!
+     * \brief evaluate the formula on a set of points.
+     * \param[out] r: results
+     * \param[in] args: a map giving the values of some of the variables.
+     * \param[in] n: number of points
+     * \note the values of the variables not given in argument shall
+     * have been set with the `setVariableValue` method.
+     */
+    void getValues(double* const,
+                   const std::map<std::string, const double*>&,
+                   const std::vector<double>::size_type);
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -244,6 +367,12 @@ namespace tfel::math {
     static bool TFEL_VISIBILITY_LOCAL isNumber(const std::string&);
     //! \brief clear the object
     TFEL_VISIBILITY_LOCAL void clear();
+    /*!
+     * \return the compiled expression or a null pointer if the expression
+     * can't be compiled
+     */
+    TFEL_VISIBILITY_LOCAL std::unique_ptr<tfel::math::parser::Bytecode>
+    buildBytecode() const;
     void TFEL_VISIBILITY_LOCAL
     treatDiff(std::vector<std::string>::const_iterator&,
               const std::vector<std::string>::const_iterator,
@@ -350,6 +479,14 @@ namespace tfel::math {
      * formula to be evaluated
      */
     ExprPtr expr;
+    //! \brief compiled expression, if any
+    std::unique_ptr<tfel::math::parser::Bytecode> bytecode;
+    //! \brief positions of the variables used by `getValueAndGradient`
+    std::vector<std::vector<double>::size_type> gradient_variables;
+    //! \brief derivatives used by `getValueAndGradient`
+    std::vector<ExprPtr> gradient;
+    //! \brief program computing the formula and its derivatives, if any
+    std::unique_ptr<tfel::math::parser::Bytecode> gradient_bytecode;
     //! \brief a pointer to externally defined functions
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager> manager;
   };  // end of struct Evaluator
@@ -19,6 +19,7 @@
 
 #include "TFEL/Math/Kriging/KrigingVariable.hxx"
 #include "TFEL/Math/Kriging/KrigingDefaultModels.hxx"
+#include "TFEL/Math/Kriging/KrigingLUDecomposition.hxx"
 
 namespace tfel::math {
 
@@ -26,13 +27,53 @@ namespace tfel::math {
             typename T = double,
             typename Model = KrigingDefaultModel<N, T>>
   struct TFEL_VISIBILITY_LOCAL Kriging : public Model {
+    //! \brief a simple alias
+    using size_type = typename tfel::math::vector<T>::size_type;
+
     Kriging() = default;
 
     void addValue(const typename KrigingVariable<N, T>::type&, const T&);
-
+    /*!
+     * \brief set the number of threads used to build and evaluate the
+     * interpolation
+     * \param[in] n: number of threads. If greater than one, a thread pool
+     * is created. Otherwise, the calling thread is used, which is the
+     * default.
+     * \note threads are only used for large numbers of samples or of
+     * evaluation points.
+     */
+    void setNumberOfThreads(const unsigned int);
+    /*!
+     * \brief build the interpolation from all the samples.
+     *
+     * The kriging system is decomposed using a blocked LU decomposition
+     * whose decomposition is kept to allow incremental updates.
+     */
     void buildInterpolation();
+    /*!
+     * \brief update the interpolation to take into account the samples added
+     * since the last call to `buildInterpolation` or to `updateInterpolation`.
+     *
+     * The decomposition of the kriging system is extended, one sample at a
+     * time, at a cost proportional to the square of the number of samples.
+     * The interpolation is fully rebuilt if no decomposition is available or
+     * if a sample makes the extended system numerically singular.
+     *
+     * \note the model (covariance, drifts and nugget effect) must not have
+     * been changed since the interpolation was built.
+     */
+    void updateInterpolation();
 
     T operator()(const typename KrigingVariable<N, T>::type&) const;
+    /*!
+     * \brief evaluate the interpolation on a set of points
+     * \param[out] r: values
+     * \param[in] p: points
+     * \param[in] n: number of points
+     */
+    void evaluate(T* const,
+                  const typename KrigingVariable<N, T>::type* const,
+                  const size_type) const;
 
     ~Kriging() noexcept;
 
@@ -42,7 +83,10 @@ namespace tfel::math {
 
     tfel::math::vector<typename KrigingVariable<N, T>::type> x;
     tfel::math::vector<T> f;
+    //! \brief drifts coefficients followed by the samples coefficients
     tfel::math::vector<T> a;
+    //! \brief decomposition of the kriging system
+    KrigingLUDecomposition<T> lu;
 
   };  // end of struct Kriging
 
@@ -14,14 +14,10 @@
 #ifndef LIB_TFEL_MATH_KRIGINGIXX
 #define LIB_TFEL_MATH_KRIGINGIXX
 
+#include <vector>
 #include <algorithm>
 
 #include "TFEL/Math/matrix.hxx"
-#ifdef HAVE_ATLAS
-#include "TFEL/Math/Bindings/atlas.hxx"
-#else
-#include "TFEL/Math/LUSolve.hxx"
-#endif /* LIB_TFEL_MATH_KRIGINGIXX */
 #include "TFEL/Math/Kriging/KrigingErrors.hxx"
 
 namespace tfel::math {
@@ -45,6 +41,11 @@ namespace tfel::math {
         }
         ApplySpecificationDrifts<n + 1, nb, N, T, Model>::apply(m, n0, x);
       }
+      static void apply(T* const d,
+                        const typename KrigingVariable<N, T>::type& xv) {
+        d[n] = (Model::drifts[n])(xv);
+        ApplySpecificationDrifts<n + 1, nb, N, T, Model>::apply(d, xv);
+      }
       static void apply(T& r,
                         typename tfel::math::vector<T>::const_iterator& pa,
                         const typename KrigingVariable<N, T>::type& xv) {
@@ -60,6 +61,8 @@ namespace tfel::math {
           const typename tfel::math::vector<
               typename KrigingVariable<N, T>::type>::size_type,
           const tfel::math::vector<typename KrigingVariable<N, T>::type>&) {}
+      static void apply(T* const, const typename KrigingVariable<N, T>::type&) {
+      }
       static void apply(T&,
                         typename tfel::math::vector<T>::const_iterator&,
                         const typename KrigingVariable<N, T>::type&) {}
@@ -72,18 +75,57 @@ namespace tfel::math {
       const typename KrigingVariable<N, T>::type& xv) const {
     using namespace tfel::math;
     using namespace tfel::math::internals;
-    typedef typename vector<T>::difference_type diff;
     typename vector<T>::size_type i;
-    typename vector<T>::const_iterator p =
-        a.begin() + static_cast<diff>(this->x.size());
+    typename vector<T>::const_iterator p = a.begin();
     T r(0);
     for (i = 0; i != this->x.size(); ++i) {
-      r += a[i] * Model::covariance(xv - this->x[i]);
+      r += a[Model::nb + i] * Model::covariance(xv - this->x[i]);
     }
     ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(r, p, xv);
     return r;
   }  // end of Kriging<N,T,Model>::operator()
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::evaluate(
+      T* const r,
+      const typename KrigingVariable<N, T>::type* const p,
+      const size_type n) const {
+    using namespace tfel::math::internals;
+    // number of evaluation points treated at once
+    constexpr size_type qbs = 64;
+    // number of samples treated at once
+    constexpr size_type sbs = 1024;
+    const auto ns = this->x.size();
+    const auto tp = this->lu.getThreadPool(n * ns);
+    krigingParallelFor(size_type(0), n, tp, [this, r, p, ns](
+                                                const size_type b,
+                                                const size_type e) {
+      for (size_type q0 = b; q0 < e; q0 += qbs) {
+        const auto q1 = std::min(q0 + qbs, e);
+        for (size_type q = q0; q != q1; ++q) {
+          auto pa = this->a.begin();
+          auto v = T(0);
+          ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(v, pa,
+                                                                     p[q]);
+          r[q] = v;
+        }
+        // the samples are treated by blocks which stay in cache while
+        // the contributions to the current evaluation points are computed
+        for (size_type s0 = 0; s0 < ns; s0 += sbs) {
+          const auto s1 = std::min(s0 + sbs, ns);
+          for (size_type q = q0; q != q1; ++q) {
+            auto v = T(0);
+            for (size_type s = s0; s != s1; ++s) {
+              v += this->a[Model::nb + s] *
+                   Model::covariance(p[q] - this->x[s]);
+            }
+            r[q] += v;
+          }
+        }
+      }
+    });
+  }  // end of Kriging<N,T,Model>::evaluate
+
   template <unsigned short N, typename T, typename Model>
   void Kriging<N, T, Model>::addValue(
       const typename KrigingVariable<N, T>::type& xv, const T& fv) {
@@ -92,17 +134,15 @@ namespace tfel::math {
     this->f.push_back(fv);
   }
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::setNumberOfThreads(const unsigned int n) {
+    this->lu.setNumberOfThreads(n);
+  }  // end of Kriging<N,T,Model>::setNumberOfThreads
+
   template <unsigned short N, typename T, typename Model>
   void Kriging<N, T, Model>::buildInterpolation() {
-    using namespace std;
-    using namespace tfel::math;
     using namespace tfel::math::internals;
-#ifdef HAVE_ATLAS
-    using namespace tfel::math::atlas;
-#endif /* LIB_TFEL_MATH_KRIGINGIXX */
-    using tfel::math::vector;
-    typename vector<T>::size_type i;
-    typename vector<T>::size_type j;
+    constexpr auto nd = size_type{Model::nb};
     if (x.size() != f.size()) {
       throw(KrigingErrorInvalidLength());
     }
@@ -112,26 +152,69 @@ namespace tfel::math {
     if (x.size() <= Model::nb) {
       throw(KrigingErrorInsufficientData());
     }
-    matrix<T> m(x.size() + Model::nb, x.size() + Model::nb,
-                T(0));                                      // temporary matrix
-    this->a.resize(x.size() + Model::nb, T(0));             // unknowns
-    copy(this->f.begin(), this->f.end(), this->a.begin());  // copy values
-    // filling the matrix
-    for (i = 0; i != x.size(); ++i) {
-      for (j = 0; j != i; ++j) {
-        m(i, j) = m(j, i) = Model::covariance(this->x[i] - this->x[j]);
+    // the unknowns are ordered as follows: the drifts coefficients
+    // followed by the samples coefficients, so that new samples can be
+    // appended to the system
+    const auto ns = this->x.size();
+    const auto s = ns + nd;
+    auto m = std::vector<T>(s * s, T(0));
+    const auto tp = this->lu.getThreadPool(ns * ns);
+    krigingParallelFor(size_type(0), ns, tp, [this, &m, ns, s](
+                                                 const size_type b,
+                                                 const size_type e) {
+      for (size_type i = b; i != e; ++i) {
+        auto* const ri = m.data() + (nd + i) * s;
+        ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(
+            ri, this->x[i]);
+        for (size_type j = 0; j != ns; ++j) {
+          ri[nd + j] = (i == j) ? Model::nuggetEffect(i, this->x[i])
+                                : Model::covariance(this->x[i] - this->x[j]);
+        }
+      }
+    });
+    for (size_type k = 0; k != nd; ++k) {
+      for (size_type i = 0; i != ns; ++i) {
+        m[k * s + nd + i] = m[(nd + i) * s + k];
       }
-      m(i, i) = Model::nuggetEffect(i, x[i]);
     }
-    ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(
-        m, this->x.size(), this->x);
-    // computing unknown values
-#ifdef HAVE_ATLAS
-    gesv(m, this->a);
-#else
-    LUSolve::exe(m, this->a);
-#endif /* LIB_TFEL_MATH_KRIGINGIXX */
-  }
+    this->lu.decompose(std::move(m), s);
+    this->a.resize(s);
+    std::fill(this->a.begin(), this->a.begin() + nd, T(0));
+    std::copy(this->f.begin(), this->f.end(), this->a.begin() + nd);
+    this->lu.solve(this->a);
+  }  // end of Kriging<N,T,Model>::buildInterpolation
+
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::updateInterpolation() {
+    using namespace tfel::math::internals;
+    constexpr auto nd = size_type{Model::nb};
+    if (this->lu.size() == 0) {
+      this->buildInterpolation();
+      return;
+    }
+    if (x.size() != f.size()) {
+      throw(KrigingErrorInvalidLength());
+    }
+    const auto ns = this->x.size();
+    const auto s = ns + nd;
+    this->lu.reserve(s);
+    auto b = std::vector<T>(s);
+    for (auto i = this->lu.size() - nd; i != ns; ++i) {
+      ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(b.data(),
+                                                                 this->x[i]);
+      for (size_type j = 0; j != i; ++j) {
+        b[nd + j] = Model::covariance(this->x[i] - this->x[j]);
+      }
+      if (!this->lu.extend(b.data(), Model::nuggetEffect(i, this->x[i]))) {
+        this->buildInterpolation();
+        return;
+      }
+    }
+    this->a.resize(s);
+    std::fill(this->a.begin(), this->a.begin() + nd, T(0));
+    std::copy(this->f.begin(), this->f.end(), this->a.begin() + nd);
+    this->lu.solve(this->a);
+  }  // end of Kriging<N,T,Model>::updateInterpolation
 
   template <unsigned short N, typename T, typename Model>
   Kriging<N, T, Model>::~Kriging() noexcept = default;
@@ -0,0 +1,140 @@
+/*!
+ * \file  include/TFEL/Math/Kriging/KrigingLUDecomposition.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_HXX
+#define LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_HXX
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+namespace tfel::math {
+
+  namespace internals {
+
+    /*!
+     * \brief split the range `[b, e[` in contiguous chunks and call `f` on
+     * each chunk using the threads of the given pool.
+     * \param[in] b: beginning of the range
+     * \param[in] e: end of the range
+     * \param[in] p: thread pool. If null, the whole range is treated by the
+     * calling thread.
+     * \param[in] f: function taking the bounds of a chunk
+     *
+     * The range is split in as many chunks as threads in the pool. The last
+     * chunk is treated by the calling thread. If an exception is thrown
+     * while treating a chunk, it is rethrown once all the chunks are
+     * treated.
+     */
+    template <typename SizeType, typename Function>
+    void krigingParallelFor(const SizeType,
+                            const SizeType,
+                            tfel::system::ThreadPool* const,
+                            const Function&);
+
+  }  // end of namespace internals
+
+  /*!
+   * \brief LU decomposition with partial pivoting of the matrices of the
+   * kriging systems.
+   *
+   * Those matrices are symmetric, but indefinite, since the covariance
+   * block is bordered by the drifts. A symmetric decomposition such as the
+   * Cholesky decomposition can't be used.
+   *
+   * The decomposition is computed by blocks of columns. The update of the
+   * trailing sub-matrix, which concentrates most of the computational cost,
+   * can be shared among the threads of a thread pool. By default, no
+   * thread pool is used.
+   *
+   * The decomposition can be extended when a row and a column are appended
+   * to the matrix, at a cost proportional to the square of the size of the
+   * matrix, without pivoting.
+   *
+   * The factors are stored row by row in a single array. The leading
+   * dimension of this array may be greater than the size of the matrix to
+   * allow successive extensions without reallocation.
+   */
+  template <typename T>
+  struct KrigingLUDecomposition {
+    //! \brief a simple alias
+    using size_type = typename tfel::math::vector<T>::size_type;
+    /*!
+     * \brief set the number of threads used by the decomposition
+     * \param[in] n: number of threads. If greater than one, a thread pool
+     * is created. Otherwise, the decomposition is performed by the calling
+     * thread, which is the default.
+     */
+    void setNumberOfThreads(const unsigned int);
+    //! \return the number of threads used by the decomposition
+    unsigned int getNumberOfThreads() const noexcept;
+    /*!
+     * \return the thread pool to be used for the given workload, or a null
+     * pointer if the workload shall be treated by the calling thread.
+     * \param[in] w: workload, i.e. an estimate of the number of elementary
+     * operations
+     */
+    tfel::system::ThreadPool* getThreadPool(const size_type) const noexcept;
+    //! \return the size of the decomposed matrix
+    size_type size() const noexcept;
+    //! \brief discard the current decomposition
+    void clear() noexcept;
+    /*!
+     * \brief reserve memory for a matrix of the given size
+     * \param[in] s: size
+     */
+    void reserve(const size_type);
+    /*!
+     * \brief decompose a matrix
+     * \param[in] m: matrix, stored row by row
+     * \param[in] s: size of the matrix
+     */
+    void decompose(std::vector<T>&&, const size_type);
+    /*!
+     * \brief extend the decomposition of a symmetric matrix `A` to the
+     * matrix `[[A, b], [b^T, c]]`.
+     * \return false if the extended matrix is numerically singular. In this
+     * case, the decomposition is left unchanged.
+     * \param[in] b: new column, in the original ordering of the rows
+     * \param[in] c: new diagonal term
+     */
+    bool extend(const T* const, const T);
+    /*!
+     * \brief solve the linear system using the current decomposition
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    void solve(tfel::math::vector<T>&) const;
+
+   private:
+    //! \brief factors of the decomposition
+    std::vector<T> values;
+    //! \brief pivots, following LAPACK's convention
+    std::vector<size_type> pivots;
+    //! \brief size of the decomposed matrix
+    size_type n = 0;
+    //! \brief leading dimension of the `values` array
+    size_type ld = 0;
+    /*!
+     * \brief thread pool, if any. This pool is shared by the copies of the
+     * decomposition.
+     */
+    std::shared_ptr<tfel::system::ThreadPool> pool;
+  };  // end of struct KrigingLUDecomposition
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Kriging/KrigingLUDecomposition.ixx"
+
+#endif /* LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_HXX */
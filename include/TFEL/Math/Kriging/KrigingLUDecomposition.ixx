@@ -0,0 +1,326 @@
+/*!
+ * \file  include/TFEL/Math/Kriging/KrigingLUDecomposition.ixx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_IXX
+#define LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_IXX
+
+#include <cmath>
+#include <limits>
+#include <future>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+
+namespace tfel::math {
+
+  namespace internals {
+
+    template <typename SizeType, typename Function>
+    void krigingParallelFor(const SizeType b,
+                            const SizeType e,
+                            tfel::system::ThreadPool* const p,
+                            const Function& f) {
+      if (e <= b) {
+        return;
+      }
+      const auto s = e - b;
+      const auto nt =
+          (p == nullptr) ? SizeType(1)
+                         : static_cast<SizeType>(p->getNumberOfThreads());
+      if ((nt <= 1) || (s < 2)) {
+        f(b, e);
+        return;
+      }
+      const auto nc = std::min(nt, s);
+      const auto cs = s / nc;
+      const auto rc = s % nc;
+      auto results = std::vector<
+          std::future<tfel::system::ThreadedTaskResult<void>>>{};
+      results.reserve(nc - 1);
+      auto cb = b;
+      for (SizeType c = 0; c + 1 != nc; ++c) {
+        const auto ce = cb + cs + (c < rc ? 1 : 0);
+        results.push_back(p->addTask([&f, cb, ce] { f(cb, ce); }));
+        cb = ce;
+      }
+      // the last chunk is treated by the calling thread
+      auto error = std::exception_ptr{};
+      try {
+        f(cb, e);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // all the tasks must be finished before leaving, since they refer to
+      // the function
+      auto tresults = std::vector<tfel::system::ThreadedTaskResult<void>>{};
+      tresults.reserve(results.size());
+      for (auto& r : results) {
+        tresults.push_back(r.get());
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+      for (auto& r : tresults) {
+        if (!r) {
+          r.rethrow();
+        }
+      }
+    }  // end of krigingParallelFor
+
+  }  // end of namespace internals
+
+  template <typename T>
+  void KrigingLUDecomposition<T>::setNumberOfThreads(const unsigned int nt) {
+    if (nt <= 1) {
+      this->pool.reset();
+    } else {
+      this->pool = std::make_shared<tfel::system::ThreadPool>(
+          static_cast<tfel::system::ThreadPool::size_type>(nt));
+    }
+  }  // end of setNumberOfThreads
+
+  template <typename T>
+  unsigned int KrigingLUDecomposition<T>::getNumberOfThreads() const noexcept {
+    if (this->pool == nullptr) {
+      return 1u;
+    }
+    return static_cast<unsigned int>(this->pool->getNumberOfThreads());
+  }  // end of getNumberOfThreads
+
+  template <typename T>
+  tfel::system::ThreadPool* KrigingLUDecomposition<T>::getThreadPool(
+      const size_type w) const noexcept {
+    // using threads is not worth it for small workloads
+    constexpr size_type wmin = size_type(1) << 20;
+    return w < wmin ? nullptr : this->pool.get();
+  }  // end of getThreadPool
+
+  template <typename T>
+  typename KrigingLUDecomposition<T>::size_type
+  KrigingLUDecomposition<T>::size() const noexcept {
+    return this->n;
+  }  // end of size
+
+  template <typename T>
+  void KrigingLUDecomposition<T>::clear() noexcept {
+    this->values.clear();
+    this->pivots.clear();
+    this->n = 0;
+    this->ld = 0;
+  }  // end of clear
+
+  template <typename T>
+  void KrigingLUDecomposition<T>::reserve(const size_type s) {
+    if (s <= this->ld) {
+      return;
+    }
+    auto nvalues = std::vector<T>(s * s, T(0));
+    for (size_type i = 0; i != this->n; ++i) {
+      const auto* const ri = this->values.data() + i * this->ld;
+      std::copy(ri, ri + this->n, nvalues.data() + i * s);
+    }
+    this->values = std::move(nvalues);
+    this->ld = s;
+    this->pivots.reserve(s);
+  }  // end of reserve
+
+  template <typename T>
+  void KrigingLUDecomposition<T>::decompose(std::vector<T>&& m,
+                                            const size_type s) {
+    // number of columns treated at once
+    constexpr size_type bs = 64;
+    // number of columns of the trailing sub-matrix updated at once
+    constexpr size_type cbs = 256;
+    if (s == 0) {
+      tfel::raise<LUInvalidMatrixSize>();
+    }
+    if (m.size() != s * s) {
+      tfel::raise<LUUnmatchedSize>();
+    }
+    this->values = std::move(m);
+    this->pivots.resize(s);
+    this->n = s;
+    this->ld = s;
+    auto* const a = this->values.data();
+    for (size_type k0 = 0; k0 < s; k0 += bs) {
+      const auto k1 = std::min(k0 + bs, s);
+      // decomposition of the current block of columns
+      for (size_type k = k0; k != k1; ++k) {
+        auto p = k;
+        auto vmax = std::abs(a[k * s + k]);
+        for (size_type i = k + 1; i != s; ++i) {
+          const auto v = std::abs(a[i * s + k]);
+          if (v > vmax) {
+            vmax = v;
+            p = i;
+          }
+        }
+        if (!(vmax > T(0))) {
+          this->clear();
+          tfel::raise<LUNullPivot>();
+        }
+        this->pivots[k] = p;
+        if (p != k) {
+          std::swap_ranges(a + k * s, a + (k + 1) * s, a + p * s);
+        }
+        const auto* const rk = a + k * s;
+        const auto ip = 1 / rk[k];
+        for (size_type i = k + 1; i != s; ++i) {
+          auto* const ri = a + i * s;
+          ri[k] *= ip;
+          const auto lik = ri[k];
+          for (size_type j = k + 1; j != k1; ++j) {
+            ri[j] -= lik * rk[j];
+          }
+        }
+      }
+      if (k1 == s) {
+        break;
+      }
+      // rows of U on the right of the current block of columns
+      for (size_type k = k0; k != k1; ++k) {
+        const auto* const rk = a + k * s;
+        for (size_type i = k + 1; i != k1; ++i) {
+          auto* const ri = a + i * s;
+          const auto lik = ri[k];
+          for (size_type j = k1; j != s; ++j) {
+            ri[j] -= lik * rk[j];
+          }
+        }
+      }
+      // update of the trailing sub-matrix, by blocks of columns so that
+      // the rows of U involved stay in cache
+      const auto r = s - k1;
+      const auto tp = this->getThreadPool(r * r * (k1 - k0));
+      internals::krigingParallelFor(
+          k1, s, tp, [a, s, k0, k1](const size_type b, const size_type e) {
+            for (size_type j0 = k1; j0 < s; j0 += cbs) {
+              const auto j1 = std::min(j0 + cbs, s);
+              for (size_type i = b; i != e; ++i) {
+                auto* const ri = a + i * s;
+                auto k = k0;
+                // four rows of U are treated at once to reduce the number
+                // of loads and stores of the current row
+                for (; k + 4 <= k1; k += 4) {
+                  const auto l0 = ri[k];
+                  const auto l1 = ri[k + 1];
+                  const auto l2 = ri[k + 2];
+                  const auto l3 = ri[k + 3];
+                  const auto* const r0 = a + k * s;
+                  const auto* const r1 = r0 + s;
+                  const auto* const r2 = r1 + s;
+                  const auto* const r3 = r2 + s;
+                  for (size_type j = j0; j != j1; ++j) {
+                    ri[j] -= l0 * r0[j] + l1 * r1[j] + l2 * r2[j] + l3 * r3[j];
+                  }
+                }
+                for (; k != k1; ++k) {
+                  const auto lik = ri[k];
+                  const auto* const rk = a + k * s;
+                  for (size_type j = j0; j != j1; ++j) {
+                    ri[j] -= lik * rk[j];
+                  }
+                }
+              }
+            }
+          });
+    }
+  }  // end of decompose
+
+  template <typename T>
+  bool KrigingLUDecomposition<T>::extend(const T* const b, const T c) {
+    const auto m = this->n;
+    auto u = std::vector<T>(b, b + m);
+    auto l = std::vector<T>(b, b + m);
+    // u = L^{-1} P b
+    for (size_type k = 0; k != m; ++k) {
+      if (this->pivots[k] != k) {
+        std::swap(u[k], u[this->pivots[k]]);
+      }
+    }
+    for (size_type i = 0; i != m; ++i) {
+      const auto* const ri = this->values.data() + i * this->ld;
+      auto v = u[i];
+      for (size_type k = 0; k != i; ++k) {
+        v -= ri[k] * u[k];
+      }
+      u[i] = v;
+    }
+    // l = U^{-T} b
+    for (size_type k = 0; k != m; ++k) {
+      const auto* const rk = this->values.data() + k * this->ld;
+      l[k] /= rk[k];
+      const auto lk = l[k];
+      for (size_type j = k + 1; j != m; ++j) {
+        l[j] -= rk[j] * lk;
+      }
+    }
+    // new pivot
+    auto d = c;
+    auto scale = std::abs(c);
+    for (size_type k = 0; k != m; ++k) {
+      d -= l[k] * u[k];
+      scale += std::abs(l[k] * u[k]);
+    }
+    const auto rtol = std::sqrt(std::numeric_limits<T>::epsilon());
+    if (!(std::abs(d) > rtol * scale)) {
+      return false;
+    }
+    if (m + 1 > this->ld) {
+      this->reserve(m + 1 + std::max(m / 8, size_type(16)));
+    }
+    auto* const a = this->values.data();
+    for (size_type i = 0; i != m; ++i) {
+      a[i * this->ld + m] = u[i];
+    }
+    std::copy(l.begin(), l.end(), a + m * this->ld);
+    a[m * this->ld + m] = d;
+    this->pivots.push_back(m);
+    ++(this->n);
+    return true;
+  }  // end of extend
+
+  template <typename T>
+  void KrigingLUDecomposition<T>::solve(tfel::math::vector<T>& x) const {
+    if (x.size() != this->n) {
+      tfel::raise<LUUnmatchedSize>();
+    }
+    const auto* const a = this->values.data();
+    for (size_type k = 0; k != this->n; ++k) {
+      if (this->pivots[k] != k) {
+        std::swap(x[k], x[this->pivots[k]]);
+      }
+    }
+    for (size_type i = 0; i != this->n; ++i) {
+      const auto* const ri = a + i * this->ld;
+      auto v = x[i];
+      for (size_type k = 0; k != i; ++k) {
+        v -= ri[k] * x[k];
+      }
+      x[i] = v;
+    }
+    for (size_type i = this->n; i-- != 0;) {
+      const auto* const ri = a + i * this->ld;
+      auto v = x[i];
+      for (size_type k = i + 1; k != this->n; ++k) {
+        v -= ri[k] * x[k];
+      }
+      x[i] = v / ri[i];
+    }
+  }  // end of solve
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGING_KRIGINGLUDECOMPOSITION_IXX */
@@ -32,6 +32,12 @@ namespace tfel::math {
               const tfel::math::vector<double>&);
 
     double operator()(const double) const;
+    /*!
+     * \brief evaluate the interpolation on a set of points
+     * \return the values of the interpolation
+     * \param[in] vx: coordinates of the points
+     */
+    std::vector<double> operator()(const std::vector<double>&) const;
 
     ~Kriging1D();
 
@@ -0,0 +1,59 @@
+/*!
+ * \file
+ * include/TFEL/Math/NonLinearSolvers/TinyNewtonRaphsonJacobianReuseSolver.ixx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_IXX
+#define LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_IXX
+
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+
+namespace tfel::math {
+
+  template <unsigned short N, typename NumericType, typename Child>
+  bool TinyNewtonRaphsonJacobianReuseSolver<N, NumericType, Child>::
+      decomposeJacobian() noexcept {
+    this->decomposed_jacobian = this->jacobian;
+    this->is_decomposed_jacobian_defined =
+        TinyMatrixSolve<N, NumericType, false>::decomp(
+            this->decomposed_jacobian, this->decomposed_jacobian_permutation);
+    return this->is_decomposed_jacobian_defined;
+  }  // end of decomposeJacobian
+
+  template <unsigned short N, typename NumericType, typename Child>
+  bool TinyNewtonRaphsonJacobianReuseSolver<N, NumericType, Child>::
+      computeNewCorrection() {
+    auto& child = static_cast<Child&>(*this);
+    child.updateOrCheckJacobian();
+    const auto e = child.computeResidualNorm();
+    if ((!this->is_decomposed_jacobian_defined) ||
+        (e > this->jacobian_reuse_threshold * this->previous_residual_norm)) {
+      if (!child.decomposeJacobian()) {
+        return false;
+      }
+      ++(this->number_of_jacobian_decompositions);
+    } else {
+      ++(this->number_of_jacobian_reuses);
+    }
+    this->previous_residual_norm = e;
+    if (!TinyMatrixSolve<N, NumericType, false>::back_substitute(
+            this->decomposed_jacobian, this->decomposed_jacobian_permutation,
+            this->fzeros)) {
+      return false;
+    }
+    this->delta_zeros = -(this->fzeros);
+    return true;
+  }  // end of computeNewCorrection
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_IXX */
@@ -18,6 +18,7 @@
 #include <string>
 #include <cstring>
 #include <cerrno>
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -65,6 +66,13 @@ namespace tfel::math::parser {
     return res;
   }  // end of StandardBinaryFunction::StandardBinaryFunction
 
+  template <double (*f)(const double, const double)>
+  void StandardBinaryFunction<f>::compile(Bytecode& b) const {
+    this->expr1->compile(b);
+    this->expr2->compile(b);
+    b.addStandardBinaryFunction(f);
+  }  // end of compile
+
   template <double (*f)(const double, const double)>
   void StandardBinaryFunction<f>::checkCyclicDependency(
       std::vector<std::string>& names) const {
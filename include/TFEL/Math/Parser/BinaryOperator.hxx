@@ -104,6 +104,7 @@ namespace tfel::math::parser {
     //
     bool isConstant() const override;
     double getValue() const override final;
+    void compile(Bytecode&) const override final;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     std::string getCxxFormula(
         const std::vector<std::string>&) const override final;
@@ -15,6 +15,9 @@
 #ifndef LIB_TFEL_MATH_PARSER_BINARYOPERATORIXX
 #define LIB_TFEL_MATH_PARSER_BINARYOPERATORIXX
 
+#include <type_traits>
+#include "TFEL/Math/Parser/Bytecode.hxx"
+
 namespace tfel::math::parser {
 
   template <typename Op>
@@ -38,6 +41,24 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  void BinaryOperation<Op>::compile(Bytecode& c) const {
+    this->a->compile(c);
+    this->b->compile(c);
+    if constexpr (std::is_same_v<Op, OpPlus>) {
+      c.addAddition();
+    } else if constexpr (std::is_same_v<Op, OpMinus>) {
+      c.addSubtraction();
+    } else if constexpr (std::is_same_v<Op, OpMult>) {
+      c.addMultiplication();
+    } else if constexpr (std::is_same_v<Op, OpDiv>) {
+      c.addDivision();
+    } else {
+      static_assert(std::is_same_v<Op, OpPower>, "unsupported operator");
+      c.addPower();
+    }
+  }  // end of compile
+
   template <typename Op>
   std::string BinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
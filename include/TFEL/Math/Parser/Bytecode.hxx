@@ -0,0 +1,408 @@
+/*!
+ * \file   include/TFEL/Math/Parser/Bytecode.hxx
+ * \brief  This file declares the Bytecode class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+#define LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+
+#include <vector>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math::parser {
+
+  // forward declaration
+  struct Expr;
+  // forward declaration
+  struct LogicalExpr;
+
+  /*!
+   * \brief a flat program resulting from the compilation of an expression
+   * tree.
+   *
+   * The program is a linear sequence of instructions acting on a stack of
+   * registers. The program is simplified while being built:
+   *
+   * - instructions whose operands are known at compile-time are evaluated
+   *   during the compilation (constant folding).
+   * - operations with a neutral element (`x+0`, `x*1`, `x/1`, `x**1`,
+   *   `-(-x)`, etc.) are removed.
+   * - identical sub-programs are evaluated only once: the result of the
+   *   first one is saved and reused by the following ones.
+   *
+   * A program may leave several results on the stack, for instance the
+   * value of a formula and its derivatives.
+   *
+   * The evaluation of the program does not allocate memory and does not
+   * involve any virtual call, except for the nodes of the expression tree
+   * that can't be compiled (calls to external functions for instance), which
+   * are evaluated through the `Expr::getValue` method.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT Bytecode {
+    //! \brief a simple alias
+    using size_type = std::vector<double>::size_type;
+    //! \brief signature of an unary function
+    using UnaryFunctionPtr = double (*)(double);
+    //! \brief signature of a binary function
+    using BinaryFunctionPtr = double (*)(const double, const double);
+    //! \brief signature of a comparison operator
+    using ComparisonOperatorPtr = bool (*)(const double, const double);
+    //! \brief signature of a logical operator
+    using LogicalOperatorPtr = bool (*)(const bool, const bool);
+    //! \brief maximum number of registers
+    static constexpr size_type maximumStackSize = 64;
+    //! \brief number of points treated at once by the batch evaluation
+    static constexpr size_type blockSize = 32;
+    //! \brief maximum number of values shared between sub-programs
+    static constexpr size_type maximumNumberOfSavedValues = 32;
+    /*!
+     * \brief constructor
+     * \param[in] v: variables referenced by the expression
+     */
+    explicit Bytecode(const std::vector<double>&);
+    //! \return if the given vector holds the variables of the expression
+    bool isVariablesVector(const std::vector<double>&) const noexcept;
+    //! \return true if the program is empty
+    bool empty() const noexcept;
+    //! \return the number of instructions
+    size_type size() const noexcept;
+    //! \return the number of registers required by the program
+    size_type getStackSize() const noexcept;
+    //! \return the number of values left on the stack by the program
+    size_type getNumberOfResults() const noexcept;
+    /*!
+     * \return if the program can be evaluated on blocks of points, i.e. if
+     * it does not contain jumps nor expressions that can't be compiled.
+     */
+    bool isVectorizable() const noexcept;
+    /*!
+     * \return if the program only depends on the values of the variables
+     * passed to the `execute` method, i.e. if it does not contain
+     * expressions that can't be compiled. Such a program can be evaluated
+     * concurrently by several threads.
+     */
+    bool isReentrant() const noexcept;
+    /*!
+     * \brief add a numerical value
+     * \param[in] v: value
+     */
+    void addNumber(const double);
+    /*!
+     * \brief add a variable
+     * \param[in] p: position of the variable
+     */
+    void addVariable(const size_type);
+    //! \brief negate the value on top of the stack
+    void addNegation();
+    //! \brief add the two values on top of the stack
+    void addAddition();
+    //! \brief subtract the two values on top of the stack
+    void addSubtraction();
+    //! \brief multiply the two values on top of the stack
+    void addMultiplication();
+    //! \brief divide the two values on top of the stack
+    void addDivision();
+    //! \brief compute the power of the two values on top of the stack
+    void addPower();
+    /*!
+     * \brief apply a function to the value on top of the stack. The function
+     * is assumed to report errors by throwing exceptions.
+     * \param[in] f: function
+     */
+    void addFunction(const UnaryFunctionPtr);
+    /*!
+     * \brief apply a standard function to the value on top of the stack.
+     * Errors are reported by the function through `errno`.
+     * \param[in] f: function
+     */
+    void addStandardFunction(const UnaryFunctionPtr);
+    /*!
+     * \brief apply a standard function to the two values on top of the
+     * stack. Errors are reported by the function through `errno`.
+     * \param[in] f: function
+     */
+    void addStandardBinaryFunction(const BinaryFunctionPtr);
+    /*!
+     * \brief compute an integer power of the value on top of the stack
+     * \param[in] n: exponent
+     */
+    void addIntegerPower(const int);
+    /*!
+     * \brief compare the two values on top of the stack
+     * \param[in] op: comparison operator
+     */
+    void addComparison(const ComparisonOperatorPtr);
+    /*!
+     * \brief combine the two logical values on top of the stack
+     * \param[in] op: logical operator
+     */
+    void addLogicalOperation(const LogicalOperatorPtr);
+    //! \brief negate the logical value on top of the stack
+    void addLogicalNegation();
+    /*!
+     * \brief add an expression which can't be compiled. This expression will
+     * be evaluated by calling its `getValue` method.
+     * \param[in] e: expression
+     */
+    void addExpression(const Expr&);
+    /*!
+     * \brief add a logical expression which can't be compiled. This
+     * expression will be evaluated by calling its `getValue` method.
+     * \param[in] e: logical expression
+     */
+    void addLogicalExpression(const LogicalExpr&);
+    /*!
+     * \brief add a jump taken if the logical value on top of the stack is
+     * false.
+     * \return the position of the jump instruction
+     */
+    size_type addJumpIfFalse();
+    /*!
+     * \brief add an unconditional jump. The value on top of the stack is
+     * assumed to be the result of a branch of a conditional expression.
+     * \return the position of the jump instruction
+     */
+    size_type addJump();
+    /*!
+     * \brief set the target of the given jump to the current end of the
+     * program
+     * \param[in] j: position of the jump instruction
+     */
+    void setJumpTarget(const size_type);
+    /*!
+     * \brief remove the last instruction if it is a known value.
+     * \return true if the last instruction has been removed
+     * \param[out] v: value
+     */
+    bool popNumber(double&);
+    /*!
+     * \return the result of the program
+     * \param[in] v: values of the variables
+     */
+    double execute(const double* const) const;
+    /*!
+     * \brief evaluate a program leaving several results on the stack
+     * \param[out] r: results, in the order in which they have been computed
+     * \param[in] v: values of the variables
+     */
+    void execute(double* const, const double* const) const;
+    /*!
+     * \brief evaluate the program on a set of points.
+     *
+     * The points are treated by blocks of `blockSize` points: each
+     * instruction is applied to all the points of a block in a loop over
+     * contiguous values. The power operators and the `exp`, `log`, `sqrt`,
+     * `sin` and `cos` functions are applied by dedicated loops calling the
+     * standard functions directly. Other functions are called through a
+     * function pointer. The standard functions report their errors through
+     * `errno` and are thus not vectorized by the compiler.
+     *
+     * \param[out] r: results
+     * \param[in] args: values of the variables. The i-th element points to
+     * the values of the variable at position i. If this pointer is null, the
+     * current value of the variable is used for all points.
+     * \param[in] n: number of points
+     * \pre the program must be vectorizable and return only one result
+     */
+    void execute(double* const,
+                 const double* const* const,
+                 const size_type) const;
+    //! \brief destructor
+    ~Bytecode();
+
+   private:
+    //! \brief list of instructions
+    enum OpCode : unsigned char {
+      NUMBER,
+      VARIABLE,
+      NEGATION,
+      ADDITION,
+      SUBTRACTION,
+      MULTIPLICATION,
+      DIVISION,
+      POWER,
+      FUNCTION,
+      STANDARDFUNCTION,
+      STANDARDBINARYFUNCTION,
+      INTEGERPOWER,
+      COMPARISON,
+      LOGICALOPERATION,
+      LOGICALNEGATION,
+      EXPRESSION,
+      LOGICALEXPRESSION,
+      JUMPIFFALSE,
+      JUMP,
+      SAVE,
+      LOAD
+    };  // end of enum OpCode
+    //! \brief an instruction
+    struct Instruction {
+      //! \brief operation
+      OpCode opcode;
+      //! \brief operand
+      union {
+        double value;
+        size_type position;
+        int exponent;
+        UnaryFunctionPtr f1;
+        BinaryFunctionPtr f2;
+        ComparisonOperatorPtr comparison;
+        LogicalOperatorPtr logical_operator;
+        const Expr* expr;
+        const LogicalExpr* logical_expr;
+      };
+    };  // end of struct Instruction
+    //! \brief description of a value on the stack
+    struct Operand {
+      //! \brief position of the first instruction computing the value
+      size_type start;
+      /*!
+       * \brief if the instructions computing the value can be shared, i.e.
+       * if they don't contain jumps nor expressions that can't be compiled.
+       */
+      bool shareable;
+    };  // end of struct Operand
+    /*!
+     * \brief hash and number of instructions of a sub-program, once the
+     * shared values it uses are expanded
+     */
+    struct Signature {
+      //! \brief hash
+      std::size_t hash;
+      //! \brief number of instructions
+      size_type size;
+    };  // end of struct Signature
+    //! \brief description of a sub-program which can be shared
+    struct SharedValue {
+      //! \brief position of the first instruction
+      size_type start;
+      //! \brief position past the last instruction
+      size_type end;
+      //! \brief signature of the sub-program
+      Signature signature;
+      //! \brief if the result of the sub-program is saved
+      bool saved;
+      //! \brief position where the result of the sub-program is saved
+      size_type slot;
+    };  // end of struct SharedValue
+    /*!
+     * \brief evaluate the program
+     * \return a pointer past the top of the stack
+     * \param[in] stack: registers
+     * \param[in] saved: values shared between sub-programs
+     * \param[in] v: values of the variables
+     */
+    TFEL_VISIBILITY_LOCAL double* run(double* const,
+                                      double* const,
+                                      const double* const) const;
+    /*!
+     * \brief add a new instruction
+     * \param[in] i: instruction
+     * \param[in] np: number of values popped from the stack
+     */
+    TFEL_VISIBILITY_LOCAL void add(const Instruction&, const size_type);
+    //! \brief add an instruction pushing a value which can't be shared
+    TFEL_VISIBILITY_LOCAL void push(const Instruction&);
+    /*!
+     * \return if the last `n` instructions are known values that can be
+     * folded
+     * \param[in] n: number of instructions
+     */
+    TFEL_VISIBILITY_LOCAL bool canFold(const size_type) const noexcept;
+    /*!
+     * \brief try to replace the last `n` instructions, which are known
+     * values, and the instruction `i` by the result of the evaluation of
+     * those instructions.
+     * \return true on success
+     * \param[in] i: instruction
+     * \param[in] n: number of values popped from the stack
+     */
+    TFEL_VISIBILITY_LOCAL bool fold(const Instruction&, const size_type);
+    /*!
+     * \brief try to remove the instruction `i` if one of its operands is a
+     * neutral element.
+     * \return true on success
+     * \param[in] i: instruction
+     */
+    TFEL_VISIBILITY_LOCAL bool simplify(const Instruction&);
+    /*!
+     * \brief try to replace the instructions computing the value on top of
+     * the stack by the result of an identical sub-program.
+     */
+    TFEL_VISIBILITY_LOCAL void share();
+    //! \return if the given operand is the given known value
+    TFEL_VISIBILITY_LOCAL bool isNumber(const size_type,
+                                        const double) const noexcept;
+    /*!
+     * \brief remove all the instructions after the given position
+     * \param[in] p: position
+     */
+    TFEL_VISIBILITY_LOCAL void truncate(const size_type);
+    /*!
+     * \brief remove the instruction at the given position
+     * \param[in] p: position
+     */
+    TFEL_VISIBILITY_LOCAL void erase(const size_type);
+    /*!
+     * \brief insert an instruction at the given position
+     * \param[in] p: position
+     * \param[in] i: instruction
+     */
+    TFEL_VISIBILITY_LOCAL void insert(const size_type, const Instruction&);
+    //! \return the signature of the sub-program in the given range
+    TFEL_VISIBILITY_LOCAL Signature getSignature(const size_type,
+                                                 const size_type) const;
+    /*!
+     * \brief append the instructions of the sub-program in the given range
+     * to a list of instructions, expanding the shared values it uses.
+     * \param[out] l: list of instructions
+     * \param[in] b: position of the first instruction
+     * \param[in] e: position past the last instruction
+     */
+    TFEL_VISIBILITY_LOCAL void expand(std::vector<Instruction>&,
+                                      const size_type,
+                                      const size_type) const;
+    //! \return the sub-program whose result is saved at the given position
+    TFEL_VISIBILITY_LOCAL const SharedValue& getSavedValue(
+        const size_type) const;
+    //! \return if two instructions are identical
+    static TFEL_VISIBILITY_LOCAL bool areIdentical(
+        const Instruction&, const Instruction&) noexcept;
+    //! \brief variables referenced by the expression
+    const std::vector<double>* variables;
+    //! \brief instructions
+    std::vector<Instruction> code;
+    //! \brief values on the stack
+    std::vector<Operand> operands;
+    //! \brief sub-programs which can be shared
+    std::vector<SharedValue> shared_values;
+    /*!
+     * \brief positions of the first instructions of the conditional
+     * expressions being compiled
+     */
+    std::vector<size_type> conditions;
+    //! \brief maximal number of values in the stack
+    size_type max_depth = 0;
+    //! \brief number of loads of each saved value
+    std::vector<size_type> loads;
+    //! \brief positions of saved values which are no longer used
+    std::vector<size_type> free_slots;
+    /*!
+     * \brief first instruction that can be folded. Instructions before a
+     * jump target can't be folded with the ones after it.
+     */
+    size_type fence = 0;
+  };  // end of struct Bytecode
+
+}  // end of namespace tfel::math::parser
+
+#endif /* LIB_TFEL_MATH_PARSER_BYTECODE_HXX */
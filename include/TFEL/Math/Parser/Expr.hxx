@@ -23,6 +23,9 @@
 
 namespace tfel::math::parser {
 
+  // forward declaration
+  struct Bytecode;
+
   /*!
    * \brief base class resulting from the analysis of a formula.
    */
@@ -38,6 +41,13 @@ namespace tfel::math::parser {
     virtual bool isConstant() const = 0;
     //! \return the result of the evaluation of the expression
     virtual double getValue() const = 0;
+    /*!
+     * \brief append the instructions evaluating the expression to the given
+     * program. By default, the expression is evaluated by calling the
+     * `getValue` method.
+     * \param[in,out] b: program
+     */
+    virtual void compile(Bytecode&) const;
     //! \brief check if the expression does not lead to a cyclic dependency
     virtual void checkCyclicDependency(std::vector<std::string>&) const = 0;
     virtual std::shared_ptr<Expr> resolveDependencies(
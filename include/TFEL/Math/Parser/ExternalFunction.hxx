@@ -27,6 +27,19 @@ namespace tfel::math::parser {
 
   struct TFELMATHPARSER_VISIBILITY_EXPORT ExternalFunction {
     virtual double getValue() const = 0;
+    /*!
+     * \brief evaluate the function on a set of points
+     * \param[out] r: results
+     * \param[in] args: values of the variables. The i-th element points to
+     * the values of the i-th variable. If this pointer is null, the current
+     * value of the variable is used for all points.
+     * \param[in] n: number of points
+     * \note the default implementation sets the variables and calls the
+     * `getValue` method for each point.
+     */
+    virtual void getValues(double* const,
+                           const std::vector<const double*>&,
+                           const std::vector<double>::size_type);
     virtual void setVariableValue(const std::vector<double>::size_type,
                                   const double) = 0;
     virtual std::vector<double>::size_type getNumberOfVariables() const = 0;
@@ -47,6 +47,13 @@ namespace tfel::math::parser {
     KrigedFunction(const KrigedFunction&);
 
     double getValue() const override;
+    /*!
+     * \brief evaluate the function on a set of points using the batched
+     * evaluation of the kriging interpolation.
+     */
+    void getValues(double* const,
+                   const std::vector<const double*>&,
+                   const std::vector<double>::size_type) override;
 
     void setVariableValue(const std::vector<double>::size_type,
                           const double) override;
@@ -40,6 +40,34 @@ namespace tfel::math::parser {
     return this->k->operator()(this->v);
   }  // end of KrigedFunction<N>::getValue()
 
+  template <unsigned short N>
+  void KrigedFunction<N>::getValues(double* const r,
+                                    const std::vector<const double*>& args,
+                                    const std::vector<double>::size_type n) {
+    if (args.size() != N) {
+      // the default implementation reports the error
+      ExternalFunction::getValues(r, args, n);
+      return;
+    }
+    auto p = std::vector<Variable>(n, this->v);
+    for (unsigned short i = 0; i != N; ++i) {
+      if (args[i] == nullptr) {
+        continue;
+      }
+      for (std::vector<double>::size_type j = 0; j != n; ++j) {
+        if constexpr (N == 1) {
+          p[j] = args[i][j];
+        } else {
+          p[j](i) = args[i][j];
+        }
+      }
+    }
+    this->k->evaluate(r, p.data(), n);
+    if (n != 0) {
+      this->v = p.back();
+    }
+  }  // end of KrigedFunction<N>::getValues
+
   template <unsigned short N>
   void KrigedFunction<N>::setVariableValue(
       const std::vector<double>::size_type i_, const double v_) {
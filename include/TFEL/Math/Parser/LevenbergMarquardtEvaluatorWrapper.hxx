@@ -16,6 +16,7 @@
 #define LIB_LEVENBERGMARQUARDTEVALUATORWRAPPER_HXX
 
 #include <memory>
+#include <vector>
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/Evaluator.hxx"
@@ -43,8 +44,8 @@ namespace tfel::math::parser {
 
    private:
     std::shared_ptr<tfel::math::Evaluator> ev;
-    tfel::math::vector<std::shared_ptr<tfel::math::parser::ExternalFunction>>
-        dev;
+    //! \brief positions of the parameters in the variables of the evaluator
+    std::vector<std::vector<double>::size_type> parameters;
     size_type nv;
     size_type np;
   };
@@ -108,6 +108,13 @@ namespace tfel::math::parser {
   struct LogicalExpr {
     //! \return the result of the evaluation of the logical expression
     virtual bool getValue() const = 0;
+    /*!
+     * \brief append the instructions evaluating the expression to the given
+     * program. By default, the expression is evaluated by calling the
+     * `getValue` method.
+     * \param[in,out] b: program
+     */
+    virtual void compile(Bytecode&) const;
     //! \brief return if the expression is constant
     virtual bool isConstant() const = 0;
     /*!
@@ -148,6 +155,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    void compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -176,6 +184,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    void compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -202,6 +211,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    void compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
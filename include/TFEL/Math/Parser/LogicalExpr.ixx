@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -42,6 +43,13 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  void LogicalOperation<Op>::compile(Bytecode& c) const {
+    this->a->compile(c);
+    this->b->compile(c);
+    c.addComparison(&Op::apply);
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -117,6 +125,13 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  void LogicalBinaryOperation<Op>::compile(Bytecode& c) const {
+    this->a->compile(c);
+    this->b->compile(c);
+    c.addLogicalOperation(&Op::apply);
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalBinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -33,7 +33,13 @@ namespace tfel::math::parser {
      * \param[in] e: expression
      */
     PowerFunction(const std::shared_ptr<Expr>) noexcept;
+    /*!
+     * \return the power of the given value
+     * \param[in] x: value
+     */
+    static double evaluate(double);
     double getValue() const override;
+    void compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -66,6 +72,7 @@ namespace tfel::math::parser {
      */
     GeneralPowerFunction(const std::shared_ptr<Expr>, const int) noexcept;
     double getValue() const override;
+    void compile(Bytecode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -24,6 +24,7 @@
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
 #include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 
 namespace tfel::math::parser {
 
@@ -32,19 +33,33 @@ namespace tfel::math::parser {
       : Function(e) {}  // end of PowerFunction
 
   template <int N>
-  double PowerFunction<N>::getValue() const {
-    if constexpr (N == 0) {
-      return 1;
-    }
-    const auto arg = this->expr->getValue();
+  double PowerFunction<N>::evaluate(const double arg) {
     if constexpr (N < 0) {
       if (tfel::math::ieee754::fpclassify(arg) == FP_ZERO) {
         FunctionBase::throwInvalidCallException(arg, EINVAL);
       }
     }
     return tfel::math::power<N>(arg);
+  }  // end of evaluate
+
+  template <int N>
+  double PowerFunction<N>::getValue() const {
+    if constexpr (N == 0) {
+      return 1;
+    }
+    return PowerFunction<N>::evaluate(this->expr->getValue());
   }  // end of getValue
 
+  template <int N>
+  void PowerFunction<N>::compile(Bytecode& b) const {
+    if constexpr (N == 0) {
+      b.addNumber(1);
+    } else {
+      this->expr->compile(b);
+      b.addFunction(&PowerFunction<N>::evaluate);
+    }
+  }  // end of compile
+
   template <int N>
   std::string PowerFunction<N>::getCxxFormula(
       const std::vector<std::string>& m) const {
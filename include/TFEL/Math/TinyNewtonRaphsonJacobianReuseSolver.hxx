@@ -0,0 +1,132 @@
+/*!
+ * \file   include/TFEL/Math/TinyNewtonRaphsonJacobianReuseSolver.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_HXX
+#define LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_HXX
+
+#include <type_traits>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/LU/TinyPermutation.hxx"
+#include "TFEL/Math/NonLinearSolvers/TinyNonLinearSolverBase.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief A class based on the curiously recurring template pattern (CRTP)
+   * to solve system of non linear equations using a modified Newton-Raphson
+   * algorithm which reuses the LU decomposition of the jacobian matrix as
+   * long as the convergence is fast enough.
+   * \tparam N: size of the system of non linear equations.
+   * \tparam NumericType: numeric type.
+   * \tparam Child: base class.
+   *
+   * The jacobian matrix is decomposed at the first iteration. The
+   * decomposition is then reused until the ratio of the norms of two
+   * successive residuals exceeds the `jacobian_reuse_threshold` data member.
+   * In this case, the jacobian matrix computed at the current estimate is
+   * decomposed again.
+   *
+   * By default, the `Child` class must:
+   *
+   * 1. Set the values of `epsilon` and `iterMax` data members and the initial
+   * guess of the unknowns, i.e. by setting the value of the `zeros` data
+   * member.
+   * 2. Provide a method called `computeResidual` which must computes
+   * the residual, i.e. the data member `fzeros` and the jacobian matrix, i.e.
+   * the data member `jacobian` using the current estimate of the solution, i.e.
+   * the data member `zeros`. The jacobian matrix is not used if the current
+   * LU decomposition is reused.
+   */
+  template <unsigned short N, typename NumericType, typename Child>
+  struct TinyNewtonRaphsonJacobianReuseSolver
+      : TinyNonLinearSolverBase<N, NumericType, Child> {
+    //
+    static_assert(N != 0, "invalid size");
+    static_assert(std::is_floating_point_v<NumericType>,
+                  "invalid numeric type");
+    //! \brief a simple alias
+    using iteration_number_type =
+        typename TinyNonLinearSolverBase<N, NumericType,
+                                         Child>::iteration_number_type;
+    //! \brief default constructor
+    TinyNewtonRaphsonJacobianReuseSolver() = default;
+    //! \brief default constructor
+    TinyNewtonRaphsonJacobianReuseSolver(
+        TinyNewtonRaphsonJacobianReuseSolver&) noexcept = default;
+    //! \brief default constructor
+    TinyNewtonRaphsonJacobianReuseSolver(
+        TinyNewtonRaphsonJacobianReuseSolver&&) noexcept = default;
+    //! \brief default constructor
+    TinyNewtonRaphsonJacobianReuseSolver& operator=(
+        TinyNewtonRaphsonJacobianReuseSolver&&) noexcept = default;
+    //! \brief default constructor
+    TinyNewtonRaphsonJacobianReuseSolver& operator=(
+        const TinyNewtonRaphsonJacobianReuseSolver&) noexcept = default;
+    //! \brief destructor
+    ~TinyNewtonRaphsonJacobianReuseSolver() noexcept = default;
+    /*!
+     * \brief this method is called at the beginning of the
+     * `solveNonLinearSystem` method. It resets the statistics of the reuse of
+     * the decomposition of the jacobian matrix.
+     */
+    TFEL_HOST_DEVICE constexpr void
+    executeInitialisationTaskBeforeResolution() noexcept {
+      this->number_of_jacobian_decompositions = 0;
+      this->number_of_jacobian_reuses = 0;
+    }
+    /*!
+     * \brief this method is called at the beginning of the
+     * `solveNonLinearSystem2` method, i.e. also when the resolution restarts
+     * after a failure. The current decomposition of the jacobian matrix is
+     * discarded.
+     */
+    TFEL_HOST_DEVICE constexpr void
+    executeInitialisationTaskBeforeBeginningOfCoreAlgorithm() noexcept {
+      this->is_decomposed_jacobian_defined = false;
+    }
+    /*!
+     * \brief compute the LU decomposition of the jacobian matrix
+     * \return true on success
+     */
+    TFEL_HOST_DEVICE bool decomposeJacobian() noexcept;
+    //! \brief compute a new correction to the unknowns
+    TFEL_HOST_DEVICE bool computeNewCorrection();
+
+   protected:
+    //! \brief jacobian matrix
+    tmatrix<N, N, NumericType> jacobian;
+    //! \brief LU decomposition of the jacobian matrix
+    tmatrix<N, N, NumericType> decomposed_jacobian;
+    //! \brief permutation associated with the LU decomposition
+    TinyPermutation<N> decomposed_jacobian_permutation;
+    /*!
+     * \brief maximum ratio of the norms of two successive residuals
+     * allowing to reuse the LU decomposition of the jacobian matrix.
+     */
+    NumericType jacobian_reuse_threshold = NumericType(1) / 4;
+    //! \brief norm of the residual at the previous iteration
+    NumericType previous_residual_norm = NumericType(0);
+    //! \brief number of decompositions of the jacobian matrix
+    iteration_number_type number_of_jacobian_decompositions = 0;
+    //! \brief number of reuses of the decomposition of the jacobian matrix
+    iteration_number_type number_of_jacobian_reuses = 0;
+    //! \brief boolean stating if `decomposed_jacobian` can be used
+    bool is_decomposed_jacobian_defined = false;
+  };
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/NonLinearSolvers/TinyNewtonRaphsonJacobianReuseSolver.ixx"
+
+#endif /* LIB_TFEL_MATH_TINYNEWTONRAPHSONJACOBIANREUSESOLVER_HXX */
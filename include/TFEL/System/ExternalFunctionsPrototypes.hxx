@@ -69,6 +69,7 @@ typedef double DianaFEARealType;
 #include "MFront/GenericMaterialProperty/MaterialProperty.h"
 #include "MFront/GenericBehaviour/Types.h"
 typedef mfront_gmp_MaterialPropertyPtr GenericMaterialPropertyPtr;
+typedef mfront_gmp_ArrayMaterialPropertyPtr GenericArrayMaterialPropertyPtr;
 
 // forward declaration
 typedef struct mfront_gb_BehaviourData mfront_gb_BehaviourData;
@@ -367,6 +368,9 @@ namespace tfel::system {
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourFctPtr)(
       ::mfront_gb_BehaviourData *const);
   //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR GenericBehaviourIntegrateArrayFctPtr)(
+      int *const, ::mfront_gb_BehaviourData *const, const mfront_gb_size_type);
+  //! \brief a simple alias.
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourInitializeFunctionPtr)(
       ::mfront_gb_BehaviourData *const, const ::mfront_gb_real *const);
   //! \brief a simple alias.
@@ -0,0 +1,198 @@
+/*!
+ * \file   include/TFEL/System/ExternalLibraryIndex.hxx
+ * \brief  This file declares the ExternalLibraryIndex class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_EXTERNALLIBRARYINDEX_HXX
+#define LIB_TFEL_SYSTEM_EXTERNALLIBRARYINDEX_HXX
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <shared_mutex>
+
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+#include <windows.h>
+#ifdef small
+#undef small
+#endif /* small */
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief an index of the symbols of a library loaded by the
+   * `ExternalLibraryManager` class.
+   *
+   * Each symbol is resolved at most once: the address of a symbol (or the
+   * fact that it is not defined) is cached after the first lookup. The
+   * arrays of strings and of integers describing the entry points are
+   * decoded once too. The list of the symbols exported by the library and
+   * the list of the entry points generated by `MFront` are extracted from
+   * the binary file at the first request.
+   *
+   * Since the system is not called when a symbol is found in the cache,
+   * the messages returned by `dlerror` or `GetLastError` are meaningless
+   * after a lookup. The `getLastLookupError` method must be used instead.
+   *
+   * All the methods of this class can be called concurrently.
+   */
+  struct TFELSYSTEM_VISIBILITY_EXPORT ExternalLibraryIndex {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    //! \brief a simple alias
+    using LibraryHandle = HINSTANCE__*;
+#else
+    //! \brief a simple alias
+    using LibraryHandle = void*;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    /*!
+     * \brief constructor
+     * \param[in] h: handle to the library
+     * \param[in] n: name of the library
+     */
+    ExternalLibraryIndex(const LibraryHandle, const std::string&);
+    //! \return the handle to the library
+    LibraryHandle getLibraryHandle() const noexcept;
+    //! \return the name of the library
+    const std::string& getLibraryName() const noexcept;
+    /*!
+     * \return the address of the given symbol or a null pointer if the
+     * symbol is not defined.
+     * \param[in] s: symbol
+     */
+    void* getSymbol(const std::string&) const;
+    /*!
+     * \return the function associated with the given symbol or a null
+     * pointer if the symbol is not defined.
+     * \tparam FunctionPtr: type of the function pointer
+     * \param[in] s: symbol
+     *
+     * \note the returned pointer is stable: the symbol is resolved once.
+     */
+    template <typename FunctionPtr>
+    FunctionPtr getFunction(const std::string& s) const {
+      return reinterpret_cast<FunctionPtr>(this->getSymbol(s));
+    }  // end of getFunction
+    /*!
+     * \return true if the given symbol is defined
+     * \param[in] s: symbol
+     */
+    bool contains(const std::string&) const;
+    /*!
+     * \return the string associated with the given symbol or a null
+     * pointer if the symbol is not defined.
+     * \param[in] s: symbol
+     */
+    const char* getString(const std::string&) const;
+    /*!
+     * \return the value of an unsigned short or -1 if the symbol is not
+     * defined.
+     * \param[in] s: symbol
+     */
+    int getUnsignedShort(const std::string&) const;
+    /*!
+     * \return the value of a boolean (stored as an unsigned short) or -1 if
+     * the symbol is not defined.
+     * \param[in] s: symbol
+     */
+    int getBool(const std::string&) const;
+    /*!
+     * \return the value of an integer or 0 if the symbol is not defined.
+     * \param[in] s: symbol
+     */
+    int getInteger(const std::string&) const;
+    /*!
+     * \return the value of a double or 0 if the symbol is not defined.
+     * \param[in] s: symbol
+     */
+    double getDouble(const std::string&) const;
+    /*!
+     * \return the value of a long double or 0 if the symbol is not defined.
+     * \param[in] s: symbol
+     */
+    long double getLongDouble(const std::string&) const;
+    /*!
+     * \return an array of strings or a null pointer if the symbol is not
+     * defined.
+     * \param[in] s: symbol
+     */
+    const char* const* getArrayOfStrings(const std::string&) const;
+    /*!
+     * \return an array of integers or a null pointer if the symbol is not
+     * defined.
+     * \param[in] s: symbol
+     */
+    const int* getArrayOfInts(const std::string&) const;
+    /*!
+     * \return the array of strings associated with the symbol `s` whose
+     * size is given by the symbol `n`, or a null pointer if one of those
+     * symbols is not defined.
+     * \param[in] n: symbol giving the size of the array
+     * \param[in] s: symbol
+     *
+     * \note the array is decoded once. The returned pointer is stable.
+     */
+    const std::vector<std::string>* getStrings(const std::string&,
+                                               const std::string&) const;
+    /*!
+     * \return the array of integers associated with the symbol `s` whose
+     * size is given by the symbol `n`, or a null pointer if one of those
+     * symbols is not defined.
+     * \param[in] n: symbol giving the size of the array
+     * \param[in] s: symbol
+     *
+     * \note the array is decoded once. The returned pointer is stable.
+     */
+    const std::vector<int>* getInts(const std::string&,
+                                    const std::string&) const;
+    /*!
+     * \return a description of the failure of the last lookup of a symbol
+     * made by the calling thread, or an empty string if this lookup
+     * succeeded.
+     */
+    static std::string getLastLookupError();
+    //! \return the list of the symbols exported by the library
+    const std::vector<std::string>& getSymbols() const;
+    //! \return the list of the entry points generated by `MFront`
+    const std::vector<std::string>& getEntryPoints() const;
+    //! \brief destructor
+    ~ExternalLibraryIndex();
+
+   private:
+    //! \brief extract the symbols and the entry points from the library
+    TFEL_VISIBILITY_LOCAL void readSymbolsTable() const;
+    //! \brief handle to the library
+    const LibraryHandle handle;
+    //! \brief name of the library
+    const std::string name;
+    //! \brief mutex protecting the cache of the symbols
+    mutable std::shared_mutex mutex;
+    //! \brief cache of the addresses of the symbols
+    mutable std::map<std::string, void*, std::less<>> addresses;
+    //! \brief cache of the decoded arrays of strings
+    mutable std::map<std::string, std::vector<std::string>, std::less<>>
+        strings;
+    //! \brief cache of the decoded arrays of integers
+    mutable std::map<std::string, std::vector<int>, std::less<>> ints;
+    //! \brief flag used to read the symbols table only once
+    mutable std::once_flag symbols_flag;
+    //! \brief symbols exported by the library
+    mutable std::vector<std::string> symbols;
+    //! \brief entry points generated by `MFront`
+    mutable std::vector<std::string> entry_points;
+  };  // end of struct ExternalLibraryIndex
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_TFEL_SYSTEM_EXTERNALLIBRARYINDEX_HXX */
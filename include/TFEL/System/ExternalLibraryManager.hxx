@@ -15,8 +15,11 @@
 #define LIB_TFEL_SYSTEM_EXTERNALLIBRARYMANAGER_HXX
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
+#include <cstdint>
+#include <shared_mutex>
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
 #include <windows.h>
@@ -28,12 +31,17 @@
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Material/OutOfBoundsPolicy.hxx"
 #include "TFEL/System/ExternalFunctionsPrototypes.hxx"
+#include "TFEL/System/ExternalLibraryIndex.hxx"
 
 namespace tfel::system {
 
   /*!
    * \brief Structure in charge of loading external function and
    * retrieving information from shared libraries.
+   *
+   * All the methods of this class can be called concurrently. The
+   * functions and the metadata are resolved once per library and per
+   * symbol (see the `ExternalLibraryIndex` class).
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ExternalLibraryManager {
     //! \return the uniq instance of this class
@@ -53,6 +61,12 @@ namespace tfel::system {
 #else
     void* loadLibrary(const std::string&, const bool = false);
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    /*!
+     * \return the index of the symbols of a library
+     * \param[in] l: library name
+     * \note the library is loaded if required
+     */
+    const ExternalLibraryIndex& getLibraryIndex(const std::string&);
        /*!
         * \return the path of a library
         * \param[in] l: library name
@@ -82,6 +96,41 @@ namespace tfel::system {
     void setOutOfBoundsPolicy(const std::string&,
                               const std::string&,
                               const tfel::material::OutOfBoundsPolicy);
+    /*!
+     * \return if the given behaviour has been compiled with profiling
+     * support (see the `@Profiling` keyword)
+     * \param[in] l : name of the library
+     * \param[in] f : name of the behaviour
+     */
+    bool hasProfilingSupport(const std::string&, const std::string&);
+    /*!
+     * \return the names of the code blocks of the given behaviour which
+     * are profiled
+     * \param[in] l : name of the library
+     * \param[in] f : name of the behaviour
+     */
+    std::vector<std::string> getProfilingCodeBlocks(const std::string&,
+                                                    const std::string&);
+    /*!
+     * \brief retrieve the profiling measures of the given behaviour since
+     * the library was loaded or since the last call to the
+     * `resetProfilingMeasures` method. The measures are given for each code
+     * block returned by the `getProfilingCodeBlocks` method.
+     * \param[out] calls : number of calls of each code block
+     * \param[out] times : time spent in each code block (in nanoseconds)
+     * \param[in] l : name of the library
+     * \param[in] f : name of the behaviour
+     */
+    void getProfilingMeasures(std::vector<intmax_t>&,
+                              std::vector<intmax_t>&,
+                              const std::string&,
+                              const std::string&);
+    /*!
+     * \brief reset the profiling measures of the given behaviour
+     * \param[in] l : name of the library
+     * \param[in] f : name of the behaviour
+     */
+    void resetProfilingMeasures(const std::string&, const std::string&);
     /*!
      * \param[in] l : name of the library
      * \param[in] s : name of function or mechanical behaviour
@@ -553,12 +602,42 @@ namespace tfel::system {
      */
     GenericMaterialPropertyPtr getGenericMaterialProperty(const std::string&,
                                                           const std::string&);
+    /*!
+     * \return the function evaluating a generic material property over an
+     * array of points
+     * \param[in] l : name of the library
+     * \param[in] f : law name
+     */
+    GenericArrayMaterialPropertyPtr getGenericArrayMaterialProperty(
+        const std::string&, const std::string&);
     /*!
      * \param[in] l: name of the library
      * \param[in] f: function name
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return the function integrating a behaviour generated through the
+     * `generic` interface over an array of integration points.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    GenericBehaviourIntegrateArrayFctPtr
+    getGenericBehaviourIntegrateArrayFunction(const std::string&,
+                                              const std::string&);
+    /*!
+     * \return the number of values per integration point of the arrays
+     * passed to the function integrating a behaviour generated through the
+     * `generic` interface over an array of integration points. Those
+     * numbers are given in the following order: gradients, thermodynamic
+     * forces, material properties, internal state variables, external
+     * state variables, tangent operator, and number of options stored at
+     * the beginning of the tangent operator.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    std::vector<int> getGenericBehaviourIntegrateArraySizes(
+        const std::string&, const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
@@ -1449,11 +1528,10 @@ namespace tfel::system {
                                             const std::string&,
                                             const std::string&);
 
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    std::map<std::string, HINSTANCE__*> librairies;
-#else
-    std::map<std::string, void*> librairies;
-#endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    //! \brief loaded libraries and the indexes of their symbols
+    std::map<std::string, std::shared_ptr<ExternalLibraryIndex>> librairies;
+    //! \brief mutex protecting the map of the loaded libraries
+    std::shared_mutex mutex;
 
   };  // end of struct LibraryManager
 
@@ -0,0 +1,140 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryData.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATA_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATA_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of reading data in a binary file.
+   *
+   * A binary data file is made of:
+   *
+   * - an header, made of an identifier, the version of the format, a
+   *   marker used to check that the file has been written on a machine
+   *   having the same endianness, the number of columns and the legend
+   *   of each column. The header is padded so that its size is a
+   *   multiple of the size of a double.
+   * - the values, stored as doubles, row by row. The number of rows is
+   *   deduced from the size of the file, an incomplete last row being
+   *   ignored. Rows can thus be appended while the file is written.
+   *
+   * The file is mapped in memory, when supported by the system, or read
+   * in one block otherwise. Columns are accessed without copy through
+   * views whose stride is the number of columns.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryData {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a view on a column
+    struct ColumnView {
+      //! \return the number of values
+      size_type size() const noexcept { return this->nrows; }
+      //! \return the i-th value of the column
+      double operator[](const size_type i) const noexcept {
+        return this->values[i * this->stride];
+      }
+      //! \brief pointer to the first value
+      const double* values;
+      //! \brief number of values
+      size_type nrows;
+      //! \brief distance between two successive values
+      size_type stride;
+    };  // end of struct ColumnView
+    /*!
+     * \brief write the header of a binary data file
+     * \param[in] os: output stream
+     * \param[in] legends: legends of the columns
+     */
+    static void writeHeader(std::ostream&, const std::vector<std::string>&);
+    /*!
+     * \return if the given file starts with the identifier of binary data
+     * files.
+     * \param[in] f: file name
+     */
+    static bool isBinaryDataFile(const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    BinaryData(const std::string&);
+    //! \brief move constructor
+    BinaryData(BinaryData&&) = delete;
+    //! \brief copy constructor
+    BinaryData(const BinaryData&) = delete;
+    //! \brief move assignement
+    BinaryData& operator=(BinaryData&&) = delete;
+    //! \brief standard assignement
+    BinaryData& operator=(const BinaryData&) = delete;
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    //! \return the number of rows
+    size_type getNumberOfRows() const noexcept;
+    //! \return the legends associated with the columns
+    const std::vector<std::string>& getLegends() const noexcept;
+    /*!
+     * \return the legend of the specified column
+     * \param[in] c: column number
+     */
+    const std::string& getLegend(const size_type) const;
+    /*!
+     * \return the column having the specified legend
+     * \param[in] n: legend
+     * \throw std::runtime_error if no column with the specified legend
+     * is found
+     */
+    size_type findColumn(const std::string&) const;
+    /*!
+     * \return a view on the specified column
+     * \param[in] c: column number
+     * \note as for the `TextData` class, the first column is numbered 1.
+     */
+    ColumnView getColumnView(const size_type) const;
+    /*!
+     * \return a copy of the specified column
+     * \param[in] c: column number
+     */
+    std::vector<double> getColumn(const size_type) const;
+    /*!
+     * \return a pointer to the values, stored row by row
+     */
+    const double* data() const noexcept;
+    //! \brief destructor
+    ~BinaryData();
+
+   private:
+    //! \brief legends of the columns
+    std::vector<std::string> legends;
+    //! \brief values, if the file could not be mapped
+    std::vector<double> buffer;
+    //! \brief address of the mapped file
+    void* mapping = nullptr;
+    //! \brief size of the mapped file
+    size_type mapping_size = 0;
+    //! \brief pointer to the first value
+    const double* values = nullptr;
+    //! \brief number of rows
+    size_type nrows = 0;
+  };  // end of struct BinaryData
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATA_HXX */
@@ -0,0 +1,129 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryDataWriter.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX
+
+#include <mutex>
+#include <thread>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <exception>
+#include <condition_variable>
+
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of writing a binary data file (see the
+   * `BinaryData` class for a description of the format).
+   *
+   * Values are appended to a buffer. When this buffer is full, it is
+   * exchanged with a second buffer which is written in the file by a
+   * background thread, so that the computations are not interrupted by
+   * the writing of the file.
+   *
+   * Errors detected by the background thread are reported by the next
+   * call to the `write` or `flush` methods.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryDataWriter {
+    //! \brief a simple alias
+    using size_type = BinaryData::size_type;
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] legends: legends of the columns
+     * \param[in] n: number of rows stored in each buffer
+     */
+    BinaryDataWriter(const std::string&,
+                     const std::vector<std::string>&,
+                     const size_type = 1024);
+    //! \brief move constructor
+    BinaryDataWriter(BinaryDataWriter&&) = delete;
+    //! \brief copy constructor
+    BinaryDataWriter(const BinaryDataWriter&) = delete;
+    //! \brief move assignement
+    BinaryDataWriter& operator=(BinaryDataWriter&&) = delete;
+    //! \brief standard assignement
+    BinaryDataWriter& operator=(const BinaryDataWriter&) = delete;
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    /*!
+     * \brief append a value. Rows are filled one after the other.
+     * \param[in] v: value
+     */
+    void write(const double v) {
+      this->current.push_back(v);
+      if (this->current.size() == this->capacity) {
+        this->exchangeBuffers();
+      }
+    }  // end of write
+    /*!
+     * \brief append values
+     * \param[in] b: iterator to the first value
+     * \param[in] e: iterator past the last value
+     */
+    template <typename InputIterator>
+    void write(InputIterator b, const InputIterator e) {
+      for (; b != e; ++b) {
+        this->write(static_cast<double>(*b));
+      }
+    }  // end of write
+    /*!
+     * \brief write all the values appended so far and flush the file.
+     * This method waits for the background thread.
+     */
+    void flush();
+    //! \brief destructor
+    ~BinaryDataWriter();
+
+   private:
+    /*!
+     * \brief hand the current buffer to the background thread, after
+     * waiting for it to finish writing the previous one.
+     */
+    void exchangeBuffers();
+    //! \brief function executed by the background thread
+    void writeBuffers();
+    //! \brief check if the background thread has reported an error
+    void checkError() const;
+    //! \brief output file
+    std::ofstream file;
+    //! \brief buffer filled by the calling thread
+    std::vector<double> current;
+    //! \brief buffer written by the background thread
+    std::vector<double> pending;
+    //! \brief number of columns
+    size_type ncolumns;
+    //! \brief number of values stored in a buffer
+    size_type capacity;
+    //! \brief mutex protecting the pending buffer and the flags
+    std::mutex m;
+    //! \brief condition variable used to synchronize the threads
+    std::condition_variable cv;
+    //! \brief error reported by the background thread
+    std::exception_ptr error;
+    //! \brief if true, the pending buffer must be written
+    bool has_pending = false;
+    //! \brief if true, the background thread must stop
+    bool stop = false;
+    //! \brief background thread
+    std::thread writer;
+  };  // end of struct BinaryDataWriter
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATAWRITER_HXX */
@@ -17,12 +17,14 @@
 
 #include <map>
 #include <string>
+#include <memory>
 #include <vector>
 #include <iosfwd>
 #include <string_view>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Utilities/Token.hxx"
+#include "TFEL/Utilities/TokenView.hxx"
 #include "TFEL/Utilities/CxxTokenizerOptions.hxx"
 
 namespace tfel::utilities {
@@ -30,6 +32,11 @@ namespace tfel::utilities {
   /*!
    * class in charge of reading a C++-style file and converting it
    * in tokens.
+   *
+   * The input is processed as a single block of memory (files are read
+   * at once). By default, the tokens own their values. If requested by
+   * the `produceTokenViews` method, the tokens are stored as views in an
+   * internal copy of the input, which avoids an allocation per token.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT CxxTokenizer
       : protected CxxTokenizerOptions {
@@ -38,6 +45,8 @@ namespace tfel::utilities {
     //! a simple alias
     using const_iterator = TokensContainer::const_iterator;
     //! a simple alias
+    using TokenViewsContainer = std::vector<TokenView>;
+    //! a simple alias
     using size_type = TokensContainer::size_type;
     /*!
      * \return true if the given string is a valid variable name.
@@ -237,6 +246,20 @@ namespace tfel::utilities {
      * \param[in] s : string to be parsed
      */
     void parseString(const std::string &);
+    /*!
+     * \brief analyse the string given
+     * \param[in] s : string to be parsed
+     * \note if token views are produced, the string is moved in the
+     * internal buffers of the tokenizer rather than copied.
+     */
+    void parseString(std::string &&);
+    /*!
+     * \brief analyse the given string without copying it
+     * \param[in] s : string to be parsed
+     * \note if token views are produced, they directly refer to the given
+     * string, which must outlive them.
+     */
+    void parseStringView(std::string_view);
     /*!
      * \brief import the specified file
      * \param[in] f : file name
@@ -344,6 +367,20 @@ namespace tfel::utilities {
      * \param[in] s: separator
      */
     void addSeparator(const std::string &);
+    /*!
+     * \brief set if the tokens shall be produced as views in an internal
+     * copy of the input rather than owning their values.
+     *
+     * In this mode, the tokens are only available through the
+     * `getTokenViews` method. The `begin`, `end`, `size`, `empty`
+     * methods and the `[]` operator only refer to the imported tokens.
+     *
+     * \param[in] b : boolean
+     * \note this method must be called before parsing the input.
+     */
+    void produceTokenViews(const bool);
+    //! \return the tokens produced as views
+    const TokenViewsContainer &getTokenViews() const;
     //! \return true if the token list is empty
     bool empty() const;
     //! \return an iterator to the first token
@@ -369,61 +406,65 @@ namespace tfel::utilities {
     static bool isValidFunctionIdentifier(const std::string &,
                                           const bool = true);
     /*!
-     * \param[in]     in:   input stream
-     * \param[in,out] n:    line number
-     * \param[in]     from: origin of the stream
+     * \brief split the given buffer in lines and parse them
+     * \param[in]     b: buffer
+     * \param[in,out] n: line number
+     * \param[in]     k: kind of origin of the buffer (file, string)
+     * \param[in]     o: name of the origin of the buffer, used in error
+     * messages
      */
-    virtual void parseStream(std::istream &,
+    virtual void parseBuffer(std::string_view,
                              Token::size_type &,
-                             const std::string &);
+                             const char *const,
+                             std::string_view);
     /*!
      * \param[in] l:    line
      * \param[in] n:    line number
-     * \param[in] from: origin of the stream
      */
-    virtual void splitLine(const std::string &, const Token::size_type);
+    virtual void splitLine(std::string_view, const Token::size_type);
 
     virtual void parseChar(Token::size_type &,
-                           std::string::const_iterator &,
-                           const std::string::const_iterator,
+                           std::string_view::const_iterator &,
+                           const std::string_view::const_iterator,
                            const Token::size_type);
     virtual void parseString(Token::size_type &,
-                             std::string::const_iterator &,
-                             const std::string::const_iterator,
+                             std::string_view::const_iterator &,
+                             const std::string_view::const_iterator,
                              const Token::size_type,
                              const char);
     virtual void parseCComment(Token::size_type &,
-                               std::string::const_iterator &,
-                               const std::string::const_iterator,
+                               std::string_view::const_iterator &,
+                               const std::string_view::const_iterator,
                                const Token::size_type);
     virtual void parseCxxComment(Token::size_type &,
-                                 std::string::const_iterator &,
-                                 const std::string::const_iterator,
+                                 std::string_view::const_iterator &,
+                                 const std::string_view::const_iterator,
                                  const Token::size_type);
     virtual void try_join(Token::size_type &,
-                          std::string::const_iterator &,
-                          const std::string::const_iterator,
+                          std::string_view::const_iterator &,
+                          const std::string_view::const_iterator,
                           const Token::size_type,
                           const char);
     virtual void try_join(Token::size_type &,
-                          std::string::const_iterator &,
-                          const std::string::const_iterator,
+                          std::string_view::const_iterator &,
+                          const std::string_view::const_iterator,
                           const Token::size_type,
                           const char,
                           const char);
     virtual void parseNumber(Token::size_type &,
-                             std::string::const_iterator &,
-                             const std::string::const_iterator,
+                             std::string_view::const_iterator &,
+                             const std::string_view::const_iterator,
                              const Token::size_type);
-    virtual void parsePreprocessorDirective(Token::size_type &,
-                                            std::string::const_iterator &,
-                                            const std::string::const_iterator,
-                                            const std::string::const_iterator,
-                                            const Token::size_type);
+    virtual void parsePreprocessorDirective(
+        Token::size_type &,
+        std::string_view::const_iterator &,
+        const std::string_view::const_iterator,
+        const std::string_view::const_iterator,
+        const Token::size_type);
     virtual void parseStandardLine(Token::size_type &,
-                                   std::string::const_iterator &,
-                                   const std::string::const_iterator,
-                                   const std::string::const_iterator,
+                                   std::string_view::const_iterator &,
+                                   const std::string_view::const_iterator,
+                                   const std::string_view::const_iterator,
                                    const Token::size_type);
     /*!
      * \brief parse a raw string
@@ -433,12 +474,18 @@ namespace tfel::utilities {
      * \param[in,out] n: current line number
      */
     virtual void parseRawString(Token::size_type &,
-                                std::string::const_iterator &,
-                                const std::string::const_iterator,
+                                std::string_view::const_iterator &,
+                                const std::string_view::const_iterator,
                                 const Token::size_type);
     std::vector<std::string> additional_separators;
     //! list of tokens read
     TokensContainer tokens;
+    //! \brief list of tokens read, if token views are produced
+    TokenViewsContainer views;
+    //! \brief copies of the inputs, referred to by the token views
+    std::vector<std::shared_ptr<const std::string>> buffers;
+    //! \brief if true, token views are produced
+    bool tokenViews = false;
     //! store all the comments of a line
     std::map<Token::size_type, std::string> comments;
     /*!
@@ -454,6 +501,35 @@ namespace tfel::utilities {
     //! \brief name of the current delimiter for a raw string
     std::string currentRawStringDelimiter;
 
+   private:
+    /*!
+     * \brief add a new token
+     * \param[in] v: value
+     * \param[in] n: line number
+     * \param[in] o: offset
+     * \param[in] f: flag
+     */
+    void addToken(const std::string_view,
+                  const Token::size_type,
+                  const Token::size_type,
+                  const Token::TokenFlag);
+    //! \return if at least one token has been read
+    bool hasTokens() const;
+    //! \return the flag of the last token
+    Token::TokenFlag getLastTokenFlag() const;
+    //! \return the value of the last token
+    std::string_view getLastTokenValue() const;
+    /*!
+     * \brief change the value of the last token
+     * \param[in] v: value
+     */
+    void setLastTokenValue(std::string);
+    /*!
+     * \brief append a string to the value of the last token
+     * \param[in] s: string
+     */
+    void appendToLastToken(const std::string_view);
+
   };  // end of struct CxxTokenizer
 
 }  // end of namespace tfel::utilities
@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -24,6 +25,16 @@ namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * The file is read in one block and only split in lines by the
+   * constructor. At the first request of a column, the numbers are parsed
+   * directly from the content of the file and stored in a contiguous
+   * array. The lines which can't be handled this way (lines containing
+   * strings, comments, etc.) are treated by the `CxxTokenizer` class when
+   * a column is requested.
+   *
+   * The tokens of each line are only computed if the `begin` or `end`
+   * methods are called.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -90,10 +101,14 @@ namespace tfel::utilities {
     std::string getLegend(const size_type c) const;
     /*!
      * \return an iterator to the first line
+     * \note the lines are tokenized at the first call of this method or of
+     * the `end` method.
      */
     std::vector<Line>::const_iterator begin() const;
     /*!
      * \return an iterator past the last line
+     * \note the lines are tokenized at the first call of this method or of
+     * the `begin` method.
      */
     std::vector<Line>::const_iterator end() const;
     /*!
@@ -112,8 +127,40 @@ namespace tfel::utilities {
     TextData(const TextData&) = delete;
     TextData& operator=(TextData&&) = delete;
     TextData& operator=(const TextData&) = delete;
+    //! \brief description of a line of data
+    struct Row {
+      //! \brief line number
+      size_type line;
+      //! \brief position of the beginning of the line in the buffer
+      std::string::size_type first;
+      //! \brief position of the end of the line in the buffer
+      std::string::size_type last;
+    };  // end of struct Row
+    //! \brief tokenize all the rows, if not already done
+    void tokenizeRows() const;
+    //! \brief parse the numeric values of all the rows, if not already done
+    void parseRows() const;
+    //! \brief content of the file
+    std::string buffer;
+    //! \brief lines of data
+    std::vector<Row> rows;
     //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    mutable std::vector<Line> lines;
+    //! \brief flag used to tokenize the rows only once
+    mutable std::once_flag lines_flag;
+    //! \brief numeric values of all the rows, stored line by line
+    mutable std::vector<double> values;
+    /*!
+     * \brief position of the values of each row in the `values` member:
+     * the values of the i-th row are stored in the range
+     * `[offsets[i], offsets[i+1])`. This range is empty if the row is not
+     * purely numeric.
+     */
+    mutable std::vector<std::vector<double>::size_type> offsets;
+    //! \brief flag stating if a row is purely numeric
+    mutable std::vector<bool> numeric;
+    //! \brief flag used to parse the rows only once
+    mutable std::once_flag values_flag;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
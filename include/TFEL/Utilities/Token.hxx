@@ -45,7 +45,7 @@ namespace tfel::utilities {
      * \param[in] o: offset
      * \param[in] f: token flag
      */
-    Token(const std::string&,
+    Token(std::string,
           const size_type,
           const size_type,
           const TokenFlag = Standard);
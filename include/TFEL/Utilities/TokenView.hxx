@@ -0,0 +1,104 @@
+/*!
+ * \file   include/TFEL/Utilities/TokenView.hxx
+ * \brief  This file declares the TokenView class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_TOKENVIEW_HXX
+#define LIB_TFEL_UTILITIES_TOKENVIEW_HXX
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/Utilities/Token.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class representing a token in a C++-like file as a view in a
+   * buffer owned by the tokenizer which produced it.
+   *
+   * The value of the token is only copied if the token is modified.
+   *
+   * \note a token view must not outlive the buffer it refers to, i.e.
+   * the `CxxTokenizer` object which produced it (or one of its copies).
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT TokenView {
+    //! a simple alias
+    using size_type = Token::size_type;
+    //! a simple alias
+    using TokenFlag = Token::TokenFlag;
+    //! default constructor
+    TokenView();
+    /*!
+     * \brief constructor
+     * \param[in] v: token value
+     * \param[in] l: line number
+     * \param[in] o: offset
+     * \param[in] f: token flag
+     */
+    TokenView(const std::string_view,
+              const size_type,
+              const size_type,
+              const TokenFlag = Token::Standard);
+    //! copy constructor
+    TokenView(const TokenView&);
+    //! move constructor
+    TokenView(TokenView&&);
+    //! assignement
+    TokenView& operator=(const TokenView&);
+    //! move assignement
+    TokenView& operator=(TokenView&&);
+    //! destructor
+    ~TokenView() noexcept;
+    //! \return the value of the token
+    std::string_view value() const noexcept { return this->view; }
+    /*!
+     * \brief change the value of the token. The token then owns its value.
+     * \param[in] v: new value
+     */
+    void setValue(std::string);
+    /*!
+     * \brief append the given string to the value of the token. The token
+     * then owns its value.
+     * \param[in] s: string to be appended
+     */
+    void append(const std::string_view);
+    //! \return if the token owns its value
+    bool ownsValue() const noexcept;
+    //! line number
+    size_type line = 0u;
+    //! offset in the line
+    size_type offset = 0u;
+    //! comment
+    std::string comment;
+    //! type of the token
+    TokenFlag flag = Token::Standard;
+
+   private:
+    /*!
+     * \brief value of the token. If the token owns its value, this view
+     * refers to the `storage` member.
+     */
+    std::string_view view;
+    //! \brief value of the token, if owned
+    std::unique_ptr<std::string> storage;
+  };  // end of struct TokenView
+
+  /*!
+   * \return true if the argument is a comment
+   * \param[in] t: token
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isComment(const TokenView&);
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_TOKENVIEW_HXX */
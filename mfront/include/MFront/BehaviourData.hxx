@@ -143,6 +143,9 @@ namespace mfront {
     static const char* const compareToNumericalJacobian;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
+    //! if this attribute is true, the linear systems arising in the
+    //! implicit algorithm are solved using the block structure of the jacobian
+    static const char* const useJacobianBlockStructure;
     /*!
      * a boolean attribute telling if the additionnal variables can be
      * declared. This attribute is set by DSL's when the first code
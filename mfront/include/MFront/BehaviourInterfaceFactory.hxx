@@ -15,6 +15,7 @@
 #define LIB_MFRONBEHAVIOURTINTERFACEFACTORY_HXX
 
 #include <map>
+#include <mutex>
 #include <memory>
 #include <vector>
 #include <string>
@@ -64,6 +65,8 @@ namespace mfront {
 
     TFEL_VISIBILITY_LOCAL
     AliasContainer& getAliasesMap() const;
+    //! \brief mutex protecting the registries against concurrent accesses
+    mutable std::recursive_mutex mutex;
   };
 
 }  // end of namespace mfront
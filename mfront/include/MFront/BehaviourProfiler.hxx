@@ -25,18 +25,104 @@
 #include "MFront/MFrontConfig.hxx"
 
 #include <array>
+#include <mutex>
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * Each thread accumulates its measures in its own buffers, which
+   * are merged when the results are reported. The results are
+   * written when the profiler is destroyed, i.e. when the calling
+   * process exits. The output is controlled by the following
+   * environment variables:
+   *
+   * - `MFRONT_PROFILING_OUTPUT_FORMAT`: `text` (default), `json` or
+   *   `csv`.
+   * - `MFRONT_PROFILING_OUTPUT_FILE`: file to which the results are
+   *   appended. If not set, the results are written on the standard
+   *   output.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief number of code blocks
+    static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type
+        numberOfCodeBlocks = 23;
+    /*!
+     * \brief number of bins of the histogram of the time spent in a code
+     * block. The bin `i` counts the calls lasting between \f$2^{i}\f$ and
+     * \f$2^{i+1}\f$ nanoseconds. The last bin counts all the longer calls.
+     */
+    static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type
+        numberOfHistogramBins = 32;
+    /*!
+     * \brief maximum number of iterations of the implicit scheme stored in
+     * the iterations histogram. Resolutions requiring more iterations are
+     * counted in the last bin.
+     */
+    static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type
+        maximumNumberOfIterations = 100;
+    //! \brief measures associated with a code block
+    struct CodeBlockMeasures {
+      //! \brief number of calls
+      std::atomic<intmax_t> calls;
+      //! \brief time spent in the code block (nanoseconds)
+      std::atomic<intmax_t> time;
+      //! \brief histogram of the time spent in the code block
+      std::array<std::atomic<intmax_t>, numberOfHistogramBins> histogram;
+    };  // end of struct CodeBlockMeasures
+    /*!
+     * \brief measures of one thread.
+     *
+     * \note those measures are only modified by their thread, but may be
+     * read by other ones. Atomic variables are used to avoid data races,
+     * but no atomic read-modify-write operation is required.
+     */
+    struct ThreadMeasures {
+      //! \brief measures associated with each code block
+      std::array<CodeBlockMeasures, numberOfCodeBlocks> blocks;
+      //! \brief histogram of the number of iterations of the implicit scheme
+      std::array<std::atomic<intmax_t>, maximumNumberOfIterations + 1>
+          iterations;
+      //! \brief number of decompositions of the jacobian matrix
+      std::atomic<intmax_t> jacobianDecompositions;
+      //! \brief number of reuses of the decomposition of the jacobian matrix
+      std::atomic<intmax_t> jacobianReuses;
+    };  // end of struct ThreadMeasures
+    //! \brief merged measures associated with a code block
+    struct CodeBlockSummary {
+      //! \brief number of calls
+      intmax_t calls = 0;
+      //! \brief time spent in the code block (nanoseconds)
+      intmax_t time = 0;
+      //! \brief histogram of the time spent in the code block
+      std::array<intmax_t, numberOfHistogramBins> histogram = {};
+    };  // end of struct CodeBlockSummary
+    //! \brief merged measures of all threads
+    struct Summary {
+      //! \brief measures associated with each code block
+      std::array<CodeBlockSummary, numberOfCodeBlocks> blocks;
+      //! \brief histogram of the number of iterations of the implicit scheme
+      std::array<intmax_t, maximumNumberOfIterations + 1> iterations = {};
+      //! \brief number of decompositions of the jacobian matrix
+      intmax_t jacobianDecompositions = 0;
+      //! \brief number of reuses of the decomposition of the jacobian matrix
+      intmax_t jacobianReuses = 0;
+    };  // end of struct Summary
+    /*!
+     * \return the name of a code block
+     * \param[in] c: code block
+     */
+    static const char* getCodeBlockName(const index_type);
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -55,10 +141,8 @@ namespace mfront {
       Timer(Timer&&) = default;
       Timer& operator=(const Timer&) = delete;
       Timer& operator=(Timer&&) = delete;
-      //! timer to which the results are reported
-      BehaviourProfiler& gtimer;
-      //! code block associated with the timer
-      const index_type c;
+      //! measures of the current thread for the code block
+      CodeBlockMeasures& measures;
 #if !(defined _WIN32 || defined _WIN64)
       //! start
       timespec start;
@@ -137,14 +221,52 @@ namespace mfront {
         APOSTERIORITIMESTEPSCALINGFACTOR = 21;
     //! code block index in the measures array
     static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type TOTALTIME = 22;
+    /*!
+     * \brief report the number of iterations of the implicit scheme
+     * \param[in] n: number of iterations
+     */
+    void addNumberOfIterations(const unsigned int);
+    /*!
+     * \brief report the statistics of the reuse of the decomposition of the
+     * jacobian matrix by the implicit scheme
+     * \param[in] nd: number of decompositions of the jacobian matrix
+     * \param[in] nr: number of reuses of a previous decomposition
+     */
+    void addJacobianReuseStatistics(const unsigned int, const unsigned int);
+    /*!
+     * \return the measures of all threads made since the creation of the
+     * profiler or the last call to the `reset` method.
+     *
+     * \note this method can be called while other threads are being
+     * profiled. In this case, the measures in progress may not be taken
+     * into account.
+     */
+    Summary getSummary();
+    /*!
+     * \brief reset the measures returned by the `getSummary` method.
+     *
+     * \note the measures are not modified, since they are owned by
+     * the profiled threads. The current measures are rather used as the
+     * origin of the following calls to `getSummary`. As a consequence, the
+     * results displayed when the profiler is destroyed are not affected.
+     */
+    void reset();
     //! destructor
     ~BehaviourProfiler();
 
    protected:
+    //! \return the measures of the current thread
+    ThreadMeasures& getThreadMeasures();
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! \brief identifier of the profiler
+    const std::size_t identifier;
+    //! \brief measures of each thread
+    std::vector<std::unique_ptr<ThreadMeasures>> threads;
+    //! \brief measures at the last call to the `reset` method
+    Summary origin;
+    //! \brief mutex protecting the list of measures of each thread
+    std::mutex m;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
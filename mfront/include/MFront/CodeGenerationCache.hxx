@@ -0,0 +1,115 @@
+/*!
+ * \file  mfront/include/MFront/CodeGenerationCache.hxx
+ * \brief This file declares the CodeGenerationCache class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_CODEGENERATIONCACHE_HXX
+#define LIB_MFRONT_CODEGENERATIONCACHE_HXX
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  // forward declaration
+  struct TargetsDescription;
+
+  /*!
+   * \brief a persistent cache of the treatment of the input files.
+   *
+   * An entry is associated with each input file. This entry stores:
+   *
+   * - a key built from the version of `TFEL`, the command line options and
+   *   the content of the input file.
+   * - the files on which the input file depends (imported files, material
+   *   laws, models, etc.) and a hash of their contents.
+   * - the files generated by the treatment of the input file, i.e. the
+   *   sources and the headers declared by the targets description.
+   * - the targets description.
+   *
+   * If the entry is still valid, the analysis of the input file and the
+   * generation of the output files can be skipped altogether.
+   *
+   * Otherwise, the generated files whose content did not change keep their
+   * modification time, so that they are not recompiled by the build system.
+   *
+   * \note the cache is disabled under Windows.
+   */
+  struct MFRONT_VISIBILITY_EXPORT CodeGenerationCache {
+    //! \brief data associated with the generation of the output files
+    struct Generation;
+    /*!
+     * \brief constructor
+     * \param[in] d: directory where the entries are stored
+     */
+    CodeGenerationCache(const std::string & = "src/mfront-cache");
+    /*!
+     * \return if the treatment of the given file can be cached
+     * \param[in] f: input file
+     */
+    static bool isCacheable(const std::string &);
+    /*!
+     * \return the key associated with an input file
+     * \param[in] f: input file
+     * \param[in] o: description of the options affecting the treatment of
+     * the input file
+     */
+    std::string getKey(const std::string &, const std::string &) const;
+    /*!
+     * \return the targets description stored in the entry associated with
+     * the given file if this entry is still valid, a null pointer otherwise.
+     * \param[out] deps: files on which the input file depends. Those files
+     * are appended to this list if the entry is valid.
+     * \param[in] f: input file
+     * \param[in] k: key
+     */
+    std::shared_ptr<TargetsDescription> load(std::vector<std::string> &,
+                                             const std::string &,
+                                             const std::string &) const;
+    /*!
+     * \brief this method must be called before the generation of the output
+     * files associated with the given file.
+     *
+     * The contents and the modification times of the files generated by the
+     * previous treatment of the input file are recorded.
+     *
+     * \return data associated with the generation of the output files
+     * \param[in] f: input file
+     */
+    std::shared_ptr<Generation> startGeneration(const std::string &) const;
+    /*!
+     * \brief this method must be called after the generation of the output
+     * files. A new entry is stored in the cache.
+     *
+     * \param[in] g: data returned by the `startGeneration` method
+     * \param[in] k: key
+     * \param[in] deps: files on which the input file depends
+     * \param[in] t: targets description
+     */
+    void store(Generation &,
+               const std::string &,
+               const std::vector<std::string> &,
+               const TargetsDescription &) const;
+    //! \brief destructor
+    ~CodeGenerationCache();
+
+   private:
+    //! \return the path to the entry associated with the given file
+    std::string getEntryPath(const std::string &) const;
+    //! \brief directory where the entries are stored
+    const std::string directory;
+  };  // end of struct CodeGenerationCache
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_CODEGENERATIONCACHE_HXX */
@@ -17,6 +17,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <mutex>
 #include <memory>
 #include <functional>
 #include "TFEL/Utilities/Data.hxx"
@@ -82,6 +83,8 @@ namespace mfront {
     std::map<std::string, std::vector<std::string>> aliases;
     //! \brief list of descriptions
     std::map<std::string, DescriptionGenerator> descriptions;
+    //! \brief mutex protecting the registries against concurrent accesses
+    mutable std::recursive_mutex mutex;
     //! \brief default constructor
     TFEL_VISIBILITY_LOCAL
     DSLFactory();
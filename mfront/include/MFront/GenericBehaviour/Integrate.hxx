@@ -292,17 +292,44 @@ namespace mfront::gb {
     }
   }  // end of reportFailureByException
 
+  /*!
+   * \brief options of the behaviour integration, decoded from the first
+   * value of the tangent operator (see the description of the `K` member of
+   * the `mfront_gb_BehaviourData` structure).
+   */
+  struct IntegrationOptions {
+    //! \brief if true, the speed of sound must be computed
+    bool compute_speed_of_sound;
+    /*!
+     * \brief type of tangent operator requested, i.e. the first value of
+     * the tangent operator without the request of the speed of sound.
+     */
+    real tangent_operator_type;
+  };  // end of struct IntegrationOptions
+
+  /*!
+   * \return the options of the behaviour integration
+   * \param[in] K: initial values of the tangent operator
+   */
+  inline IntegrationOptions getIntegrationOptions(const real* const K) {
+    const auto bs = K[0] > 50;
+    return {bs, bs ? K[0] - 100 : K[0]};
+  }  // end of getIntegrationOptions
+
   /*!
    * \brief integrate the behaviour over a time step
    * \tparam Behaviour: class implementing the behaviour
    * \param[in,out] d: behaviour data
    * \param[in] f: choice of consistent tangent operator
    * \param[in] p: out of bounds policy
+   * \param[in] o: options of the integration. The first values of the
+   * tangent operator are not read.
    */
   template <typename Behaviour>
   int integrate(mfront_gb_BehaviourData& d,
                 const typename Behaviour::SMFlag f,
-                const tfel::material::OutOfBoundsPolicy p) {
+                const tfel::material::OutOfBoundsPolicy p,
+                const IntegrationOptions& o) {
     using MTraits = tfel::material::MechanicalBehaviourTraits<Behaviour>;
     using IEnergyComputer =
         typename std::conditional<MTraits::hasComputeInternalEnergy,
@@ -324,8 +351,8 @@ namespace mfront::gb {
         return -1;
       }
       b.checkBounds();
-      const auto bs = d.K[0] > 50;
-      const auto Ke = bs ? d.K[0] - 100 : d.K[0];
+      const auto bs = o.compute_speed_of_sound;
+      const auto Ke = o.tangent_operator_type;
       if (Ke < -0.25) {
         if (bs) {
           tfel::math::map<speed>(d.speed_of_sound) =
@@ -393,6 +420,20 @@ namespace mfront::gb {
     return rdt < behaviour_real_type{0.99} ? 0 : 1;
   }  // end of integrate
 
+  /*!
+   * \brief integrate the behaviour over a time step
+   * \tparam Behaviour: class implementing the behaviour
+   * \param[in,out] d: behaviour data
+   * \param[in] f: choice of consistent tangent operator
+   * \param[in] p: out of bounds policy
+   */
+  template <typename Behaviour>
+  int integrate(mfront_gb_BehaviourData& d,
+                const typename Behaviour::SMFlag f,
+                const tfel::material::OutOfBoundsPolicy p) {
+    return integrate<Behaviour>(d, f, p, getIntegrationOptions(d.K));
+  }  // end of integrate
+
   /*!
    * \brief execute the given post-processing
    * \tparam Behaviour: class describing the post-processing.
@@ -0,0 +1,165 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/IntegrateArray.hxx
+ * \brief  This file declares the `integrateArray` function used to integrate
+ * the behaviour over a set of integration points in a single call.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEARRAY_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEARRAY_HXX
+
+#include <array>
+#include <algorithm>
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+namespace mfront::gb {
+
+  /*!
+   * \brief number of values associated with one integration point in each
+   * array of an `mfront_gb_BehaviourData` structure used to integrate the
+   * behaviour over a set of integration points.
+   *
+   * For a given array, the values of the `i`-th integration point start at
+   * the offset `i * n`, where `n` is the number of values of this array per
+   * integration point. The arrays of scalar values (mass density, stored and
+   * dissipated energies, speed of sound) hold one value per integration
+   * point.
+   *
+   * For each modelling hypothesis, the generic interface exports those
+   * numbers, in the order of the members of this structure, as an array of
+   * integers named `<f>_integrateArray_Sizes`, where `<f>` is the name of
+   * the function integrating the behaviour for this hypothesis. The size of
+   * this array is exported by the `<f>_integrateArray_nSizes` symbol. Those
+   * numbers can be retrieved using the
+   * `ExternalLibraryManager::getGenericBehaviourIntegrateArraySizes` method.
+   *
+   * The thermodynamic forces and the tangent operator of each integration
+   * point have the size of the largest stress measure and of the largest
+   * tangent operator supported by the behaviour. In particular, for finite
+   * strain behaviours, those are the sizes of the first Piola-Kirchhoff
+   * stress and of its derivative with respect to the deformation gradient,
+   * whatever the stress measure and the tangent operator selected.
+   */
+  struct BehaviourDataArraySizes {
+    //! \brief number of values of the gradients
+    mfront_gb_size_type gradients;
+    //! \brief number of values of the thermodynamic forces
+    mfront_gb_size_type thermodynamic_forces;
+    //! \brief number of values of the material properties
+    mfront_gb_size_type material_properties;
+    //! \brief number of values of the internal state variables
+    mfront_gb_size_type internal_state_variables;
+    //! \brief number of values of the external state variables
+    mfront_gb_size_type external_state_variables;
+    //! \brief number of values of the tangent operator
+    mfront_gb_size_type tangent_operator;
+    /*!
+     * \brief number of options stored at the beginning of the tangent
+     * operator (at most 3, see the description of the `K` member of the
+     * `mfront_gb_BehaviourData` structure).
+     */
+    mfront_gb_size_type tangent_operator_options;
+  };  // end of struct BehaviourDataArraySizes
+
+  /*!
+   * \return a pointer to the values associated with the i-th integration
+   * point or nullptr if the given pointer is null
+   * \param[in] p: pointer to the values of the first integration point
+   * \param[in] i: index of the integration point
+   * \param[in] s: number of values per integration point
+   */
+  template <typename T>
+  T* getArrayOffset(T* const p,
+                    const mfront_gb_size_type i,
+                    const mfront_gb_size_type s) {
+    if ((p == nullptr) || (s == 0)) {
+      return p;
+    }
+    return p + i * s;
+  }  // end of getArrayOffset
+
+  /*!
+   * \brief integrate the behaviour over a set of integration points.
+   *
+   * Every array of the `mfront_gb_BehaviourData` structure holds the values
+   * of all the integration points, stored contiguously. The options stored
+   * at the beginning of the tangent operator of the first integration point
+   * apply to all integration points. The proposed time step scaling factor
+   * is the minimum over all the integration points. Only the error message
+   * of the first failing integration point is reported.
+   *
+   * \tparam Integrator: type of the callable integrating the behaviour at one
+   * integration point
+   * \param[out] status: status of the behaviour integration for each
+   * integration point
+   * \param[in,out] d: behaviour data
+   * \param[in] n: number of integration points
+   * \param[in] s: number of values per integration point
+   * \param[in] integrator: callable integrating the behaviour at one
+   * integration point
+   * \return the minimal value of the statuses
+   */
+  template <typename Integrator>
+  int integrateArray(int* const status,
+                     mfront_gb_BehaviourData& d,
+                     const mfront_gb_size_type n,
+                     const BehaviourDataArraySizes& s,
+                     const Integrator& integrator) {
+    auto options = std::array<real, 3u>{};
+    const auto nopts = std::min(s.tangent_operator_options,
+                                static_cast<mfront_gb_size_type>(3));
+    std::copy(d.K, d.K + nopts, options.begin());
+    const auto rdt0 = *(d.rdt);
+    auto rdt_min = rdt0;
+    auto r = 1;
+    auto ld = d;
+    for (mfront_gb_size_type i = 0; i != n; ++i) {
+      auto rdt = rdt0;
+      ld.rdt = &rdt;
+      ld.error_message = (r == -1) ? nullptr : d.error_message;
+      ld.K = getArrayOffset(d.K, i, s.tangent_operator);
+      std::copy(options.begin(), options.begin() + nopts, ld.K);
+      ld.speed_of_sound = getArrayOffset(d.speed_of_sound, i, 1);
+      ld.s0.gradients = getArrayOffset(d.s0.gradients, i, s.gradients);
+      ld.s1.gradients = getArrayOffset(d.s1.gradients, i, s.gradients);
+      ld.s0.thermodynamic_forces = getArrayOffset(d.s0.thermodynamic_forces,
+                                                  i, s.thermodynamic_forces);
+      ld.s1.thermodynamic_forces = getArrayOffset(d.s1.thermodynamic_forces,
+                                                  i, s.thermodynamic_forces);
+      ld.s0.mass_density = getArrayOffset(d.s0.mass_density, i, 1);
+      ld.s1.mass_density = getArrayOffset(d.s1.mass_density, i, 1);
+      ld.s0.material_properties = getArrayOffset(d.s0.material_properties, i,
+                                                 s.material_properties);
+      ld.s1.material_properties = getArrayOffset(d.s1.material_properties, i,
+                                                 s.material_properties);
+      ld.s0.internal_state_variables = getArrayOffset(
+          d.s0.internal_state_variables, i, s.internal_state_variables);
+      ld.s1.internal_state_variables = getArrayOffset(
+          d.s1.internal_state_variables, i, s.internal_state_variables);
+      ld.s0.stored_energy = getArrayOffset(d.s0.stored_energy, i, 1);
+      ld.s1.stored_energy = getArrayOffset(d.s1.stored_energy, i, 1);
+      ld.s0.dissipated_energy = getArrayOffset(d.s0.dissipated_energy, i, 1);
+      ld.s1.dissipated_energy = getArrayOffset(d.s1.dissipated_energy, i, 1);
+      ld.s0.external_state_variables = getArrayOffset(
+          d.s0.external_state_variables, i, s.external_state_variables);
+      ld.s1.external_state_variables = getArrayOffset(
+          d.s1.external_state_variables, i, s.external_state_variables);
+      status[i] = integrator(&ld);
+      r = std::min(r, status[i]);
+      rdt_min = std::min(rdt_min, rdt);
+    }
+    *(d.rdt) = rdt_min;
+    return r;
+  }  // end of integrateArray
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEARRAY_HXX */
@@ -36,6 +36,32 @@ typedef mfront_gmp_real(
     const mfront_gmp_size_type,           // number of arguments
     const mfront_gmp_OutOfBoundsPolicy);  // out of bounds policy
 
+/*!
+ * \brief a simple alias to the function evaluating a material property over
+ * an array of points.
+ *
+ * The j-th value of the i-th argument is given by `arguments[i][j * s[i]]`
+ * where `s` denotes the array of strides. A null stride allows to use the
+ * same value for all points.
+ *
+ * The evaluation stops at the first failing point. The output status
+ * summarizes the evaluation: it reports the failure, if any, or the worst
+ * non-negative status otherwise. The outputs of the failing point and of the
+ * following ones are set to `nan`.
+ *
+ * The returned value is the index of the first failing point, or the number
+ * of points if the evaluation succeeded.
+ */
+typedef mfront_gmp_size_type(
+    GENERIC_MATERIALPROPERTY_ADDCALL_PTR mfront_gmp_ArrayMaterialPropertyPtr)(
+    mfront_gmp_OutputStatus* const,       // output status
+    mfront_gmp_real* const,               // outputs
+    const mfront_gmp_size_type,           // number of points
+    const mfront_gmp_real* const* const,  // arguments
+    const mfront_gmp_size_type* const,    // strides of the arguments
+    const mfront_gmp_size_type,           // number of arguments
+    const mfront_gmp_OutOfBoundsPolicy);  // out of bounds policy
+
 #ifdef __cplusplus
 }  // end of extern "C"
 #endif /* __cplusplus */
@@ -35,6 +35,7 @@ namespace mfront {
     std::string getInterfaceNameInCamelCase() const override;
     std::string getInterfaceNameInUpperCase() const override;
     std::string getOutOfBoundsPolicyEnumerationPrefix() const override;
+    bool shallGenerateArrayEvaluationFunction() const override;
   };  // end of GenericMaterialPropertyInterface
 
 }  // end of namespace mfront
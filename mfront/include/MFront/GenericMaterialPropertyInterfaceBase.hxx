@@ -80,6 +80,18 @@ namespace mfront {
     virtual std::string getInterfaceNameInUpperCase() const = 0;
     virtual std::string getOutOfBoundsPolicyEnumerationPrefix() const = 0;
 
+    /*!
+     * \return if a function evaluating the material property over an array
+     * of points shall be generated. By default, this method returns false.
+     */
+    virtual bool shallGenerateArrayEvaluationFunction() const;
+    /*!
+     * \return the name of the function evaluating the material property over
+     * an array of points
+     * \param[in] n: name of the function evaluating the material property
+     */
+    virtual std::string getArrayEvaluationFunctionName(
+        const std::string&) const;
     //! \return the name of the header file
     virtual std::string getHeaderFileName(const std::string&) const;
     //! \return the name of the source file
@@ -98,6 +110,17 @@ namespace mfront {
      */
     virtual void writeSrcFile(const MaterialPropertyDescription&,
                               const FileDescription&) const;
+    /*!
+     * \brief write the function evaluating the material property over an
+     * array of points
+     * \param[out] os: output stream
+     * \param[in] mpd: material property description
+     * \param[in] fd:  mfront file description
+     */
+    virtual void writeArrayEvaluationFunction(
+        std::ostream&,
+        const MaterialPropertyDescription&,
+        const FileDescription&) const;
   };  // end of MfrontGenericMaterialPropertyInterfaceBase
 
 }  // end of namespace mfront
@@ -78,6 +78,21 @@ namespace mfront {
                                   const Hypothesis) const override;
 
     virtual void writeComputeFdF(std::ostream&, const Hypothesis) const;
+    /*!
+     * \brief write the resolution of the linear system using the block
+     * structure of the jacobian, as deduced from the jacobian blocks used in
+     * the `@Integrator` code block.
+     *
+     * The blocks associated with the integration variables are eliminated
+     * in an order chosen to limit the fill-in, so that the last linear
+     * systems to be solved are Schur complements, generally associated with
+     * the elastic strain.
+     *
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeBlockStructuredLinearSystemSolver(std::ostream&,
+                                                        const Hypothesis) const;
 
     void writeBehaviourParserSpecificInheritanceRelationship(
         std::ostream&, const Hypothesis) const override;
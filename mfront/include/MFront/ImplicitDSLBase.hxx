@@ -122,6 +122,8 @@ namespace mfront {
     virtual void treatComputeThermodynamicForces();
     //! \brief treat the `@CompareToNumericalJacobian` keyword
     virtual void treatCompareToNumericalJacobian();
+    //! \brief treat the `@UseJacobianBlockStructure` keyword
+    virtual void treatUseJacobianBlockStructure();
     //! \brief treat the `@JacobianComparisonCriterion` keyword
     virtual void treatJacobianComparisonCriterion();
     //! \brief treat the `@InitJacobian` keyword
@@ -48,6 +48,15 @@ namespace mfront {
      * \return the target's description
      */
     virtual TargetsDescription treatFile(const std::string &) const;
+    /*!
+     * \brief treat all the input files in parallel (see the `--jobs` command
+     * line option). The targets descriptions are merged and the errors are
+     * reported in the order of the input files.
+     * \param[out] errors: list of the files that could not be treated
+     * and of the associated error messages.
+     */
+    virtual void treatFilesInParallel(
+        std::vector<std::pair<std::string, std::string>> &);
     //! \brief execute MFront process
     virtual void exe();
     //! \brief destructor
@@ -83,6 +92,30 @@ namespace mfront {
     virtual void treatNoMelt();
     //! treat the --silent-build command line option
     virtual void treatSilentBuild();
+    /*!
+     * \return the DSL associated with the given file, after the analysis of
+     * this file.
+     * \param[in] f : file name
+     */
+    virtual std::shared_ptr<AbstractDSL> getDSLAndAnalyseFile(
+        const std::string &) const;
+    /*!
+     * \brief analyse a file and generate the output files
+     * \param[in] f : file name
+     * \return the target's description
+     */
+    virtual TargetsDescription analyseFileAndGenerateOutputFiles(
+        const std::string &) const;
+    //! treat the --jobs command line option
+    virtual void treatJobs();
+    //! treat the --cache command line option
+    virtual void treatCache();
+    /*!
+     * \return a description of the command line options affecting the
+     * treatment of the input files. This description is used to build the
+     * keys of the code generation cache.
+     */
+    virtual std::string getCacheOptions() const;
 
     virtual void treatNoDeps();
 
@@ -151,6 +184,10 @@ namespace mfront {
     bool buildLibs = false;
 
     bool cleanLibs = false;
+    //! \brief number of input files treated in parallel
+    unsigned short numberOfJobs = 1;
+    //! \brief boolean stating if the code generation cache shall be used
+    bool useCache = false;
 
   };  // end of class MFront
 
@@ -42,22 +42,35 @@ namespace mfront {
   /*!
    * change the verbose level
    * \param the new verbose level
+   * \note the verbose level is not protected against concurrent
+   * modifications: it must not be changed while input files are treated in
+   * parallel.
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setVerboseMode(
       const VerboseLevel = VERBOSE_LEVEL0);
   /*!
    * \brief change the verbose level
    * \param[in] l: the new verbose level
+   * \note see the note of the previous overload
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setVerboseMode(const std::string&);
   /*!
-   * \return the current logging stream
+   * \return the current logging stream, i.e. the logging stream of the
+   * calling thread if one has been set by `setThreadLocalLogStream`, or the
+   * global logging stream otherwise.
+   *
+   * \note the global logging stream is not protected against concurrent
+   * accesses. When input files are treated in parallel, each task logs in
+   * its own stream (see `setThreadLocalLogStream`) and only the main thread
+   * writes to the global logging stream.
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT std::ostream& getLogStream();
 
   /*!
    * set the current logging stream
    * \param f : file name
+   * \note the global logging stream must not be changed while input files
+   * are treated in parallel.
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(const std::string& f);
 
@@ -66,8 +79,23 @@ namespace mfront {
    * \param os : new logging stream
    * \warning the stream is not handled by this function.
    * The user has to take care of it
+   * \note see the note of the previous overload
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(std::ostream&);
+  /*!
+   * \brief redirect the logging stream of the calling thread.
+   *
+   * This is used when input files are treated in parallel: each thread logs
+   * in its own buffer which is flushed afterwards, in the order of the input
+   * files.
+   *
+   * \param[in] os: new logging stream of the calling thread. If null, the
+   * logging stream of the calling thread is reset to the global one.
+   * \warning the stream is not handled by this function.
+   * The user has to take care of it
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void setThreadLocalLogStream(
+      std::ostream* const);
 
   /*!
    * \brief set if MFront shall use unicode characters on output.
@@ -15,6 +15,7 @@
 #define LIB_MFRONTLAWINTERFACEFACTORY_HXX
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <string>
@@ -80,6 +81,8 @@ namespace mfront {
 
     TFEL_VISIBILITY_LOCAL
     AliasContainer& getAliasesMap() const;
+    //! \brief mutex protecting the registries against concurrent accesses
+    mutable std::recursive_mutex mutex;
   };
 
 }  // end of namespace mfront
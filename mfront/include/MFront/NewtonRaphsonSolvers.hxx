@@ -78,6 +78,33 @@ namespace mfront {
     ~NewtonRaphsonNumericalJacobianSolver() override;
   };
 
+  /*!
+   * \brief a modified Newton-Raphson solver which reuses the LU
+   * decomposition of the jacobian matrix as long as the ratio of the norms of
+   * two successive residuals is lower than a threshold. This threshold is
+   * given by the `@JacobianReuseThreshold` keyword.
+   */
+  struct NewtonRaphsonJacobianReuseSolver : public NewtonRaphsonSolverBase {
+    std::vector<std::string> getSpecificHeaders() const override;
+    void initializeNumericalParameters(std::ostream&,
+                                       const BehaviourDescription&,
+                                       const Hypothesis) const override;
+    std::pair<bool, tokens_iterator> treatSpecificKeywords(
+        BehaviourDescription&,
+        const std::string&,
+        const tokens_iterator,
+        const tokens_iterator) override;
+    void completeVariableDeclaration(BehaviourDescription&) const override;
+    void writeSpecificProfilingStatistics(std::ostream&,
+                                          const BehaviourDescription&,
+                                          const Hypothesis) const override;
+    std::string getExternalAlgorithmClassName(const BehaviourDescription&,
+                                              const Hypothesis) const override;
+    bool requiresNumericalJacobian() const override;
+    //! \brief destructor
+    ~NewtonRaphsonJacobianReuseSolver() override;
+  };
+
   /*!
    * \brief the standard Newton-Raphson Solver coupled with a Powell' dog leg
    * algorithm.
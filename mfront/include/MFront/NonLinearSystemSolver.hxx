@@ -138,6 +138,17 @@ namespace mfront {
     virtual void writeSpecificMembers(std::ostream&,
                                       const BehaviourDescription&,
                                       const Hypothesis) const = 0;
+    /*!
+     * \brief write the code reporting algorithm specific statistics to the
+     * profiler of the behaviour at the end of the resolution. This method is
+     * only called if profiling is enabled.
+     * \param[in] out : output file
+     * \param[in] md  : mechanical description
+     * \param[in] h   : modelling hypotheis
+     */
+    virtual void writeSpecificProfilingStatistics(std::ostream&,
+                                                  const BehaviourDescription&,
+                                                  const Hypothesis) const = 0;
     //! \brief destructor
     virtual ~NonLinearSystemSolver();
 
@@ -111,6 +111,9 @@ namespace mfront {
     void initializeNumericalParameters(std::ostream&,
                                        const BehaviourDescription&,
                                        const Hypothesis) const override;
+    void writeSpecificProfilingStatistics(std::ostream&,
+                                          const BehaviourDescription&,
+                                          const Hypothesis) const override;
 
    protected:
     //! destructor
@@ -15,6 +15,7 @@
 #define LIB_MFRONT_MFRONTSEARCHPATHSHANDLER_HXX
 
 #include <set>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <variant>
@@ -27,6 +28,9 @@ namespace mfront {
    * structure in charge of:
    * - storing search paths
    * - searching imported mfront file
+   *
+   * All the methods of this class are thread-safe, since input files may be
+   * treated concurrently (see the `--jobs` option of `mfront`).
    */
   struct MFRONT_VISIBILITY_EXPORT SearchPathsHandler {
     /*!
@@ -81,6 +85,17 @@ namespace mfront {
         const std::vector<std::string>&);
     //! \return the list of the search paths associated with directories
     static std::vector<std::string> getSearchPaths();
+    /*!
+     * \brief set the list in which the files found by the `search` method
+     * are recorded. This list is specific to the calling thread.
+     *
+     * This is used to retrieve the files on which an input file depends.
+     *
+     * \return the previous list, so that it can be restored afterwards
+     * \param[in] files: list of files. If null, the recording is stopped.
+     */
+    static std::vector<std::string>* setSearchedFilesRecorder(
+        std::vector<std::string>* const);
 
    private:
     //! \brief structure describing a path in a madnex file
@@ -112,10 +127,21 @@ namespace mfront {
     SearchPathsHandler(SearchPathsHandler&&) = delete;
     SearchPathsHandler& operator=(const SearchPathsHandler&) = delete;
     SearchPathsHandler& operator=(SearchPathsHandler&&) = delete;
-    //! \brief return the path to a madnex file
+    /*!
+     * \brief return the path to a madnex file
+     * \pre the mutex `m` must be locked by the caller
+     */
     static std::string searchMadnexFile(const std::string&);
+    /*!
+     * \return the full path of the given file
+     * \param[in] f : file name
+     * \see search for details
+     */
+    static std::string searchFile(const std::string&);
     //! \brief list of search paths
     std::vector<Path> paths;
+    //! \brief mutex protecting the search paths
+    std::mutex m;
   };  // end of struct SearchPathsHandler
 
 }  // namespace mfront
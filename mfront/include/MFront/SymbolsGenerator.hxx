@@ -197,6 +197,18 @@ namespace mfront {
         const StandardBehaviourInterface &,
         const BehaviourDescription &,
         const std::string &) const = 0;
+    /*!
+     * \brief write the functions giving access to the profiling measures,
+     * if profiling is enabled
+     * \param[in] out  : output file
+     * \param[in] i    : standard behaviour interface
+     * \param[in] mb   : behaviour description
+     * \param[in] name : behaviour name
+     */
+    virtual void writeProfilingSymbols(std::ostream &,
+                                       const StandardBehaviourInterface &,
+                                       const BehaviourDescription &,
+                                       const std::string &) const;
     /*!
      * \brief write the symbols associated with the source file
      * \param[in] out  : output file
@@ -93,6 +93,8 @@ namespace mfront {
       "compareToNumericalJacobian";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
+  const char* const BehaviourData::useJacobianBlockStructure =
+      "useJacobianBlockStructure";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
@@ -33,6 +34,7 @@ namespace mfront {
 
   std::vector<std::string> BehaviourInterfaceFactory::getRegistredInterfaces()
       const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto res = std::vector<std::string>{};
     for (const auto& p : this->getInterfaceCreatorsMap()) {
       res.push_back(p.first);
@@ -41,12 +43,14 @@ namespace mfront {
   }
 
   bool BehaviourInterfaceFactory::exists(const std::string& n) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     return this->getAliasesMap().count(n) != 0;
   }  // end of BehaviourInterfaceFactory::exists
 
   void BehaviourInterfaceFactory::registerInterfaceCreator(
       const std::string& i,
       const BehaviourInterfaceFactory::InterfaceCreator f) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(imap.find(i) != imap.end(),
                    "BehaviourInterfaceFactory::registerInterfaceCreator: "
@@ -58,6 +62,7 @@ namespace mfront {
 
   void BehaviourInterfaceFactory::registerInterfaceAlias(const std::string& i,
                                                          const std::string& a) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& amap = this->getAliasesMap();
     tfel::raise_if(amap.find(a) != amap.end(),
                    "BehaviourInterfaceFactory::registerInterfaceAlias: "
@@ -73,6 +78,7 @@ namespace mfront {
 
   std::shared_ptr<AbstractBehaviourInterface>
   BehaviourInterfaceFactory::getInterface(const std::string& n) {
+    std::unique_lock<std::recursive_mutex> lock(this->mutex);
     auto p2 = this->getAliasesMap().find(n);
     if (p2 == this->getAliasesMap().end()) {
       auto msg = std::string(
@@ -89,6 +95,7 @@ namespace mfront {
     const auto p = this->getInterfaceCreatorsMap().find(p2->second);
     assert(p != this->getInterfaceCreatorsMap().end());
     auto c = p->second;
+    lock.unlock();
     return c();
   }
 
@@ -14,6 +14,9 @@
 #include <ctime>
 #include <string>
 #include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -24,14 +27,25 @@
 
 namespace mfront {
 
+  /*!
+   * \brief increment a measure. This function is not atomic as a
+   * measure is only modified by the thread which owns it.
+   * \param[in,out] v: measure
+   * \param[in] d: increment
+   */
+  static inline void increment(std::atomic<intmax_t>& v,
+                               const intmax_t d) noexcept {
+    v.store(v.load(std::memory_order_relaxed) + d, std::memory_order_relaxed);
+  }  // end of increment
+
 #if !(defined _WIN32 || defined _WIN64)
   /*!
    * add a new measure
-   * t     : measure to which the new measure is added
+   * m     : measures to which the new measure is added
    * start : start of the measure
    * end   : end of the measure
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
+  static inline void add_measure(BehaviourProfiler::CodeBlockMeasures& m,
                                  const timespec& start,
                                  const timespec& end) {
     /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
@@ -44,7 +58,17 @@ namespace mfront {
       temp.tv_sec = end.tv_sec - start.tv_sec;
       temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
+    const auto t = intmax_t{1000000000} * temp.tv_sec + temp.tv_nsec;
+    // index of the histogram bin, i.e. the base 2 logarithm of t
+    auto i = BehaviourProfiler::index_type{};
+    for (auto r = t >> 1; (r != 0) &&
+                          (i + 1 != BehaviourProfiler::numberOfHistogramBins);
+         r >>= 1) {
+      ++i;
+    }
+    increment(m.calls, 1);
+    increment(m.time, t);
+    increment(m.histogram[i], 1);
   }  // end of add_measure
 #endif
 
@@ -92,8 +116,8 @@ namespace mfront {
     os << t << "nsecs";
   }  // end pf print
 
-  static std::string getCodeBlockName(const unsigned int c) {
-    auto n = std::string{};
+  const char* BehaviourProfiler::getCodeBlockName(const index_type c) {
+    const char* n = nullptr;
     switch (c) {
       case BehaviourProfiler::FLOWRULE:
         n = "FlowRule";
@@ -166,14 +190,207 @@ namespace mfront {
         break;
       default:
         tfel::raise(
-            "getCodeBlockName : no name associated "
+            "BehaviourProfiler::getCodeBlockName: no name associated "
             "with the given code block");
     }
     return n;
-  }
+  }  // end of getCodeBlockName
+
+  //! \return the name of the given code block
+  static const char* getName(const std::size_t i) {
+    return BehaviourProfiler::getCodeBlockName(
+        static_cast<BehaviourProfiler::index_type>(i));
+  }  // end of getName
+
+  /*!
+   * \brief merge the measures of all threads
+   * \param[in] threads: measures of each thread
+   */
+  static BehaviourProfiler::Summary merge(
+      const std::vector<std::unique_ptr<BehaviourProfiler::ThreadMeasures>>&
+          threads) {
+    auto r = BehaviourProfiler::Summary{};
+    for (const auto& t : threads) {
+      for (std::size_t i = 0; i != r.blocks.size(); ++i) {
+        auto& b = r.blocks[i];
+        const auto& tb = t->blocks[i];
+        b.calls += tb.calls.load(std::memory_order_relaxed);
+        b.time += tb.time.load(std::memory_order_relaxed);
+        for (std::size_t j = 0; j != b.histogram.size(); ++j) {
+          b.histogram[j] += tb.histogram[j].load(std::memory_order_relaxed);
+        }
+      }
+      for (std::size_t j = 0; j != r.iterations.size(); ++j) {
+        r.iterations[j] += t->iterations[j].load(std::memory_order_relaxed);
+      }
+      r.jacobianDecompositions +=
+          t->jacobianDecompositions.load(std::memory_order_relaxed);
+      r.jacobianReuses += t->jacobianReuses.load(std::memory_order_relaxed);
+    }
+    return r;
+  }  // end of merge
+
+  //! \return the total number of resolutions of the implicit scheme
+  static intmax_t getNumberOfResolutions(const BehaviourProfiler::Summary& s) {
+    auto n = intmax_t{};
+    for (const auto c : s.iterations) {
+      n += c;
+    }
+    return n;
+  }  // end of getNumberOfResolutions
+
+  //! \return the lower bound of the given bin of a time histogram
+  static intmax_t getHistogramBinLowerBound(const std::size_t i) {
+    return i == 0 ? 0 : intmax_t{1} << i;
+  }  // end of getHistogramBinLowerBound
+
+  /*!
+   * \brief write the measures in a human readable form
+   * \param[in] os: output stream
+   * \param[in] n: name of the behaviour
+   * \param[in] s: measures
+   */
+  static void writeTextReport(std::ostream& os,
+                              const std::string& n,
+                              const BehaviourProfiler::Summary& s) {
+    os << "\nResults of " << n << " profiling : ";
+    print_time(os, s.blocks.back().time);
+    os << '\n';
+    std::string::size_type w{0};
+    for (std::size_t i = 0; i + 1 != s.blocks.size(); ++i) {
+      if (s.blocks[i].calls != 0) {
+        w = std::max(w, std::strlen(getName(i)));
+      }
+    }
+    for (std::size_t i = 0; i + 1 != s.blocks.size(); ++i) {
+      const auto& b = s.blocks[i];
+      if (b.calls != 0) {
+        os << "- " << std::setw(w) << std::left << getName(i) << " : ";
+        print_time(os, b.time);
+        os << " (" << b.time << " ns, " << b.calls << " calls)\n";
+      }
+    }
+    const auto nr = getNumberOfResolutions(s);
+    if (nr != 0) {
+      auto ni = intmax_t{};
+      for (std::size_t j = 0; j != s.iterations.size(); ++j) {
+        ni += static_cast<intmax_t>(j) * s.iterations[j];
+      }
+      os << "- implicit scheme : " << nr << " resolutions, "
+         << static_cast<double>(ni) / static_cast<double>(nr)
+         << " iterations in average\n";
+    }
+    if (s.jacobianDecompositions + s.jacobianReuses != 0) {
+      os << "- jacobian : " << s.jacobianDecompositions << " decompositions, "
+         << s.jacobianReuses << " reuses\n";
+    }
+    os << std::endl;
+  }  // end of writeTextReport
+
+  /*!
+   * \brief write the measures as a JSON object on a single line
+   * \param[in] os: output stream
+   * \param[in] n: name of the behaviour
+   * \param[in] s: measures
+   */
+  static void writeJSONReport(std::ostream& os,
+                              const std::string& n,
+                              const BehaviourProfiler::Summary& s) {
+    os << "{\"behaviour\": \"" << n << "\", \"code_blocks\": [";
+    auto first = true;
+    for (std::size_t i = 0; i != s.blocks.size(); ++i) {
+      const auto& b = s.blocks[i];
+      if (b.calls == 0) {
+        continue;
+      }
+      if (!first) {
+        os << ", ";
+      }
+      first = false;
+      os << "{\"name\": \"" << getName(i)
+         << "\", \"calls\": " << b.calls << ", \"time\": " << b.time
+         << ", \"histogram\": [";
+      auto first_bin = true;
+      for (std::size_t j = 0; j != b.histogram.size(); ++j) {
+        if (b.histogram[j] == 0) {
+          continue;
+        }
+        if (!first_bin) {
+          os << ", ";
+        }
+        first_bin = false;
+        os << "{\"lower_bound\": " << getHistogramBinLowerBound(j)
+           << ", \"count\": " << b.histogram[j] << "}";
+      }
+      os << "]}";
+    }
+    os << "], \"implicit_scheme\": {\"resolutions\": "
+       << getNumberOfResolutions(s) << ", \"iterations\": [";
+    first = true;
+    for (std::size_t j = 0; j != s.iterations.size(); ++j) {
+      if (s.iterations[j] == 0) {
+        continue;
+      }
+      if (!first) {
+        os << ", ";
+      }
+      first = false;
+      os << "{\"iterations\": " << j << ", \"count\": " << s.iterations[j]
+         << "}";
+    }
+    os << "], \"jacobian_decompositions\": " << s.jacobianDecompositions
+       << ", \"jacobian_reuses\": " << s.jacobianReuses << "}}" << std::endl;
+  }  // end of writeJSONReport
+
+  //! \brief header of the CSV output
+  static const char* const csv_header =
+      "behaviour,code_block,calls,time,bin_lower_bound,bin_count";
+
+  /*!
+   * \brief write the measures in the CSV format, one line per non empty
+   * histogram bin. The implicit scheme is reported as a pseudo code block
+   * named `ImplicitSchemeIterations`, the bins of its histogram being the
+   * numbers of iterations. The statistics of the reuse of the jacobian
+   * matrix, if any, are reported as the pseudo code blocks named
+   * `JacobianDecompositions` and `JacobianReuses`, the number of calls
+   * being the number of decompositions and reuses respectively.
+   * \param[in] os: output stream
+   * \param[in] n: name of the behaviour
+   * \param[in] s: measures
+   */
+  static void writeCSVReport(std::ostream& os,
+                             const std::string& n,
+                             const BehaviourProfiler::Summary& s) {
+    for (std::size_t i = 0; i != s.blocks.size(); ++i) {
+      const auto& b = s.blocks[i];
+      if (b.calls == 0) {
+        continue;
+      }
+      for (std::size_t j = 0; j != b.histogram.size(); ++j) {
+        if (b.histogram[j] != 0) {
+          os << n << ',' << getName(i) << ',' << b.calls << ','
+             << b.time << ',' << getHistogramBinLowerBound(j) << ','
+             << b.histogram[j] << '\n';
+        }
+      }
+    }
+    const auto nr = getNumberOfResolutions(s);
+    for (std::size_t j = 0; j != s.iterations.size(); ++j) {
+      if (s.iterations[j] != 0) {
+        os << n << ",ImplicitSchemeIterations," << nr << ",," << j << ','
+           << s.iterations[j] << '\n';
+      }
+    }
+    if (s.jacobianDecompositions + s.jacobianReuses != 0) {
+      os << n << ",JacobianDecompositions," << s.jacobianDecompositions
+         << ",,,\n"
+         << n << ",JacobianReuses," << s.jacobianReuses << ",,,\n";
+    }
+    os.flush();
+  }  // end of writeCSVReport
 
   BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
-      : gtimer(t), c(cn) {
+      : measures(t.getThreadMeasures().blocks[cn]) {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->start));
 #endif
@@ -182,34 +399,130 @@ namespace mfront {
   BehaviourProfiler::Timer::~Timer() {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
+    add_measure(this->measures, this->start, this->end);
+#else
+    increment(this->measures.calls, 1);
 #endif
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  /*!
+   * \return a new identifier for a profiler. Identifiers are never
+   * reused, so that the measures of a destroyed profiler cached by a
+   * thread can't be mistaken for the ones of a new profiler.
+   */
+  static std::size_t getNewProfilerIdentifier() {
+    static std::atomic<std::size_t> i{0};
+    return i++;
+  }  // end of getNewProfilerIdentifier
+
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n), identifier(getNewProfilerIdentifier()) {
   }  // end of BehaviourProfiler::BehaviourProfiler
 
-  BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
-    std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
-    std::cout << '\n';
-    std::string::size_type w{0};
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
-        w = std::max(w, getCodeBlockName(i).size());
+  BehaviourProfiler::ThreadMeasures& BehaviourProfiler::getThreadMeasures() {
+    struct CachedMeasures {
+      //! \brief identifier of the profiler
+      std::size_t identifier;
+      //! \brief measures of the current thread
+      ThreadMeasures* measures;
+    };
+    // measures of the current thread for all the profilers used so far.
+    // The number of profilers being small, a linear search is used.
+    thread_local std::vector<CachedMeasures> cache;
+    for (const auto& c : cache) {
+      if (c.identifier == this->identifier) {
+        return *(c.measures);
       }
     }
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
-        std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
-                  << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->threads.push_back(std::make_unique<ThreadMeasures>());
+    auto& tm = *(this->threads.back());
+    cache.push_back({this->identifier, &tm});
+    return tm;
+  }  // end of getThreadMeasures
+
+  BehaviourProfiler::Summary BehaviourProfiler::getSummary() {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    auto r = merge(this->threads);
+    for (std::size_t i = 0; i != r.blocks.size(); ++i) {
+      auto& b = r.blocks[i];
+      const auto& o = this->origin.blocks[i];
+      b.calls -= o.calls;
+      b.time -= o.time;
+      for (std::size_t j = 0; j != b.histogram.size(); ++j) {
+        b.histogram[j] -= o.histogram[j];
       }
     }
-    std::cout << std::endl;
+    for (std::size_t j = 0; j != r.iterations.size(); ++j) {
+      r.iterations[j] -= this->origin.iterations[j];
+    }
+    r.jacobianDecompositions -= this->origin.jacobianDecompositions;
+    r.jacobianReuses -= this->origin.jacobianReuses;
+    return r;
+  }  // end of getSummary
+
+  void BehaviourProfiler::reset() {
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->origin = merge(this->threads);
+  }  // end of reset
+
+  void BehaviourProfiler::addNumberOfIterations(const unsigned int n) {
+    auto& tm = this->getThreadMeasures();
+    constexpr auto nmax = static_cast<unsigned int>(
+        BehaviourProfiler::maximumNumberOfIterations);
+    const auto i = std::min(n, nmax);
+    increment(tm.iterations[i], 1);
+  }  // end of addNumberOfIterations
+
+  void BehaviourProfiler::addJacobianReuseStatistics(const unsigned int nd,
+                                                     const unsigned int nr) {
+    auto& tm = this->getThreadMeasures();
+    increment(tm.jacobianDecompositions, nd);
+    increment(tm.jacobianReuses, nr);
+  }  // end of addJacobianReuseStatistics
+
+  BehaviourProfiler::~BehaviourProfiler() {
+    const auto s = [this] {
+      auto lock = std::lock_guard<std::mutex>{this->m};
+      return merge(this->threads);
+    }();
+    const auto* const f = std::getenv("MFRONT_PROFILING_OUTPUT_FORMAT");
+    const auto format = std::string{f == nullptr ? "text" : f};
+    if ((format != "text") && (format != "json") && (format != "csv")) {
+      std::cerr << "BehaviourProfiler: unsupported output format '" << format
+                << "', using the text format\n";
+    }
+    // report
+    auto write = [&format, &s, this](std::ostream& os, const bool header) {
+      if (format == "json") {
+        writeJSONReport(os, this->name, s);
+      } else if (format == "csv") {
+        if (header) {
+          os << csv_header << '\n';
+        }
+        writeCSVReport(os, this->name, s);
+      } else {
+        writeTextReport(os, this->name, s);
+      }
+    };
+    // several profilers may be destroyed by different threads
+    static std::mutex output_mutex;
+    auto lock = std::lock_guard<std::mutex>{output_mutex};
+    const auto* const file = std::getenv("MFRONT_PROFILING_OUTPUT_FILE");
+    if (file == nullptr) {
+      write(std::cout, true);
+      return;
+    }
+    std::ofstream out(file, std::ios::app);
+    if (!out) {
+      std::cerr << "BehaviourProfiler: can't open file '" << file
+                << "', writing the profiling results of '" << this->name
+                << "' on the standard output\n";
+      write(std::cout, true);
+      return;
+    }
+    out.seekp(0, std::ios::end);
+    write(out, out.tellp() == std::streampos(0));
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
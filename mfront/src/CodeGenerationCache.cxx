@@ -0,0 +1,303 @@
+/*!
+ * \file  mfront/src/CodeGenerationCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <map>
+#include <set>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
+
+#if !(defined _WIN32 || defined _WIN64)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/TargetsDescription.hxx"
+#include "MFront/CodeGenerationCache.hxx"
+
+namespace mfront {
+
+  /*!
+   * \return the 64-bits FNV-1a hash of the given string as an hexadecimal
+   * number
+   * \param[in] s: string
+   */
+  static std::string hash(const std::string& s) {
+    auto h = std::uint64_t{14695981039346656037u};
+    for (const auto c : s) {
+      h ^= static_cast<unsigned char>(c);
+      h *= std::uint64_t{1099511628211u};
+    }
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx",
+                  static_cast<unsigned long long>(h));
+    return buffer;
+  }  // end of hash
+
+  /*!
+   * \return the content of the given file
+   * \param[in] f: file
+   */
+  static std::string readFile(const std::string& f) {
+    std::ifstream file(f, std::ios::binary);
+    tfel::raise_if(!file, "CodeGenerationCache: can't open file '" + f + "'");
+    return std::string(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+  }  // end of readFile
+
+#if !(defined _WIN32 || defined _WIN64)
+
+  //! \brief access and modification times of a file
+  struct FileTimes {
+    //! \brief last access time
+    struct timespec atime;
+    //! \brief last modification time
+    struct timespec mtime;
+  };
+
+  /*!
+   * \return the times of the given file
+   * \param[out] t: times
+   * \param[in] f: file
+   */
+  static bool getFileTimes(FileTimes& t, const std::string& f) {
+    struct stat buf;
+    if ((::stat(f.c_str(), &buf) != 0) || (!S_ISREG(buf.st_mode))) {
+      return false;
+    }
+    t = FileTimes{buf.st_atim, buf.st_mtim};
+    return true;
+  }  // end of getFileTimes
+
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
+  struct CodeGenerationCache::Generation {
+    //! \brief input file
+    std::string file;
+#if !(defined _WIN32 || defined _WIN64)
+    //! \brief files generated by the previous treatment of the input file
+    std::map<std::string, std::pair<std::string, FileTimes>> outputs;
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  };  // end of struct CodeGenerationCache::Generation
+
+  //! \brief content of an entry of the cache
+  struct CodeGenerationCacheEntry {
+    //! \brief key
+    std::string key;
+    //! \brief dependencies and hashes of their contents
+    std::vector<std::pair<std::string, std::string>> dependencies;
+    //! \brief generated files
+    std::vector<std::string> outputs;
+    //! \brief targets description
+    std::string targets;
+  };  // end of struct CodeGenerationCacheEntry
+
+  /*!
+   * \brief read an entry of the cache.
+   * \return true on success
+   * \param[out] e: entry
+   * \param[in] f: path to the entry
+   */
+  static bool readCodeGenerationCacheEntry(CodeGenerationCacheEntry& e,
+                                           const std::string& f) {
+    std::ifstream file(f);
+    if (!file) {
+      return false;
+    }
+    auto line = std::string{};
+    while (std::getline(file, line)) {
+      const auto pos = line.find(' ');
+      const auto tag = line.substr(0, pos);
+      const auto value =
+          pos == std::string::npos ? std::string{} : line.substr(pos + 1);
+      if (tag == "key") {
+        e.key = value;
+      } else if (tag == "dependency") {
+        const auto pos2 = value.find(' ');
+        if (pos2 == std::string::npos) {
+          return false;
+        }
+        e.dependencies.push_back(
+            {value.substr(pos2 + 1), value.substr(0, pos2)});
+      } else if (tag == "output") {
+        e.outputs.push_back(value);
+      } else if (tag == "targets") {
+        e.targets.assign(std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>());
+        return !e.key.empty();
+      } else {
+        return false;
+      }
+    }
+    return false;
+  }  // end of readCodeGenerationCacheEntry
+
+  CodeGenerationCache::CodeGenerationCache(const std::string& d)
+      : directory(d) {}  // end of CodeGenerationCache
+
+  bool CodeGenerationCache::isCacheable(const std::string& f) {
+#if !(defined _WIN32 || defined _WIN64)
+    using tfel::utilities::starts_with;
+    return !((starts_with(f, "madnex:")) || (starts_with(f, "mdnx:")) ||
+             (starts_with(f, "edf:")));
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    static_cast<void>(f);
+    return false;
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  }  // end of isCacheable
+
+  std::string CodeGenerationCache::getEntryPath(const std::string& f) const {
+    return this->directory + '/' + hash(f) + ".lst";
+  }  // end of getEntryPath
+
+  std::string CodeGenerationCache::getKey(const std::string& f,
+                                          const std::string& o) const {
+    return hash(std::string{::getTFELVersion()} + '\n' + o + '\n' + f + '\n' +
+                readFile(f));
+  }  // end of getKey
+
+  std::shared_ptr<TargetsDescription> CodeGenerationCache::load(
+      std::vector<std::string>& deps,
+      const std::string& f,
+      const std::string& k) const {
+    try {
+      auto e = CodeGenerationCacheEntry{};
+      if (!readCodeGenerationCacheEntry(e, this->getEntryPath(f))) {
+        return {};
+      }
+      if (e.key != k) {
+        return {};
+      }
+      for (const auto& d : e.dependencies) {
+        if (hash(readFile(d.first)) != d.second) {
+          return {};
+        }
+      }
+      for (const auto& o : e.outputs) {
+        if (!std::ifstream(o)) {
+          return {};
+        }
+      }
+      auto tokenizer = tfel::utilities::CxxTokenizer{};
+      tokenizer.parseString(e.targets);
+      auto c = tokenizer.begin();
+      auto t = std::make_shared<TargetsDescription>(
+          read<TargetsDescription>(c, tokenizer.end()));
+      for (const auto& d : e.dependencies) {
+        deps.push_back(d.first);
+      }
+      return t;
+    } catch (std::exception&) {
+    }
+    return {};
+  }  // end of load
+
+  std::shared_ptr<CodeGenerationCache::Generation>
+  CodeGenerationCache::startGeneration(const std::string& f) const {
+    auto g = std::make_shared<Generation>();
+    g->file = f;
+#if !(defined _WIN32 || defined _WIN64)
+    auto e = CodeGenerationCacheEntry{};
+    if (readCodeGenerationCacheEntry(e, this->getEntryPath(f))) {
+      for (const auto& o : e.outputs) {
+        auto t = FileTimes{};
+        if (getFileTimes(t, o)) {
+          try {
+            g->outputs[o] = {readFile(o), t};
+          } catch (std::exception&) {
+          }
+        }
+      }
+    }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    return g;
+  }  // end of startGeneration
+
+  void CodeGenerationCache::store(Generation& g,
+                                  const std::string& k,
+                                  const std::vector<std::string>& deps,
+                                  const TargetsDescription& t) const {
+#if !(defined _WIN32 || defined _WIN64)
+    const auto path = this->getEntryPath(g.file);
+    std::remove(path.c_str());
+    // generated files, as declared by the targets description
+    auto outputs = std::set<std::string>{};
+    auto add_output = [&outputs](const std::string& o) {
+      auto ft = FileTimes{};
+      if (getFileTimes(ft, o)) {
+        outputs.insert(o);
+      }
+    };
+    for (const auto& l : t.libraries) {
+      for (const auto& src : l.sources) {
+        add_output("src/" + src);
+      }
+    }
+    for (const auto& h : t.headers) {
+      add_output("include/" + h);
+    }
+    // restoring the times of the files whose content did not change
+    for (const auto& o : outputs) {
+      const auto p = g.outputs.find(o);
+      if (p == g.outputs.end()) {
+        continue;
+      }
+      try {
+        if (readFile(o) == p->second.first) {
+          const struct timespec ts[2] = {p->second.second.atime,
+                                         p->second.second.mtime};
+          ::utimensat(AT_FDCWD, o.c_str(), ts, 0);
+        }
+      } catch (std::exception&) {
+      }
+    }
+    // writing the new entry
+    auto os = std::ostringstream{};
+    os << "key " << k << '\n';
+    try {
+      for (const auto& d : deps) {
+        os << "dependency " << hash(readFile(d)) << ' ' << d << '\n';
+      }
+    } catch (std::exception&) {
+      // a dependency can't be read (madnex file for instance), the entry
+      // would never be valid
+      return;
+    }
+    for (const auto& o : outputs) {
+      os << "output " << o << '\n';
+    }
+    os << "targets\n" << t;
+    tfel::system::systemCall::mkdir(this->directory);
+    std::ofstream file(path);
+    if (file) {
+      file << os.str();
+    }
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    static_cast<void>(g);
+    static_cast<void>(k);
+    static_cast<void>(deps);
+    static_cast<void>(t);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  }  // end of store
+
+  CodeGenerationCache::~CodeGenerationCache() = default;
+
+}  // end of namespace mfront
@@ -13,6 +13,7 @@
 
 #include <vector>
 #include <string>
+#include <mutex>
 #include <utility>
 #include <iterator>
 #include <stdexcept>
@@ -32,6 +33,7 @@ namespace mfront {
   DSLFactory::DSLFactory() = default;
 
   std::vector<std::string> DSLFactory::getRegistredDSLs(const bool b) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto res = std::vector<std::string>{};
     for (const auto& p : this->generators) {
       res.push_back(p.first);
@@ -49,6 +51,7 @@ namespace mfront {
   void DSLFactory::registerDSLCreator(const std::string& n,
                                       const DSLGenerator f,
                                       const DescriptionGenerator f2) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto raise = [&n] {
       tfel::raise("DSLFactory::registerDSLCreator: a DSL named '" + n +
                   "' has already been registred");
@@ -69,6 +72,7 @@ namespace mfront {
 
   void DSLFactory::registerDSLAlias(const std::string& n,
                                     const std::string& a) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto raise = [](const std::string& m) {
       tfel::raise("DSLFactory::registerAlias: " + m);
     };
@@ -89,6 +93,7 @@ namespace mfront {
 
   std::shared_ptr<AbstractDSL> DSLFactory::createNewDSL(
       const std::string& n, const AbstractDSL::DSLOptions& opts) const {
+    std::unique_lock<std::recursive_mutex> lock(this->mutex);
     const auto rn = [this, &n]() -> const std::string& {
       for (const auto& as : this->aliases) {
         if (std::find(as.second.cbegin(), as.second.cend(), n) !=
@@ -110,6 +115,7 @@ namespace mfront {
       tfel::raise(msg);
     }
     auto c = p->second;
+    lock.unlock();
     return c(opts);
   }  // end of createNewDSL
 
@@ -119,6 +125,7 @@ namespace mfront {
   }  // end of createNewParser
 
   std::string DSLFactory::getDSLDescription(const std::string& n) const {
+    std::unique_lock<std::recursive_mutex> lock(this->mutex);
     const auto rn = [this, &n]() -> const std::string& {
       for (const auto& as : this->aliases) {
         if (std::find(as.second.cbegin(), as.second.cend(), n) !=
@@ -136,6 +143,7 @@ namespace mfront {
           n + "'");
     }
     auto c = p->second;
+    lock.unlock();
     return c();
   }  // end of getDSLDescription
 
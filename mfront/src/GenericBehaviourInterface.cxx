@@ -973,6 +973,98 @@ namespace mfront {
     }
   }  // end of writeRotationFunctionsImplementations
 
+  /*!
+   * \return the number of values per integration point of the gradients,
+   * the thermodynamic forces, the material properties, the internal state
+   * variables, the external state variables, the tangent operator and the
+   * number of options stored at the beginning of the tangent operator, in
+   * the order of the members of the `mfront::gb::BehaviourDataArraySizes`
+   * structure.
+   * \param[in] i: generic behaviour interface
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  static std::vector<int> getBehaviourDataArraySizes(
+      const GenericBehaviourInterface& i,
+      const BehaviourDescription& bd,
+      const tfel::material::ModellingHypothesis::Hypothesis h) {
+    using size_type = size_t;
+    const auto is_finite_strain =
+        (bd.getBehaviourType() ==
+         BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) ||
+        ((bd.getBehaviourType() ==
+          BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
+         (bd.isStrainMeasureDefined()) &&
+         (bd.getStrainMeasure() != BehaviourDescription::LINEARISED));
+    const auto& d = bd.getBehaviourData(h);
+    auto get_size = [h](const SupportedTypes::TypeSize& s) {
+      return static_cast<size_type>(s.getValueForModellingHypothesis(h));
+    };
+    auto gsize = size_type{};
+    auto thsize = size_type{};
+    auto tob_size = size_type{};
+    auto nopts = size_type{1};
+    if (is_finite_strain) {
+      const auto tsize = tfel::material::getTensorSize(h);
+      gsize = tsize;
+      // the first Piola-Kirchhoff stress is the largest stress measure
+      // supported
+      thsize = tsize;
+      // the derivative of the first Piola-Kirchhoff stress with respect to
+      // the deformation gradient is the largest tangent operator supported
+      tob_size = tsize * tsize;
+      nopts = 3;
+    } else {
+      for (const auto& mv : bd.getMainVariables()) {
+        gsize += get_size(
+            SupportedTypes::getTypeSize(mv.first.type, mv.first.arraySize));
+        thsize += get_size(
+            SupportedTypes::getTypeSize(mv.second.type, mv.second.arraySize));
+      }
+      for (const auto& to : bd.getTangentOperatorBlocks()) {
+        const auto& v1 = to.first;
+        const auto& v2 = to.second;
+        tob_size +=
+            get_size(SupportedTypes::getTypeSize(v1.type, v1.arraySize)) *
+            get_size(SupportedTypes::getTypeSize(v2.type, v2.arraySize));
+      }
+      tob_size = std::max(tob_size, nopts);
+    }
+    const auto mpsize = [&i, &bd, h, &get_size] {
+      const auto mprops = i.buildMaterialPropertiesList(bd, h);
+      if (mprops.first.empty()) {
+        return size_type{};
+      }
+      const auto& last = mprops.first.back();
+      auto s = last.offset;
+      s += SupportedTypes::getTypeSize(last.type, last.arraySize);
+      return get_size(s);
+    }();
+    const auto ivsize = get_size(d.getPersistentVariables().getTypeSize());
+    const auto esvsize = get_size(d.getExternalStateVariables().getTypeSize());
+    auto sizes = std::vector<int>{};
+    for (const auto s : {gsize, thsize, mpsize, ivsize, esvsize, tob_size,
+                         nopts}) {
+      sizes.push_back(static_cast<int>(s));
+    }
+    return sizes;
+  }  // end of getBehaviourDataArraySizes
+
+  /*!
+   * \return the initializer of a `mfront::gb::BehaviourDataArraySizes`
+   * structure describing the number of values per integration point
+   * \param[in] sizes: number of values per integration point
+   */
+  static std::string getBehaviourDataArraySizesInitializer(
+      const std::vector<int>& sizes) {
+    auto r = std::string{"mfront::gb::BehaviourDataArraySizes{"};
+    for (decltype(sizes.size()) i = 0; i != sizes.size(); ++i) {
+      r += (i == 0) ? "" : ", ";
+      r += std::to_string(sizes[i]);
+    }
+    return r + "}";
+  }  // end of getBehaviourDataArraySizesInitializer
+
   std::string GenericBehaviourInterface::getName() {
     return "generic";
   }  // end of getName
@@ -1116,6 +1208,22 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate the behaviour over an array of integration"
+          << " points\n"
+          << " * \\param[out] status: status of the behaviour integration for"
+          << " each integration point\n"
+          << " * \\param[in,out] d: material data. Each array holds the values"
+          << " of all the integration points\n"
+          << " * \\param[in] s: number of integration points\n"
+          << " * \\return the minimal value of the statuses\n"
+          << " * \\note the number of values per integration point of each"
+          << " array is given by the `" << f << "_integrateArray_Sizes`"
+          << " symbol\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f << "_integrateArray("
+          << "int* const, mfront_gb_BehaviourData* const, "
+          << "const mfront_gb_size_type);\n\n";
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1184,7 +1292,8 @@ namespace mfront {
             "unsupported behaviour type for MTest file generation");
       }
     }
-    out << "#include\"MFront/GenericBehaviour/GenericBehaviourTraits.hxx\"\n";
+    out << "#include\"MFront/GenericBehaviour/GenericBehaviourTraits.hxx\"\n"
+        << "#include\"MFront/GenericBehaviour/IntegrateArray.hxx\"\n";
     // behaviour integration
     if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
         (type == BehaviourDescription::COHESIVEZONEMODEL)) {
@@ -1347,66 +1456,121 @@ namespace mfront {
         out << "return r;\n"
             << "}\n\n";
       }
-      // behaviour integration
-      out << "MFRONT_SHAREDOBJ int " << f
-          << "(mfront_gb_BehaviourData* const d){\n"
-          << "using namespace tfel::material;\n";
-      out << "using real = mfront::gb::real;\n"
-          << "constexpr auto h = ModellingHypothesis::"
-          << ModellingHypothesis::toUpperCaseString(h) << ";\n";
-      if (bd.useQt()) {
-        out << "using Behaviour = " << bd.getClassName() << "<h,real,true>;\n";
-      } else {
-        out << "using Behaviour = " << bd.getClassName() << "<h,real,false>;\n";
-      }
-      if (bd.getAttribute(BehaviourData::profiling, false)) {
-        out << "using mfront::BehaviourProfiler;\n"
-            << "using tfel::material::" << bd.getClassName() << "Profiler;\n"
-            << "BehaviourProfiler::Timer total_timer(" << bd.getClassName()
-            << "Profiler::getProfiler(),\n"
-            << "BehaviourProfiler::TOTALTIME);\n";
-      }
-      if (this->shallGenerateMTestFileOnFailure(bd)) {
-        out << "using mfront::SupportedTypes;\n";
-      }
-      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
-          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
-        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-            << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-            << "_getOutOfBoundsPolicy());\n";
-      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-        if (is_finite_strain_through_strain_measure) {
-          const auto ms = bd.getStrainMeasure();
-          if (ms == BehaviourDescription::GREENLAGRANGE) {
-            out << "const auto r = "
-                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else if (ms == BehaviourDescription::HENCKY) {
-            out << "const auto r = "
-                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
+      auto write_behaviour_alias = [&out, &bd, h] {
+        out << "using namespace tfel::material;\n";
+        out << "using real = mfront::gb::real;\n"
+            << "constexpr auto h = ModellingHypothesis::"
+            << ModellingHypothesis::toUpperCaseString(h) << ";\n";
+        if (bd.useQt()) {
+          out << "using Behaviour = " << bd.getClassName()
+              << "<h,real,true>;\n";
+        } else {
+          out << "using Behaviour = " << bd.getClassName()
+              << "<h,real,false>;\n";
+        }
+      };
+      // the options of the integration can only be decoded once by the
+      // caller when the behaviour is directly integrated by the
+      // `mfront::gb::integrate` function. Otherwise, they are decoded by
+      // the functions handling the strain and stress measures.
+      const auto decode_integration_options =
+          (type == BehaviourDescription::GENERALBEHAVIOUR) ||
+          (type == BehaviourDescription::COHESIVEZONEMODEL) ||
+          ((type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
+           (!is_finite_strain_through_strain_measure));
+      // write the integration of the behaviour at one integration point
+      // using the given out of bounds policy and, if not empty, the given
+      // options of the integration
+      auto write_integration = [this, &out, &bd, &raise, h, type,
+                                is_finite_strain_through_strain_measure](
+                                   const std::string& policy,
+                                   const std::string& options) {
+        const auto args = options.empty() ? policy : policy + ", " + options;
+        if (bd.getAttribute(BehaviourData::profiling, false)) {
+          out << "using mfront::BehaviourProfiler;\n"
+              << "using tfel::material::" << bd.getClassName()
+              << "Profiler;\n"
+              << "BehaviourProfiler::Timer total_timer(" << bd.getClassName()
+              << "Profiler::getProfiler(),\n"
+              << "BehaviourProfiler::TOTALTIME);\n";
+        }
+        if (this->shallGenerateMTestFileOnFailure(bd)) {
+          out << "using mfront::SupportedTypes;\n";
+        }
+        if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
+            (type == BehaviourDescription::COHESIVEZONEMODEL)) {
+          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
+              << "Behaviour::STANDARDTANGENTOPERATOR, " << args << ");\n";
+        } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
+          if (is_finite_strain_through_strain_measure) {
+            const auto ms = bd.getStrainMeasure();
+            if (ms == BehaviourDescription::GREENLAGRANGE) {
+              out << "const auto r = "
+                  << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
+                  << "*d, " << policy << ");\n";
+            } else if (ms == BehaviourDescription::HENCKY) {
+              out << "const auto r = "
+                  << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
+                  << "*d, " << policy << ");\n";
+            } else {
+              raise("unsupported strain measure");
+            }
           } else {
-            raise("unsupported strain measure");
+            out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
+                << "Behaviour::STANDARDTANGENTOPERATOR, " << args << ");\n";
           }
+        } else if (type ==
+                   BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
+          out << "const auto r = "
+              << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
+              << policy << ");\n";
         } else {
-          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-              << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-              << "_getOutOfBoundsPolicy());\n";
+          raise("unsupported behaviour type");
         }
-      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-        out << "const auto r = "
-            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
-            << name << "_getOutOfBoundsPolicy());\n";
+        if (this->shallGenerateMTestFileOnFailure(bd)) {
+          out << "if(r!=1){\n";
+          this->generateMTestFile(out, bd, h);
+          out << "}\n";
+        }
+        out << "return r;\n";
+      };
+      // behaviour integration
+      out << "MFRONT_SHAREDOBJ int " << f
+          << "(mfront_gb_BehaviourData* const d){\n";
+      write_behaviour_alias();
+      write_integration(name + "_getOutOfBoundsPolicy()", "");
+      out << "} // end of " << f << "\n\n";
+      // behaviour integration over an array of integration points. The
+      // modelling hypothesis, the out of bounds policy and the options of
+      // the integration are only resolved once. The number of values per
+      // integration point of each array is exported, so that the calling
+      // solver can allocate those arrays.
+      const auto sizes = getBehaviourDataArraySizes(*this, bd, h);
+      exportUnsignedShortSymbol(out, f + "_integrateArray_nSizes",
+                                static_cast<unsigned short>(sizes.size()));
+      exportArrayOfIntegersSymbol(out, f + "_integrateArray_Sizes", sizes);
+      out << "MFRONT_SHAREDOBJ int " << f << "_integrateArray("
+          << "int* const status, mfront_gb_BehaviourData* const data, "
+          << "const mfront_gb_size_type s){\n";
+      write_behaviour_alias();
+      out << "const auto policy = " << name << "_getOutOfBoundsPolicy();\n"
+          << "constexpr auto sizes = "
+          << getBehaviourDataArraySizesInitializer(sizes) << ";\n";
+      if (decode_integration_options) {
+        out << "const auto options = "
+            << "mfront::gb::getIntegrationOptions(data->K);\n"
+            << "const auto integrator = [policy, &options]"
+            << "(mfront_gb_BehaviourData* const d) -> int {\n";
       } else {
-        raise("unsupported behaviour type");
-      }
-      if (this->shallGenerateMTestFileOnFailure(bd)) {
-        out << "if(r!=1){\n";
-        this->generateMTestFile(out, bd, h);
-        out << "}\n";
+        out << "const auto integrator = "
+            << "[policy](mfront_gb_BehaviourData* const d) -> int {\n";
       }
-      out << "return r;\n"
-          << "} // end of " << f << "\n\n";
+      write_integration("policy",
+                        decode_integration_options ? "options" : "");
+      out << "};\n"
+          << "return mfront::gb::integrateArray(status, *data, s, sizes, "
+          << "integrator);\n"
+          << "} // end of " << f << "_integrateArray\n\n";
     }
     // postprocessings
     for (const auto h : mhs) {
@@ -56,6 +56,11 @@ namespace mfront {
     return "GENERIC_MATERIALPROPERTY";
   }  // end of getOutOfBoundsPolicyEnumerationPrefix
 
+  bool GenericMaterialPropertyInterface::shallGenerateArrayEvaluationFunction()
+      const {
+    return true;
+  }  // end of shallGenerateArrayEvaluationFunction
+
   GenericMaterialPropertyInterface::~GenericMaterialPropertyInterface() =
       default;
 
@@ -92,6 +92,16 @@ namespace mfront {
     return material + "_" + className;
   }
 
+  bool GenericMaterialPropertyInterfaceBase::
+      shallGenerateArrayEvaluationFunction() const {
+    return false;
+  }  // end of shallGenerateArrayEvaluationFunction
+
+  std::string GenericMaterialPropertyInterfaceBase::
+      getArrayEvaluationFunctionName(const std::string& name) const {
+    return name + "_evaluateArray";
+  }  // end of getArrayEvaluationFunctionName
+
   std::string GenericMaterialPropertyInterfaceBase::getHeaderFileName(
       const std::string& name) const {
     const auto i = this->getInterfaceName();
@@ -234,6 +244,127 @@ namespace mfront {
     }
   }  // end of writeBounds
 
+  /*!
+   * \brief write the checks of the physical bounds of a variable in the
+   * function evaluating the material property over an array of points. The
+   * variable is assumed to be defined in the body of a loop over the points.
+   * \param[out] os: output stream
+   * \param[in] v: variable
+   * \param[in] i: rank of the variable
+   * \param[in] useQuantities: boolean stating if quantities are used
+   */
+  static void writeArrayPhysicalBounds(std::ostream& os,
+                                       const VariableDescription& v,
+                                       const size_t i,
+                                       const bool useQuantities) {
+    if (!v.hasPhysicalBounds()) {
+      return;
+    }
+    const auto& b = v.getPhysicalBounds();
+    const auto to_string = useQuantities
+                               ? "std::to_string(" + v.name + ".getValue())"
+                               : "std::to_string(" + v.name + ")";
+    auto report = [&os, &v, &to_string](const char* const where,
+                                        const char* const op,
+                                        const long double value) {
+      os << "mfront_report(\"" << v.name << " is " << where
+         << " its physical bound (\" + " << to_string << " + \"" << op << value
+         << ") for point \" + std::to_string(mfront_idx) + \".\\n\");\n";
+    };
+    if (b.boundsType == VariableBoundsDescription::LOWER) {
+      os << "if(" << v.name << " < " << v.type << "(" << b.lowerBound
+         << ")){\n";
+      report("below", "<", b.lowerBound);
+    } else if (b.boundsType == VariableBoundsDescription::UPPER) {
+      os << "if(" << v.name << " > " << v.type << "(" << b.upperBound
+         << ")){\n";
+      report("over", ">", b.upperBound);
+    } else {
+      os << "if((" << v.name << " < " << v.type << "(" << b.lowerBound << "))||"
+         << "(" << v.name << " > " << v.type << "(" << b.upperBound << "))){\n"
+         << "if(" << v.name << " < " << v.type << "(" << b.lowerBound
+         << ")){\n";
+      report("below", "<", b.lowerBound);
+      os << "} else {\n";
+      report("over", ">", b.upperBound);
+      os << "}\n";
+    }
+    os << "mfront_output_status->status = -1;\n"
+       << "mfront_output_status->bounds_status = -" << i << ";\n"
+       << "mfront_failure_index = mfront_idx;\n"
+       << "break;\n"
+       << "}\n";
+  }  // end of writeArrayPhysicalBounds
+
+  /*!
+   * \brief write the checks of the standard bounds of a variable in the
+   * function evaluating the material property over an array of points. The
+   * variable is assumed to be defined in the body of a loop over the points
+   * and the out of bounds policy is assumed to be either the strict policy or
+   * the warning policy.
+   * \param[out] os: output stream
+   * \param[in] prefix: prefix of the out of bounds policy enumeration
+   * \param[in] v: variable
+   * \param[in] i: rank of the variable
+   * \param[in] useQuantities: boolean stating if quantities are used
+   */
+  static void writeArrayBounds(std::ostream& os,
+                               const std::string& prefix,
+                               const VariableDescription& v,
+                               const size_t i,
+                               const bool useQuantities) {
+    if (!v.hasBounds()) {
+      return;
+    }
+    const auto to_string = useQuantities
+                               ? "std::to_string(" + v.name + ".getValue())"
+                               : "std::to_string(" + v.name + ")";
+    const auto& b = v.getBounds();
+    auto report = [&os, &v, &to_string](const char* const where,
+                                        const char* const op,
+                                        const long double value) {
+      os << "mfront_report(\"" << v.name << " is " << where
+         << " its bound (\" + " << to_string << " + \"" << op << value
+         << ") for point \" + std::to_string(mfront_idx) + \".\\n\");\n";
+    };
+    auto treat = [&os, &prefix, &report, i](const char* const where,
+                                            const char* const op,
+                                            const long double value) {
+      os << "if(mfront_out_of_bounds_policy==" << prefix
+         << "_STRICT_POLICY){\n";
+      report(where, op, value);
+      os << "mfront_output_status->status = -1;\n"
+         << "mfront_output_status->bounds_status = -" << i << ";\n"
+         << "mfront_failure_index = mfront_idx;\n"
+         << "break;\n"
+         << "}\n"
+         << "if(mfront_output_status->status == 0){\n";
+      report(where, op, value);
+      os << "mfront_output_status->status = 1;\n"
+         << "mfront_output_status->bounds_status = " << i << ";\n"
+         << "}\n";
+    };
+    if (b.boundsType == VariableBoundsDescription::LOWER) {
+      os << "if(" << v.name << " < " << v.type << "(" << b.lowerBound
+         << ")){\n";
+      treat("below", "<", b.lowerBound);
+      os << "}\n";
+    } else if (b.boundsType == VariableBoundsDescription::UPPER) {
+      os << "if(" << v.name << " > " << v.type << "(" << b.upperBound
+         << ")){\n";
+      treat("over", ">", b.upperBound);
+      os << "}\n";
+    } else {
+      os << "if(" << v.name << " < " << v.type << "(" << b.lowerBound
+         << ")){\n";
+      treat("below", "<", b.lowerBound);
+      os << "} else if(" << v.name << " > " << v.type << "(" << b.upperBound
+         << ")){\n";
+      treat("over", ">", b.upperBound);
+      os << "}\n";
+    }
+  }  // end of writeArrayBounds
+
   void GenericMaterialPropertyInterfaceBase::writeOutputFiles(
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     this->writeHeaderFile(mpd, fd);
@@ -285,6 +416,17 @@ namespace mfront {
        << "const " << types.real_type << "* const,"
        << "const " << types.integer_type << ","
        << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    if (this->shallGenerateArrayEvaluationFunction()) {
+      os << "MFRONT_SHAREDOBJ " << types.integer_type << "\n"
+         << this->getArrayEvaluationFunctionName(name) << "("
+         << types.output_status_type << "* const," << types.real_type
+         << "* const,"
+         << "const " << types.integer_type << ","
+         << "const " << types.real_type << "* const* const,"
+         << "const " << types.integer_type << "* const,"
+         << "const " << types.integer_type << ","
+         << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    }
     if (!mpd.parameters.empty()) {
       os << "MFRONT_SHAREDOBJ int\n"
          << name << "_setParameter(const char *const,"
@@ -416,7 +558,7 @@ namespace mfront {
       }
     }
     os << ")\n{\n";
-    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, types.real_type, true);
     os << "auto mfront_report = "
        << "[&mfront_output_status](const std::string& "
        << "mfront_error_message){\n"
@@ -531,13 +673,224 @@ namespace mfront {
     } else {
       os << "return " << mpd.output.name << ";\n";
     }
-    os << "} // end of " << name << "\n\n"
-       << "#ifdef __cplusplus\n"
+    os << "} // end of " << name << "\n\n";
+    if (this->shallGenerateArrayEvaluationFunction()) {
+      this->writeArrayEvaluationFunction(os, mpd, fd);
+    }
+    os << "#ifdef __cplusplus\n"
        << "} // end of extern \"C\"\n"
        << "#endif /* __cplusplus */\n\n";
     os.close();
   }  // end of writeSrcFile()
 
+  void GenericMaterialPropertyInterfaceBase::writeArrayEvaluationFunction(
+      std::ostream& os,
+      const MaterialPropertyDescription& mpd,
+      const FileDescription& fd) const {
+    const auto types = this->getTypesDescription();
+    const auto iucname = this->getInterfaceNameInUpperCase();
+    const auto iname = this->getInterfaceName();
+    const auto prefix = this->getOutOfBoundsPolicyEnumerationPrefix();
+    const auto name = this->getFunctionName(mpd);
+    const auto fname = this->getArrayEvaluationFunctionName(name);
+    const auto& params = mpd.parameters;
+    const auto has_input_bounds =
+        (hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs));
+    const auto has_output_bounds =
+        (mpd.output.hasPhysicalBounds()) || (mpd.output.hasBounds());
+    const auto has_bounds = hasBounds(mpd.inputs) || mpd.output.hasBounds();
+    // declare the arguments of the current point
+    auto write_inputs = [&os, &mpd] {
+      auto i = size_t{};
+      for (const auto& v : mpd.inputs) {
+        auto cast_start = useQuantities(mpd) ? v.type + "(" : "";
+        auto cast_end = useQuantities(mpd) ? ")" : "";
+        os << "const auto " << v.name << " = " << cast_start
+           << "mfront_arguments[" << i << "][mfront_idx * mfront_strides[" << i
+           << "]]" << cast_end << ";\n";
+        ++i;
+      }
+    };
+    os << "MFRONT_SHAREDOBJ " << types.integer_type << "\n"
+       << fname << "(" << types.output_status_type
+       << "* const mfront_output_status,\n"
+       << types.real_type << "* const mfront_outputs,\n"
+       << "const " << types.integer_type << " mfront_n,\n";
+    if (!mpd.inputs.empty()) {
+      os << "const " << types.real_type
+         << "* const* const mfront_arguments,\n"
+         << "const " << types.integer_type << "* const mfront_strides,\n";
+    } else {
+      os << "const " << types.real_type << "* const* const,\n"
+         << "const " << types.integer_type << "* const,\n";
+    }
+    os << "const " << types.integer_type << " mfront_nargs,\n";
+    if (has_bounds) {
+      os << "const " << types.out_of_bounds_policy_type
+         << " mfront_out_of_bounds_policy";
+    } else {
+      os << "const " << types.out_of_bounds_policy_type;
+    }
+    os << ")\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, types.real_type, true);
+    os << "auto mfront_report = "
+       << "[&mfront_output_status](const std::string& "
+       << "mfront_error_message){\n"
+       << "if(mfront_error_message.empty()){\n"
+       << "return;\n"
+       << "}\n"
+       << "std::strncpy(mfront_output_status->msg,"
+       << "mfront_error_message.c_str(),511);\n"
+       << "mfront_output_status->msg[511]='\\0';\n"
+       << "};\n"
+       << "auto mfront_failure = [mfront_outputs, mfront_n]("
+       << "const " << types.integer_type << " mfront_failure_index){\n"
+       << "std::fill(mfront_outputs + mfront_failure_index, "
+       << "mfront_outputs + mfront_n, std::nan(\"\"));\n"
+       << "return mfront_failure_index;\n"
+       << "};\n";
+    os << "const int mfront_errno_old = errno;\n"
+       << "mfront_output_status->status = 0;\n"
+       << "mfront_output_status->bounds_status = 0;\n"
+       << "mfront_output_status->c_error_number = 0;\n"
+       << "errno = 0;\n";
+    // check number of arguments
+    os << "if(mfront_nargs!= " << mpd.inputs.size() << "){\n"
+       << "mfront_output_status->status = -5;\n"
+       << "mfront_report(\"invalid number of arguments "
+       << "(\"+std::to_string(mfront_nargs)+\" given, " << mpd.inputs.size()
+       << " expected)\");\n"
+       << "errno = mfront_errno_old;\n"
+       << "return mfront_failure(0);\n"
+       << "}\n";
+    // parameters
+    if ((!areParametersTreatedAsStaticVariables(mpd)) && (!params.empty())) {
+      const auto hn = getMaterialPropertyParametersHandlerClassName(name);
+      os << "if(!" << iname << "::" << hn << "::get" << hn << "().ok){\n"
+         << "mfront_output_status->status = -6;\n"
+         << "mfront_report(" << iname << "::" << name
+         << "MaterialPropertyHandler::get" << name
+         << "MaterialPropertyHandler().msg);\n"
+         << "errno = mfront_errno_old;\n"
+         << "return mfront_failure(0);\n"
+         << "}\n";
+    }
+    writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
+    if ((!areParametersTreatedAsStaticVariables(mpd)) && (!params.empty())) {
+      // the initialisation of the parameters, which is done at the first
+      // call, may have modified errno, e.g. when looking for a file
+      // defining the values of the parameters
+      os << "errno = 0;\n";
+    }
+    os << "auto mfront_failure_index = mfront_n;\n";
+    // bounds checks on the inputs, performed before the evaluation so that
+    // the loop evaluating the material property is free of branches
+    if (has_input_bounds) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+      if (hasPhysicalBounds(mpd.inputs)) {
+        os << "// treating physical bounds\n"
+           << "for(" << types.integer_type << " mfront_idx = 0; "
+           << "mfront_idx != mfront_failure_index; ++mfront_idx){\n";
+        write_inputs();
+        for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+          writeArrayPhysicalBounds(os, mpd.inputs[i], i + 1,
+                                   useQuantities(mpd));
+        }
+        os << "}\n";
+      }
+      if (hasBounds(mpd.inputs)) {
+        os << "// treating standard bounds\n"
+           << "if(mfront_out_of_bounds_policy != " << prefix
+           << "_NONE_POLICY){\n"
+           << "for(" << types.integer_type << " mfront_idx = 0; "
+           << "mfront_idx != mfront_failure_index; ++mfront_idx){\n";
+        write_inputs();
+        for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+          writeArrayBounds(os, prefix, mpd.inputs[i], i + 1,
+                           useQuantities(mpd));
+        }
+        os << "}\n"
+           << "}\n";
+      }
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+    }
+    // evaluation
+    os << "auto mfront_idx = " << types.integer_type << "{};\n"
+       << "try{\n"
+       << "for(; mfront_idx != mfront_failure_index; ++mfront_idx){\n";
+    write_inputs();
+    os << "auto " << mpd.output.name << " = " << mpd.output.type << "{};\n"
+       << mpd.f.body << '\n';
+    if (useQuantities(mpd)) {
+      os << "mfront_outputs[mfront_idx] = " << mpd.output.name
+         << ".getValue();\n";
+    } else {
+      os << "mfront_outputs[mfront_idx] = " << mpd.output.name << ";\n";
+    }
+    os << "}\n"
+       << "} catch(std::exception& e){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(e.what());\n"
+       << "errno = mfront_errno_old;\n"
+       << "return mfront_failure(mfront_idx);\n"
+       << "} catch(...){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(\"unknown C++ exception\");\n"
+       << "errno = mfront_errno_old;\n"
+       << "return mfront_failure(mfront_idx);\n"
+       << "}\n"
+       << "// errors reported by the C library can't be associated with a\n"
+       << "// specific point\n"
+       << "if (errno != 0) {\n"
+       << "mfront_output_status->status = -3;\n"
+       << "mfront_output_status->c_error_number = errno;\n"
+       << "mfront_report(strerror(errno));\n"
+       << "errno = mfront_errno_old;\n"
+       << "return mfront_failure(0);\n"
+       << "}\n"
+       << "errno = mfront_errno_old;\n";
+    // checks on the outputs
+    os << "for(mfront_idx = 0; mfront_idx != mfront_failure_index; "
+       << "++mfront_idx){\n";
+    if (useQuantities(mpd)) {
+      os << "const auto " << mpd.output.name << " = " << mpd.output.type
+         << "(mfront_outputs[mfront_idx]);\n"
+         << "if(!tfel::math::ieee754::isfinite(" << mpd.output.name
+         << ".getValue())){\n";
+    } else {
+      os << "const auto " << mpd.output.name
+         << " = mfront_outputs[mfront_idx];\n"
+         << "if(!tfel::math::ieee754::isfinite(" << mpd.output.name
+         << ")){\n";
+    }
+    os << "mfront_output_status->status = -4;\n"
+       << "mfront_report(\"invalid value for point \" + "
+       << "std::to_string(mfront_idx));\n"
+       << "mfront_failure_index = mfront_idx;\n"
+       << "break;\n"
+       << "}\n";
+    if (has_output_bounds) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+      if (mpd.output.hasPhysicalBounds()) {
+        os << "// treating physical bounds\n";
+        writeArrayPhysicalBounds(os, mpd.output, mpd.inputs.size() + 1,
+                                 useQuantities(mpd));
+      }
+      if (mpd.output.hasBounds()) {
+        os << "// treating bounds\n"
+           << "if(mfront_out_of_bounds_policy != " << prefix
+           << "_NONE_POLICY){\n";
+        writeArrayBounds(os, prefix, mpd.output, mpd.inputs.size() + 1,
+                         useQuantities(mpd));
+        os << "}\n";
+      }
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+    }
+    os << "}\n"
+       << "return mfront_failure(mfront_failure_index);\n"
+       << "} // end of " << fname << "\n\n";
+  }  // end of writeArrayEvaluationFunction
+
   GenericMaterialPropertyInterfaceBase::
       ~GenericMaterialPropertyInterfaceBase() = default;
 
@@ -11,8 +11,12 @@
  * project under specific licensing conditions.
  */
 
+#include <cctype>
+#include <vector>
 #include <ostream>
 #include <sstream>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Glossary/Glossary.hxx"
 #include "TFEL/Glossary/GlossaryEntry.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -24,6 +28,7 @@
 #include "MFront/SupportedTypes.hxx"
 #include "MFront/NonLinearSystemSolverBase.hxx"
 #include "MFront/NonLinearSystemSolver.hxx"
+#include "MFront/NewtonRaphsonSolvers.hxx"
 #include "MFront/ImplicitCodeGeneratorBase.hxx"
 
 namespace mfront {
@@ -1082,7 +1087,15 @@ namespace mfront {
                                              BehaviourData::Integrator);
     }
     this->solver.initializeNumericalParameters(os, this->bd, h);
-    os << "if(!this->solveNonLinearSystem()){\n";
+    if (this->bd.getAttribute(BehaviourData::profiling, false)) {
+      os << "const auto mfront_converged = this->solveNonLinearSystem();\n"
+         << this->bd.getClassName()
+         << "Profiler::getProfiler().addNumberOfIterations(this->iter);\n";
+      this->solver.writeSpecificProfilingStatistics(os, this->bd, h);
+      os << "if(!mfront_converged){\n";
+    } else {
+      os << "if(!this->solveNonLinearSystem()){\n";
+    }
     if (this->bd.useQt()) {
       os << "return MechanicalBehaviour<" << btype
          << ",hypothesis, NumericType, use_qt>::FAILURE;\n";
@@ -1349,9 +1362,14 @@ namespace mfront {
       writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
                                              "TinyMatrixSolve", "lu");
     }
-    os << "mfront_success = "
-       << this->solver.getExternalAlgorithmClassName(this->bd, h)
-       << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    if (this->bd.getAttribute(h, BehaviourData::useJacobianBlockStructure,
+                              false)) {
+      this->writeBlockStructuredLinearSystemSolver(os, h);
+    } else {
+      os << "mfront_success = "
+         << this->solver.getExternalAlgorithmClassName(this->bd, h)
+         << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    }
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
     }
@@ -1360,6 +1378,291 @@ namespace mfront {
     this->writeComputeFdF(os, h);
   }  // end of writeBehaviourIntegrator
 
+  /*!
+   * \return true if the given code contains the given identifier
+   * \param[in] c: code
+   * \param[in] w: identifier
+   */
+  static bool containsIdentifier(const std::string& c, const std::string& w) {
+    const auto is_identifier_character = [](const char ch) {
+      return (std::isalnum(static_cast<unsigned char>(ch)) != 0) ||
+             (ch == '_');
+    };
+    auto p = c.find(w);
+    while (p != std::string::npos) {
+      const auto pe = p + w.size();
+      if (((p == 0) || (!is_identifier_character(c[p - 1]))) &&
+          ((pe == c.size()) || (!is_identifier_character(c[pe])))) {
+        return true;
+      }
+      p = c.find(w, pe);
+    }
+    return false;
+  }  // end of containsIdentifier
+
+  /*!
+   * \brief compute the order in which the blocks of the jacobian are
+   * eliminated. At each step, the block which creates the lowest number of
+   * new non zero blocks is selected. Ties are broken by selecting the
+   * smallest block first.
+   * \return the elimination order
+   * \param[in,out] nz: structure of the jacobian. On output, the blocks
+   * filled during the elimination are marked as non zero.
+   * \param[in] sizes: sizes of the blocks
+   */
+  static std::vector<std::size_t> getJacobianBlocksEliminationOrder(
+      std::vector<std::vector<bool>>& nz, const std::vector<int>& sizes) {
+    const auto n = nz.size();
+    auto eliminated = std::vector<bool>(n, false);
+    auto order = std::vector<std::size_t>{};
+    for (std::size_t k = 0; k != n; ++k) {
+      auto best = n;
+      auto best_fill = std::size_t{};
+      for (std::size_t p = 0; p != n; ++p) {
+        if (eliminated[p]) {
+          continue;
+        }
+        auto fill = std::size_t{};
+        for (std::size_t i = 0; i != n; ++i) {
+          if ((i == p) || (eliminated[i]) || (!nz[i][p])) {
+            continue;
+          }
+          for (std::size_t j = 0; j != n; ++j) {
+            if ((j != p) && (!eliminated[j]) && (nz[p][j]) && (!nz[i][j])) {
+              ++fill;
+            }
+          }
+        }
+        if ((best == n) || (fill < best_fill) ||
+            ((fill == best_fill) && (sizes[p] < sizes[best]))) {
+          best = p;
+          best_fill = fill;
+        }
+      }
+      eliminated[best] = true;
+      order.push_back(best);
+      for (std::size_t i = 0; i != n; ++i) {
+        for (std::size_t j = 0; j != n; ++j) {
+          if ((!eliminated[i]) && (!eliminated[j]) && (nz[i][best]) &&
+              (nz[best][j])) {
+            nz[i][j] = true;
+          }
+        }
+      }
+    }
+    return order;
+  }  // end of getJacobianBlocksEliminationOrder
+
+  void ImplicitCodeGeneratorBase::writeBlockStructuredLinearSystemSolver(
+      std::ostream& os, const Hypothesis h) const {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c,
+                     "ImplicitCodeGeneratorBase::"
+                     "writeBlockStructuredLinearSystemSolver: " +
+                         m);
+    };
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& ivs = d.getIntegrationVariables();
+    // the linear solver is only called on the jacobian by the Newton-Raphson
+    // algorithms
+    const auto* const nls = &(this->solver);
+    throw_if((dynamic_cast<const NewtonRaphsonSolver*>(nls) == nullptr) &&
+                 (dynamic_cast<const PowellDogLegNewtonRaphsonSolver*>(nls) ==
+                  nullptr),
+             "the block structure of the jacobian can only be exploited by "
+             "the Newton-Raphson algorithms based on an analytical jacobian");
+    const auto integrator = [this, h]() -> std::string {
+      if (!this->bd.hasCode(h, BehaviourData::Integrator)) {
+        return "";
+      }
+      return this->bd.getCodeBlock(h, BehaviourData::Integrator).code;
+    }();
+    throw_if(containsIdentifier(integrator, "jacobian") ||
+                 containsIdentifier(integrator, "computeNumericalJacobian"),
+             "the jacobian is directly modified in the integrator code block, "
+             "so its block structure can't be determined");
+    // structure of the jacobian
+    const auto ncjbs = [&d] {
+      if (!d.hasAttribute(BehaviourData::numericallyComputedJacobianBlocks)) {
+        return std::vector<std::string>{};
+      }
+      return d.getAttribute<std::vector<std::string>>(
+          BehaviourData::numericallyComputedJacobianBlocks);
+    }();
+    const auto n = ivs.size();
+    auto nz = std::vector<std::vector<bool>>(n, std::vector<bool>(n, false));
+    auto sizes = std::vector<int>{};
+    auto offsets = std::vector<SupportedTypes::TypeSize>{};
+    auto o = SupportedTypes::TypeSize{};
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto& v1 = ivs[i];
+      for (std::size_t j = 0; j != n; ++j) {
+        const auto jb = "df" + v1.name + "_dd" + ivs[j].name;
+        nz[i][j] =
+            (i == j) || (this->jacobianPartsUsedInIntegrator.count(jb) != 0) ||
+            (containsIdentifier(integrator, jb)) ||
+            (std::find(ncjbs.begin(), ncjbs.end(), jb) != ncjbs.end());
+      }
+      sizes.push_back(v1.getTypeSize().getValueForDimension(3));
+      offsets.push_back(o);
+      o += v1.getTypeSize();
+    }
+    const auto order = getJacobianBlocksEliminationOrder(nz, sizes);
+    // helper functions
+    const auto size = [&ivs](const std::size_t i) {
+      return ivs[i].getTypeSize().asString();
+    };
+    const auto index = [&offsets](const std::size_t i, const char* const c) {
+      if (offsets[i].isNull()) {
+        return std::string{c};
+      }
+      if (std::string{c} == "0") {
+        return offsets[i].asString();
+      }
+      return offsets[i].asString() + " + " + c;
+    };
+    const auto mentry = [&index](const std::size_t i, const char* const ci,
+                                 const std::size_t j, const char* const cj) {
+      return "mfront_matrix(" + index(i, ci) + ", " + index(j, cj) + ")";
+    };
+    const auto ventry = [&index](const std::size_t i, const char* const c) {
+      return "mfront_vector(" + index(i, c) + ")";
+    };
+    const auto loop = [&os](const char* const i, const std::string& s) {
+      os << "for (unsigned short " << i << " = 0; " << i << " != " << s
+         << "; ++" << i << "){\n";
+    };
+    const auto lu_solve = [&os](const std::string& s, const char* const x) {
+      os << "if (!tfel::math::TinyMatrixSolve<" << s
+         << ", NumericType, false>::back_substitute(mfront_lu, "
+         << "mfront_permutation, " << x << ")) {\n"
+         << "return false;\n"
+         << "}\n";
+    };
+    // forward elimination
+    os << "// solving the linear system using the block structure of the "
+          "jacobian\n";
+    auto eliminated = std::vector<bool>(n, false);
+    for (const auto p : order) {
+      eliminated[p] = true;
+      const auto sp = size(p);
+      os << "// elimination of the block associated with variable "
+         << ivs[p].name << "\n"
+         << "{\n";
+      if (ivs[p].getTypeSize().isOne()) {
+        os << "const auto mfront_pivot = " << mentry(p, "0", p, "0") << ";\n"
+           << "if (tfel::math::abs(mfront_pivot) < "
+           << "100 * std::numeric_limits<NumericType>::min()) {\n"
+           << "return false;\n"
+           << "}\n"
+           << "const auto mfront_ipivot = 1 / mfront_pivot;\n";
+        for (std::size_t j = 0; j != n; ++j) {
+          if ((eliminated[j]) || (!nz[p][j])) {
+            continue;
+          }
+          loop("mfront_j", size(j));
+          os << mentry(p, "0", j, "mfront_j") << " *= mfront_ipivot;\n"
+             << "}\n";
+        }
+        os << ventry(p, "0") << " *= mfront_ipivot;\n";
+      } else {
+        os << "auto mfront_lu = tfel::math::tmatrix<" << sp << ", " << sp
+           << ", NumericType>{};\n";
+        loop("mfront_i", sp);
+        loop("mfront_j", sp);
+        os << "mfront_lu(mfront_i, mfront_j) = "
+           << mentry(p, "mfront_i", p, "mfront_j") << ";\n"
+           << "}\n"
+           << "}\n"
+           << "auto mfront_permutation = tfel::math::TinyPermutation<" << sp
+           << ">{};\n"
+           << "if (!tfel::math::TinyMatrixSolve<" << sp
+           << ", NumericType, false>::decomp(mfront_lu, mfront_permutation)) "
+              "{\n"
+           << "return false;\n"
+           << "}\n";
+        for (std::size_t j = 0; j != n; ++j) {
+          if ((eliminated[j]) || (!nz[p][j])) {
+            continue;
+          }
+          const auto sj = size(j);
+          os << "{\n"
+             << "auto mfront_x = tfel::math::tmatrix<" << sp << ", " << sj
+             << ", NumericType>{};\n";
+          loop("mfront_i", sp);
+          loop("mfront_j", sj);
+          os << "mfront_x(mfront_i, mfront_j) = "
+             << mentry(p, "mfront_i", j, "mfront_j") << ";\n"
+             << "}\n"
+             << "}\n";
+          lu_solve(sp, "mfront_x");
+          loop("mfront_i", sp);
+          loop("mfront_j", sj);
+          os << mentry(p, "mfront_i", j, "mfront_j")
+             << " = mfront_x(mfront_i, mfront_j);\n"
+             << "}\n"
+             << "}\n"
+             << "}\n";
+        }
+        os << "auto mfront_x = tfel::math::tvector<" << sp
+           << ", NumericType>{};\n";
+        loop("mfront_i", sp);
+        os << "mfront_x(mfront_i) = " << ventry(p, "mfront_i") << ";\n"
+           << "}\n";
+        lu_solve(sp, "mfront_x");
+        loop("mfront_i", sp);
+        os << ventry(p, "mfront_i") << " = mfront_x(mfront_i);\n"
+           << "}\n";
+      }
+      // update of the remaining blocks
+      for (std::size_t i = 0; i != n; ++i) {
+        if ((eliminated[i]) || (!nz[i][p])) {
+          continue;
+        }
+        for (std::size_t j = 0; j != n; ++j) {
+          if ((eliminated[j]) || (!nz[p][j])) {
+            continue;
+          }
+          loop("mfront_i", size(i));
+          loop("mfront_j", size(j));
+          loop("mfront_k", sp);
+          os << mentry(i, "mfront_i", j, "mfront_j") << " -= "
+             << mentry(i, "mfront_i", p, "mfront_k") << " * "
+             << mentry(p, "mfront_k", j, "mfront_j") << ";\n"
+             << "}\n"
+             << "}\n"
+             << "}\n";
+        }
+        loop("mfront_i", size(i));
+        loop("mfront_k", sp);
+        os << ventry(i, "mfront_i") << " -= "
+           << mentry(i, "mfront_i", p, "mfront_k") << " * "
+           << ventry(p, "mfront_k") << ";\n"
+           << "}\n"
+           << "}\n";
+      }
+      os << "}\n";
+    }
+    // back substitution
+    auto solved = std::vector<bool>(n, false);
+    for (auto pp = order.rbegin(); pp != order.rend(); ++pp) {
+      const auto p = *pp;
+      for (std::size_t j = 0; j != n; ++j) {
+        if ((!solved[j]) || (!nz[p][j])) {
+          continue;
+        }
+        loop("mfront_i", size(p));
+        loop("mfront_j", size(j));
+        os << ventry(p, "mfront_i") << " -= "
+           << mentry(p, "mfront_i", j, "mfront_j") << " * "
+           << ventry(j, "mfront_j") << ";\n"
+           << "}\n"
+           << "}\n";
+      }
+      solved[p] = true;
+    }
+  }  // end of writeBlockStructuredLinearSystemSolver
+
   void ImplicitCodeGeneratorBase::writeComputeFdF(std::ostream& os,
                                                   const Hypothesis h) const {
     const auto& d = this->bd.getBehaviourData(h);
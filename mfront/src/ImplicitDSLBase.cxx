@@ -122,6 +122,8 @@ namespace mfront {
     this->registerNewCallBack(
         "@JacobianComparisonCriterion",
         &ImplicitDSLBase::treatJacobianComparisonCriterion);
+    this->registerNewCallBack("@UseJacobianBlockStructure",
+                              &ImplicitDSLBase::treatUseJacobianBlockStructure);
     this->registerNewCallBack(
         "@JacobianComparisonCriterium",
         &ImplicitDSLBase::treatJacobianComparisonCriterion);
@@ -465,6 +467,26 @@ namespace mfront {
                              ";");
   }  // end of treatCompareToNumericalJacobian
 
+  void ImplicitDSLBase::treatUseJacobianBlockStructure() {
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile("ImplicitDSLBase::treatUseJacobianBlockStructure",
+                            "Expected 'true' or 'false'.");
+    if (this->current->value == "true") {
+      this->mb.setAttribute(h, BehaviourData::useJacobianBlockStructure, true);
+    } else if (this->current->value == "false") {
+      this->mb.setAttribute(h, BehaviourData::useJacobianBlockStructure,
+                            false);
+    } else {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatUseJacobianBlockStructure",
+          "Expected to read 'true' or 'false' instead of '" +
+              this->current->value + ".");
+    }
+    ++(this->current);
+    this->readSpecifiedToken("ImplicitDSLBase::treatUseJacobianBlockStructure",
+                             ";");
+  }  // end of treatUseJacobianBlockStructure
+
   void ImplicitDSLBase::treatJacobianComparisonCriterion() {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     if (!this->mb.getAttribute(h, BehaviourData::compareToNumericalJacobian,
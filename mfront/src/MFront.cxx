@@ -23,6 +23,7 @@
 #include <cstring>
 #include <string>
 #include <cerrno>
+#include <mutex>
 #include <memory>
 
 #include "TFEL/Raise.hxx"
@@ -30,6 +31,7 @@
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 
 #include "MFront/MFrontHeader.hxx"
@@ -46,6 +48,8 @@
 #include "MFront/BehaviourBrick/KinematicHardeningRuleFactory.hxx"
 #include "MFront/ModelInterfaceFactory.hxx"
 #include "MFront/MFrontLock.hxx"
+#include "MFront/SearchPathsHandler.hxx"
+#include "MFront/CodeGenerationCache.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/CMakeGenerator.hxx"
@@ -285,6 +289,57 @@ namespace mfront {
     }
   }  // end of MFront::treatSilentBuild
 
+  void MFront::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MFront::treatJobs: "
+                   "no argument given to the "
+                   "--jobs option");
+    const auto n = [&o] {
+      try {
+        auto pos = std::size_t{};
+        const auto v = std::stoi(o, &pos);
+        if (pos == o.size()) {
+          return v;
+        }
+      } catch (std::exception&) {
+      }
+      tfel::raise(
+          "MFront::treatJobs: "
+          "invalid argument '" +
+          o + "' given to the --jobs option");
+    }();
+    tfel::raise_if((n < 1) || (n > 1024),
+                   "MFront::treatJobs: "
+                   "invalid number of jobs '" +
+                       o + "'");
+    this->numberOfJobs = static_cast<unsigned short>(n);
+  }  // end of MFront::treatJobs
+
+  void MFront::treatCache() {
+    this->useCache = true;
+  }  // end of MFront::treatCache
+
+  std::string MFront::getCacheOptions() const {
+    auto o = std::string{};
+    for (const auto& a : this->args) {
+      const auto& n = a.as_string();
+      if ((this->inputs.count(n) != 0) || (n == "--jobs") ||
+          (n == "--cache") || (n == "--verbose")) {
+        continue;
+      }
+      o += n;
+      if (a.hasOption()) {
+        o += '=' + a.getOption();
+      }
+      o += '\n';
+    }
+    for (const auto& p : SearchPathsHandler::getSearchPaths()) {
+      o += "search path: " + p + '\n';
+    }
+    return o;
+  }  // end of MFront::getCacheOptions
+
   void MFront::treatTarget() {
     using tfel::utilities::tokenize;
     const auto& t = tokenize(this->currentArgument->getOption(), ',');
@@ -455,6 +510,14 @@ namespace mfront {
 #endif
     this->registerNewCallBack("--silent-build", &MFront::treatSilentBuild,
                               "active or desactivate silent build", true);
+    this->registerNewCallBack(
+        "--jobs", &MFront::treatJobs,
+        "number of input files treated in parallel (default: 1)", true);
+    this->registerNewCallBack(
+        "--cache", &MFront::treatCache,
+        "skip the treatment of the input files which did not change since "
+        "the last run and preserve the modification times of the generated "
+        "files whose content did not change");
     this->registerNewCallBack("--make", &MFront::treatMake,
                               "generate MakeFile (see also --build)");
     this->registerNewCallBack("--build", &MFront::treatBuild,
@@ -765,17 +828,84 @@ namespace mfront {
   }    // end of void MFront::treatDefFile
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
 
-  TargetsDescription MFront::treatFile(const std::string& f) const {
-    if (getVerboseMode() >= VERBOSE_LEVEL2) {
-      getLogStream() << "Treating file: '" << f << "'" << std::endl;
-    }
-    auto dsl = MFrontBase::getDSL(f);
+  /*!
+   * \return a mutex used to serialize the steps of the treatment of an input
+   * file which are not thread-safe (loading of external DSLs, generation of
+   * the output files) when input files are treated in parallel.
+   *
+   * \note this mutex is recursive since the generation of the output files
+   * may require to treat other input files (see `DSLBase::callMFront`).
+   */
+  static std::recursive_mutex& getTreatFileMutex() {
+    static std::recursive_mutex m;
+    return m;
+  }  // end of getTreatFileMutex
+
+  std::shared_ptr<AbstractDSL> MFront::getDSLAndAnalyseFile(
+      const std::string& f) const {
+    auto dsl = [this, &f] {
+      std::lock_guard<std::recursive_mutex> lock(getTreatFileMutex());
+      return MFrontBase::getDSL(f);
+    }();
     if (!this->interfaces.empty()) {
       dsl->setInterfaces(this->interfaces);
     }
     dsl->analyseFile(f, this->ecmds, this->substitutions);
+    return dsl;
+  }  // end of MFront::getDSLAndAnalyseFile
+
+  TargetsDescription MFront::analyseFileAndGenerateOutputFiles(
+      const std::string& f) const {
+    auto dsl = this->getDSLAndAnalyseFile(f);
+    std::lock_guard<std::recursive_mutex> lock(getTreatFileMutex());
     dsl->generateOutputFiles();
-    auto td = dsl->getTargetsDescription();
+    return dsl->getTargetsDescription();
+  }  // end of MFront::analyseFileAndGenerateOutputFiles
+
+  TargetsDescription MFront::treatFile(const std::string& f) const {
+    if (getVerboseMode() >= VERBOSE_LEVEL2) {
+      getLogStream() << "Treating file: '" << f << "'" << std::endl;
+    }
+    auto td = [this, &f] {
+      if ((!this->useCache) || (!CodeGenerationCache::isCacheable(f))) {
+        return this->analyseFileAndGenerateOutputFiles(f);
+      }
+      const auto cache = CodeGenerationCache{};
+      const auto k = cache.getKey(f, this->getCacheOptions());
+      // files on which the input file depends. The files searched during
+      // the generation of the output files are also recorded.
+      auto deps = std::vector<std::string>{};
+      auto* const outer = SearchPathsHandler::setSearchedFilesRecorder(&deps);
+      // an input file may be treated during the generation of the output
+      // files of another input file (see `DSLBase::callMFront`): the
+      // dependencies of the former are also dependencies of the latter.
+      auto restore = [outer, &deps] {
+        SearchPathsHandler::setSearchedFilesRecorder(outer);
+        if (outer != nullptr) {
+          outer->insert(outer->end(), deps.begin(), deps.end());
+        }
+      };
+      try {
+        if (const auto ptd = cache.load(deps, f, k)) {
+          restore();
+          if (getVerboseMode() >= VERBOSE_LEVEL2) {
+            getLogStream() << "File '" << f << "' is up to date" << std::endl;
+          }
+          return TargetsDescription(*ptd);
+        }
+        auto dsl = this->getDSLAndAnalyseFile(f);
+        std::lock_guard<std::recursive_mutex> lock(getTreatFileMutex());
+        auto g = cache.startGeneration(f);
+        dsl->generateOutputFiles();
+        auto r = dsl->getTargetsDescription();
+        cache.store(*g, k, deps, r);
+        restore();
+        return r;
+      } catch (...) {
+        restore();
+        throw;
+      }
+    }();
     for (auto& l : td.libraries) {
       for (const auto& d : this->defines) {
 #ifndef _MSC_VER
@@ -865,6 +995,60 @@ namespace mfront {
     file << this->targets;
   }  // end of MFront::writeTargetDescription
 
+  void MFront::treatFilesInParallel(
+      std::vector<std::pair<std::string, std::string>>& errors) {
+    struct Result {
+      //! \brief targets description, null if the treatment failed
+      std::shared_ptr<TargetsDescription> td;
+      //! \brief buffered log messages
+      std::string log;
+      //! \brief error message
+      std::string error;
+    };
+    auto treat = [this](const std::string& f) {
+      auto r = Result{};
+      auto log = std::ostringstream{};
+      setThreadLocalLogStream(&log);
+      try {
+        r.td = std::make_shared<TargetsDescription>(this->treatFile(f));
+      } catch (std::exception& e) {
+        r.error = e.what();
+      } catch (...) {
+        r.error = "unknown exception";
+      }
+      setThreadLocalLogStream(nullptr);
+      r.log = log.str();
+      return r;
+    };
+    const auto n = std::min(static_cast<std::size_t>(this->numberOfJobs),
+                            this->inputs.size());
+    tfel::system::ThreadPool pool(n);
+    auto results = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<Result>>>{};
+    results.reserve(this->inputs.size());
+    for (const auto& i : this->inputs) {
+      results.push_back(pool.addTask([&treat, &i] { return treat(i); }));
+    }
+    // results are merged in the order of the input files, so that the
+    // outcome does not depend on the scheduling of the tasks
+    auto& log = getLogStream();
+    auto pi = this->inputs.begin();
+    for (auto& f : results) {
+      auto r = f.get();
+      if (!r) {
+        r.rethrow();
+      }
+      log << r->log;
+      if (r->td != nullptr) {
+        mergeTargetsDescription(this->targets, *(r->td), true);
+      } else {
+        errors.push_back({*pi, r->error});
+      }
+      ++pi;
+    }
+    log.flush();
+  }  // end of MFront::treatFilesInParallel
+
   void MFront::exe() {
     tfel::system::systemCall::mkdir("src");
     tfel::system::systemCall::mkdir("include");
@@ -884,12 +1068,16 @@ namespace mfront {
     this->analyseTargetsFile();
     auto errors = std::vector<std::pair<std::string, std::string>>{};
     if (!this->inputs.empty()) {
-      for (const auto& i : this->inputs) {
-        try {
-          const auto td = this->treatFile(i);
-          mergeTargetsDescription(this->targets, td, true);
-        } catch (std::exception& e) {
-          errors.push_back({i, e.what()});
+      if ((this->numberOfJobs > 1) && (this->inputs.size() > 1)) {
+        this->treatFilesInParallel(errors);
+      } else {
+        for (const auto& i : this->inputs) {
+          try {
+            const auto td = this->treatFile(i);
+            mergeTargetsDescription(this->targets, td, true);
+          } catch (std::exception& e) {
+            errors.push_back({i, e.what()});
+          }
         }
       }
       for (auto& t : this->targets.specific_targets) {
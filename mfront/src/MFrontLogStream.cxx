@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <atomic>
 #include <memory>
 #include <fstream>
 #include <iostream>
@@ -97,7 +98,17 @@ namespace mfront {
     }
   }  // end of setVerboseMode
 
+  //! \return the logging stream of the calling thread, if any
+  static std::ostream*& getThreadLocalLogStream() {
+    thread_local std::ostream* os = nullptr;
+    return os;
+  }  // end of getThreadLocalLogStream
+
   std::ostream& getLogStream() {
+    auto* const os = getThreadLocalLogStream();
+    if (os != nullptr) {
+      return *os;
+    }
     auto& log = LogStream::getLogStream();
     return log.getStream();
   }  // end of function getLogStream
@@ -112,10 +123,14 @@ namespace mfront {
     log.setLogStream(os);
   }  // end of function setLogStream
 
+  void setThreadLocalLogStream(std::ostream* const os) {
+    getThreadLocalLogStream() = os;
+  }  // end of function setThreadLocalLogStream
+
   namespace internals {
 
-    static bool& getUnicodeOutputOption() {
-      static bool b = true;
+    static std::atomic<bool>& getUnicodeOutputOption() {
+      static std::atomic<bool> b{true};
       return b;
     }  // end of getUnicodeOutputOption()
   }    // end of namespace internals
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <iterator>
 #include <stdexcept>
@@ -51,6 +52,7 @@ namespace mfront {
 
   std::vector<std::string>
   MaterialPropertyInterfaceFactory::getRegistredInterfaces() const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto res = std::vector<std::string>{};
     for (const auto& a : this->getAliasesMap()) {
       res.push_back(a.first);
@@ -61,6 +63,7 @@ namespace mfront {
   void MaterialPropertyInterfaceFactory::registerInterfaceCreator(
       const std::string& i,
       const MaterialPropertyInterfaceFactory::InterfaceCreator f) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(
         imap.find(i) != imap.end(),
@@ -72,6 +75,7 @@ namespace mfront {
 
   void MaterialPropertyInterfaceFactory::registerInterfaceAlias(
       const std::string& i, const std::string& a) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& amap = this->getAliasesMap();
     tfel::raise_if(
         amap.find(a) != amap.end(),
@@ -83,12 +87,14 @@ namespace mfront {
 
   void MaterialPropertyInterfaceFactory::registerInterfaceDependency(
       const std::string& name, const std::string& dep) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     this->getDependenciesMap()[name].push_back(dep);
   }  // end of MaterialPropertyInterfaceFactory::registerInterfaceDependency
 
   std::vector<std::string>
   MaterialPropertyInterfaceFactory::getInterfaceDependencies(
       const std::string& name) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     std::vector<std::string> res;
     std::vector<std::string> tmp;
     auto p = this->getAliasesMap().find(name);
@@ -114,12 +120,14 @@ namespace mfront {
   }  // end of MaterialPropertyInterfaceFactory::getInterfaceDependencies
 
   bool MaterialPropertyInterfaceFactory::exists(const std::string& n) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     return this->getAliasesMap().count(n) != 0;
   }  // end of MaterialPropertyInterfaceFactory::exists
 
   std::shared_ptr<AbstractMaterialPropertyInterface>
   MaterialPropertyInterfaceFactory::getInterface(
       const std::string& interfaceName) const {
+    std::unique_lock<std::recursive_mutex> lock(this->mutex);
     auto p2 = this->getAliasesMap().find(interfaceName);
     if (p2 == this->getAliasesMap().end()) {
       auto msg =
@@ -135,6 +143,7 @@ namespace mfront {
     auto p = this->getInterfaceCreatorsMap().find(p2->second);
     assert(p != this->getInterfaceCreatorsMap().end());
     auto c = p->second;
+    lock.unlock();
     return c();
   }
 
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cassert>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
@@ -47,6 +48,7 @@ namespace mfront {
 
   std::vector<std::string> ModelInterfaceFactory::getRegistredInterfaces()
       const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto res = std::vector<std::string>{};
     for (const auto& a : this->getAliasesMap()) {
       res.push_back(a.first);
@@ -56,6 +58,7 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceCreator(
       const std::string& i, const ModelInterfaceFactory::InterfaceCreator f) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& imap = this->getInterfaceCreatorsMap();
     tfel::raise_if(imap.find(i) != imap.end(),
                    "ModelInterfaceFactory::registerInterfaceCreator: "
@@ -66,6 +69,7 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceAlias(const std::string& i,
                                                      const std::string& a) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     auto& amap = this->getAliasesMap();
     tfel::raise_if(amap.find(a) != amap.end(),
                    "ModelInterfaceFactory::registerInterfaceCreator: "
@@ -76,11 +80,13 @@ namespace mfront {
 
   void ModelInterfaceFactory::registerInterfaceDependency(
       const std::string& name, const std::string& dep) {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     this->getDependenciesMap()[name].push_back(dep);
   }  // end of ModelInterfaceFactory::registerInterfaceDependency
 
   std::vector<std::string> ModelInterfaceFactory::getInterfaceDependencies(
       const std::string& name) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     std::vector<std::string> res;
     std::vector<std::string> tmp;
     auto p = this->getAliasesMap().find(name);
@@ -106,11 +112,13 @@ namespace mfront {
   }  // end of ModelInterfaceFactory::getInterfaceDependencies
 
   bool ModelInterfaceFactory::exists(const std::string& n) const {
+    std::lock_guard<std::recursive_mutex> lock(this->mutex);
     return this->getAliasesMap().count(n) != 0;
   }  // end of ModelInterfaceFactory::exists
 
   std::shared_ptr<AbstractModelInterface> ModelInterfaceFactory::getInterface(
       const std::string& interfaceName) const {
+    std::unique_lock<std::recursive_mutex> lock(this->mutex);
     auto p2 = this->getAliasesMap().find(interfaceName);
     if (p2 == this->getAliasesMap().end()) {
       auto msg = std::string("ModelInterfaceFactory::createNewInterface: ");
@@ -125,6 +133,7 @@ namespace mfront {
     auto p = this->getInterfaceCreatorsMap().find(p2->second);
     assert(p != this->getInterfaceCreatorsMap().end());
     auto c = p->second;
+    lock.unlock();
     return c();
   }
 
@@ -13,6 +13,7 @@
 
 #include <ostream>
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/BehaviourDescription.hxx"
 #include "MFront/PerformanceProfiling.hxx"
@@ -97,6 +98,80 @@ namespace mfront {
   NewtonRaphsonNumericalJacobianSolver::
       ~NewtonRaphsonNumericalJacobianSolver() = default;
 
+  std::vector<std::string>
+  NewtonRaphsonJacobianReuseSolver::getSpecificHeaders() const {
+    return {"TFEL/Math/TinyNewtonRaphsonJacobianReuseSolver.hxx"};
+  }  // end of getSpecificHeaders
+
+  std::string NewtonRaphsonJacobianReuseSolver::getExternalAlgorithmClassName(
+      const BehaviourDescription& bd, const Hypothesis h) const {
+    return NonLinearSystemSolverBase::buildExternalAlgorithmClassName(
+        bd, h, "TinyNewtonRaphsonJacobianReuseSolver");
+  }  // end of getExternalAlgorithmClassName
+
+  bool NewtonRaphsonJacobianReuseSolver::requiresNumericalJacobian() const {
+    return false;
+  }
+
+  std::pair<bool, NewtonRaphsonSolverBase::tokens_iterator>
+  NewtonRaphsonJacobianReuseSolver::treatSpecificKeywords(
+      BehaviourDescription& bd,
+      const std::string& key,
+      const tokens_iterator p,
+      const tokens_iterator pe) {
+    if (key != "@JacobianReuseThreshold") {
+      return NewtonRaphsonSolverBase::treatSpecificKeywords(bd, key, p, pe);
+    }
+    const auto m = std::string{
+        "NewtonRaphsonJacobianReuseSolver::treatSpecificKeywords"};
+    const auto h = tfel::material::ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    auto current = p;
+    CxxTokenizer::checkNotEndOfLine(m, "Cannot read the threshold value.",
+                                    current, pe);
+    const auto t = tfel::utilities::convert<double>(current->value);
+    tfel::raise_if(t < 0, m + ": the threshold must be positive");
+    ++current;
+    CxxTokenizer::readSpecifiedToken(m, ";", current, pe);
+    bd.addParameter(h, VariableDescription("NumericType",
+                                           "jacobian_reuse_threshold", 1u, 0u));
+    bd.setParameterDefaultValue(h, "jacobian_reuse_threshold", t);
+    return {true, current};
+  }  // end of treatSpecificKeywords
+
+  void NewtonRaphsonJacobianReuseSolver::completeVariableDeclaration(
+      BehaviourDescription& bd) const {
+    const auto h = tfel::material::ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    if (!bd.hasParameter(h, "jacobian_reuse_threshold")) {
+      bd.addParameter(h, VariableDescription("NumericType",
+                                             "jacobian_reuse_threshold", 1u,
+                                             0u));
+      bd.setParameterDefaultValue(h, "jacobian_reuse_threshold", 0.25);
+    }
+  }  // end of completeVariableDeclaration
+
+  void NewtonRaphsonJacobianReuseSolver::initializeNumericalParameters(
+      std::ostream& os,
+      const BehaviourDescription& bd,
+      const Hypothesis h) const {
+    const auto sn = this->getExternalAlgorithmClassName(bd, h);
+    NewtonRaphsonSolverBase::initializeNumericalParameters(os, bd, h);
+    os << sn << "::jacobian_reuse_threshold = "
+       << "this->jacobian_reuse_threshold;\n";
+  }  // end of initializeNumericalParameters
+
+  void NewtonRaphsonJacobianReuseSolver::writeSpecificProfilingStatistics(
+      std::ostream& os,
+      const BehaviourDescription& bd,
+      const Hypothesis) const {
+    os << bd.getClassName()
+       << "Profiler::getProfiler().addJacobianReuseStatistics("
+       << "this->number_of_jacobian_decompositions, "
+       << "this->number_of_jacobian_reuses);\n";
+  }  // end of writeSpecificProfilingStatistics
+
+  NewtonRaphsonJacobianReuseSolver::~NewtonRaphsonJacobianReuseSolver() =
+      default;
+
   std::vector<std::string> PowellDogLegNewtonRaphsonSolver::getSpecificHeaders()
       const {
     return {"TFEL/Math/TinyPowellDogLegNewtonRaphsonSolver.hxx"};
@@ -39,6 +39,10 @@ namespace mfront {
        << sn << "::iterMax = this->iterMax;\n";
   }  // end of initializeNumericalParameters
 
+  void NonLinearSystemSolverBase::writeSpecificProfilingStatistics(
+      std::ostream&, const BehaviourDescription&, const Hypothesis) const {
+  }  // end of writeSpecificProfilingStatistics
+
   std::string NonLinearSystemSolverBase::buildExternalAlgorithmClassName(
       const BehaviourDescription& bd,
       const Hypothesis h,
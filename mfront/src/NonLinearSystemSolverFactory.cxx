@@ -54,6 +54,9 @@ namespace mfront {
     this->registerSolver(
         "NewtonRaphson_NumericalJacobian",
         buildSolverConstructor<NewtonRaphsonNumericalJacobianSolver>);
+    this->registerSolver(
+        "NewtonRaphson_JacobianReuse",
+        buildSolverConstructor<NewtonRaphsonJacobianReuseSolver>);
     this->registerSolver(
         "PowellDogLeg_NewtonRaphson",
         buildSolverConstructor<PowellDogLegNewtonRaphsonSolver>);
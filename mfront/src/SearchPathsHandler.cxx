@@ -106,9 +106,34 @@ namespace mfront {
 
 #endif /* MFRONT_HAVE_MADNEX */
 
+  //! \return the list of searched files recorded by the calling thread
+  static std::vector<std::string>*& getSearchedFilesRecorder() {
+    thread_local std::vector<std::string>* files = nullptr;
+    return files;
+  }  // end of getSearchedFilesRecorder
+
+  std::vector<std::string>* SearchPathsHandler::setSearchedFilesRecorder(
+      std::vector<std::string>* const files) {
+    auto* const previous = getSearchedFilesRecorder();
+    getSearchedFilesRecorder() = files;
+    return previous;
+  }  // end of setSearchedFilesRecorder
+
   std::string SearchPathsHandler::search(const std::string& f) {
+    const auto path = SearchPathsHandler::searchFile(f);
+    auto* const files = getSearchedFilesRecorder();
+    if (files != nullptr) {
+      files->push_back(path);
+    }
+    return path;
+  }  // end of search
+
+  std::string SearchPathsHandler::searchFile(const std::string& f) {
     using namespace tfel::system;
     auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    // the lock is also required by the madnex library which is not
+    // thread-safe
+    std::lock_guard<std::mutex> lock(msf.m);
     if (fileExistsAndIsReadable(f)) {
       return f;
     }
@@ -167,7 +192,7 @@ namespace mfront {
         "SearchPathsHandler::search: "
         "file '" +
         f + "' has not been found.");
-  }
+  }  // end of searchFile
 
   void SearchPathsHandler::addMadnexSearchPath(const std::string& p) {
 #ifdef MFRONT_HAVE_MADNEX
@@ -185,6 +210,7 @@ namespace mfront {
     }
     // check if the madnex file exists
     auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    std::lock_guard<std::mutex> lock(msf.m);
     const auto file_path = msf.searchMadnexFile(details[0]);
     const auto ext = getFileExtension(file_path);
     if (!((ext == "madnex") || (ext == "mdnx") || (ext == "edf"))) {
@@ -259,6 +285,7 @@ namespace mfront {
             path + "' is not a directory");
       }
     }
+    std::lock_guard<std::mutex> lock(msf.m);
     msf.paths.insert(msf.paths.begin(), npaths.begin(), npaths.end());
   }  // end of addSearchPaths
 
@@ -281,6 +308,7 @@ namespace mfront {
 
   std::vector<std::string> SearchPathsHandler::getSearchPaths() {
     auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    std::lock_guard<std::mutex> lock(msf.m);
     auto directories = std::vector<std::string>{};
     for (const auto& path : msf.paths) {
       if (std::holds_alternative<std::string>(path)) {
@@ -66,6 +66,7 @@ namespace mfront {
     this->writeSpecificSymbols(out, i, bd, fd, name);
     this->writeTemperatureRemovedFromExternalStateVariablesSymbol(out, i, bd,
                                                                   name);
+    this->writeProfilingSymbols(out, i, bd, name);
   }
 
   void SymbolsGenerator::writeFileDescriptionSymbols(
@@ -697,6 +698,51 @@ namespace mfront {
         out, i.getFunctionNameBasis(name) + "_ElasticSymmetryType", est);
   }  // end of writeElasticSymmetryTypeSymbols
 
+  void SymbolsGenerator::writeProfilingSymbols(
+      std::ostream& out,
+      const StandardBehaviourInterface& i,
+      const BehaviourDescription& bd,
+      const std::string& name) const {
+    if (!bd.getAttribute(BehaviourData::profiling, false)) {
+      return;
+    }
+    const auto f = i.getFunctionNameBasis(name) + "_mfront_profiling";
+    const auto p = "tfel::material::" + bd.getClassName() + "Profiler";
+    out << "MFRONT_SHAREDOBJ unsigned short " << f
+        << "_get_number_of_code_blocks(void){\n"
+        << "return mfront::BehaviourProfiler::numberOfCodeBlocks;\n"
+        << "}\n\n"
+        << "MFRONT_SHAREDOBJ const char* " << f
+        << "_get_code_block_name(const unsigned short c){\n"
+        << "try{\n"
+        << "return mfront::BehaviourProfiler::getCodeBlockName(c);\n"
+        << "} catch(...){}\n"
+        << "return nullptr;\n"
+        << "}\n\n"
+        << "MFRONT_SHAREDOBJ int " << f
+        << "_get_measures(intmax_t* const calls, intmax_t* const times){\n"
+        << "try{\n"
+        << "const auto s = " << p << "::getProfiler().getSummary();\n"
+        << "for(unsigned short c = 0; "
+        << "c != mfront::BehaviourProfiler::numberOfCodeBlocks; ++c){\n"
+        << "calls[c] = s.blocks[c].calls;\n"
+        << "times[c] = s.blocks[c].time;\n"
+        << "}\n"
+        << "} catch(...){\n"
+        << "return 0;\n"
+        << "}\n"
+        << "return 1;\n"
+        << "}\n\n"
+        << "MFRONT_SHAREDOBJ int " << f << "_reset(void){\n"
+        << "try{\n"
+        << p << "::getProfiler().reset();\n"
+        << "} catch(...){\n"
+        << "return 0;\n"
+        << "}\n"
+        << "return 1;\n"
+        << "}\n\n";
+  }  // end of writeProfilingSymbols
+
   void SymbolsGenerator::writeSourceFileSymbols(
       std::ostream& out,
       const StandardBehaviourInterface& i,
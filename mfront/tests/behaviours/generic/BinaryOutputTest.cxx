@@ -0,0 +1,125 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/BinaryOutputTest.cxx
+ * \brief  This test runs the `binaryoutput.mtest` and `binaryoutput.ptest`
+ * files, which use the `@OutputFormat 'binary'` keyword, and reads back
+ * the output files using the `BinaryData` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <map>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+#include "MTest/MTest.hxx"
+#include "MTest/PipeTest.hxx"
+#include "MTest/PipeTestParser.hxx"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+//! \brief directory containing the input files
+static std::string srcdir;
+
+struct BinaryOutputTest final : public tfel::tests::TestCase {
+  BinaryOutputTest()
+      : tfel::tests::TestCase("MTest", "BinaryOutputTest") {
+  }  // end of BinaryOutputTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \return the substitutions used to read the input files
+  static std::map<std::string, std::string> getSubstitutions() {
+    return {{"@library@", "\"" + library + "\""}};
+  }  // end of getSubstitutions
+  //! \brief uniaxial tensile test
+  void test1() {
+    constexpr auto E = 150e9;
+    constexpr auto e0 = 1e-3;
+    auto t = mtest::MTest{};
+    t.readInputFile(srcdir + "/binaryoutput.mtest", {}, getSubstitutions());
+    TFEL_TESTS_ASSERT(t.execute().success());
+    TFEL_TESTS_ASSERT(tfel::utilities::BinaryData::isBinaryDataFile(
+        "binaryoutput-mtest.bin"));
+    const auto d = tfel::utilities::BinaryData("binaryoutput-mtest.bin");
+    // time, 6 strains, 6 stresses, stored and dissipated energies
+    TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 15);
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == 21);
+    TFEL_TESTS_ASSERT(d.getLegend(1) == "time");
+    const auto times = d.getColumnView(1);
+    const auto exx = d.getColumnView(2);
+    const auto sxx = d.getColumnView(8);
+    for (std::size_t i = 0; i != d.getNumberOfRows(); ++i) {
+      const auto ti = 180 * static_cast<double>(i);
+      TFEL_TESTS_ASSERT(std::abs(times[i] - ti) < 1e-10);
+      TFEL_TESTS_ASSERT(std::abs(exx[i] - e0 * std::sin(ti / 900)) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(sxx[i] - E * exx[i]) < 1e-3);
+    }
+  }  // end of test1
+  //! \brief pipe under an increasing inner pressure
+  void test2() {
+    constexpr auto E = 150e9;
+    constexpr auto nu = 0.3;
+    constexpr auto ri = 4.2e-3;
+    constexpr auto ro = 4.7e-3;
+    constexpr auto pmax = 1.5e6;
+    auto t = mtest::PipeTest{};
+    mtest::PipeTestParser().execute(t, srcdir + "/binaryoutput.ptest", {},
+                                    getSubstitutions());
+    TFEL_TESTS_ASSERT(t.execute().success());
+    TFEL_TESTS_ASSERT(tfel::utilities::BinaryData::isBinaryDataFile(
+        "binaryoutput-ptest.bin"));
+    const auto d = tfel::utilities::BinaryData("binaryoutput-ptest.bin");
+    TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 6);
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == 5);
+    const auto times = d.getColumnView(d.findColumn("time"));
+    const auto uri = d.getColumnView(d.findColumn("inner radius displacement"));
+    const auto uro = d.getColumnView(d.findColumn("outer radius displacement"));
+    // Lamé solution for an open tube
+    const auto c = ri * ri / (ro * ro - ri * ri) / E;
+    for (std::size_t i = 0; i != d.getNumberOfRows(); ++i) {
+      const auto ti = 0.25 * static_cast<double>(i);
+      const auto p = pmax * ti;
+      const auto ui = c * p * ((1 - nu) * ri + (1 + nu) * ro * ro / ri);
+      const auto uo = c * p * 2 * ro;
+      TFEL_TESTS_ASSERT(std::abs(times[i] - ti) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(uri[i] - ui) < 1e-4 * std::abs(ui) + 1e-14);
+      TFEL_TESTS_ASSERT(std::abs(uro[i] - uo) < 1e-4 * std::abs(uo) + 1e-14);
+    }
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BinaryOutputTest, "BinaryOutputTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 3) {
+    std::cerr << "BinaryOutputTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  srcdir = argv[2];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BinaryOutputTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,264 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/IntegrateArrayTest.cxx
+ * \brief  This test checks that integrating a behaviour over an array of
+ * integration points gives the same results than integrating the behaviour
+ * at each integration point.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+/*!
+ * \brief path to the library containing the `ImplicitNorton` and the
+ * `SaintVenantKirchhoffElasticity` behaviours
+ */
+static std::string library;
+
+/*!
+ * \brief values of the arrays of the behaviour data for a set of
+ * integration points.
+ */
+struct IntegrationPointsData {
+  /*!
+   * \brief constructor
+   * \param[in] sizes: number of values per integration point
+   * \param[in] n: number of integration points
+   */
+  IntegrationPointsData(const std::vector<int>& sizes, const std::size_t n)
+      : eto0(n * sizes[0], 0.),
+        eto1(n * sizes[0], 0.),
+        sig0(n * sizes[1], 0.),
+        sig1(n * sizes[1], 0.),
+        mp(n * sizes[2], 0.),
+        isvs0(n * sizes[3], 0.),
+        isvs1(n * sizes[3], 0.),
+        esvs(n * sizes[4], 293.15),
+        K(n * sizes[5], 0.),
+        rho(n, 0.),
+        e0(n, 0.),
+        e1(n, 0.),
+        d0(n, 0.),
+        d1(n, 0.),
+        c(n, 0.) {}  // end of IntegrationPointsData
+  /*!
+   * \return the behaviour data pointing to the values of the i-th
+   * integration point
+   * \param[in] sizes: number of values per integration point
+   * \param[in] i: index of the integration point
+   */
+  mfront_gb_BehaviourData get(const std::vector<int>& sizes,
+                              const std::size_t i) {
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = this->msg;
+    d.dt = 1;
+    d.rdt = &(this->rdt);
+    d.K = this->K.data() + i * sizes[5];
+    d.speed_of_sound = this->c.data() + i;
+    d.s0.gradients = this->eto0.data() + i * sizes[0];
+    d.s1.gradients = this->eto1.data() + i * sizes[0];
+    d.s0.thermodynamic_forces = this->sig0.data() + i * sizes[1];
+    d.s1.thermodynamic_forces = this->sig1.data() + i * sizes[1];
+    d.s0.mass_density = this->rho.data() + i;
+    d.s1.mass_density = this->rho.data() + i;
+    d.s0.material_properties = this->mp.data() + i * sizes[2];
+    d.s1.material_properties = this->mp.data() + i * sizes[2];
+    d.s0.internal_state_variables = this->isvs0.data() + i * sizes[3];
+    d.s1.internal_state_variables = this->isvs1.data() + i * sizes[3];
+    d.s0.stored_energy = this->e0.data() + i;
+    d.s1.stored_energy = this->e1.data() + i;
+    d.s0.dissipated_energy = this->d0.data() + i;
+    d.s1.dissipated_energy = this->d1.data() + i;
+    d.s0.external_state_variables = this->esvs.data() + i * sizes[4];
+    d.s1.external_state_variables = this->esvs.data() + i * sizes[4];
+    return d;
+  }  // end of get
+  std::vector<double> eto0, eto1, sig0, sig1, mp, isvs0, isvs1, esvs, K;
+  std::vector<double> rho, e0, e1, d0, d1, c;
+  double rdt = 1;
+  char msg[512] = {};
+};  // end of struct IntegrationPointsData
+
+struct IntegrateArrayTest final : public tfel::tests::TestCase {
+  IntegrateArrayTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "IntegrateArrayTest") {
+  }  // end of IntegrateArrayTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  void test1() {
+    constexpr auto n = std::size_t{5};
+    constexpr auto b = "ImplicitNorton_Tridimensional";
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    // gradients, thermodynamic forces, material properties, internal state
+    // variables (elastic strain and equivalent viscoplastic strain),
+    // external state variables (temperature), tangent operator, options
+    const auto sizes = elm.getGenericBehaviourIntegrateArraySizes(library, b);
+    TFEL_TESTS_ASSERT((sizes == std::vector<int>{6, 6, 2, 7, 1, 36, 1}));
+    if (sizes.size() != 7u) {
+      return;
+    }
+    const auto integrate = elm.getGenericBehaviourFunction(library, b);
+    const auto integrateArray =
+        elm.getGenericBehaviourIntegrateArrayFunction(library, b);
+    // initialisation of the integration points, which are loaded
+    // differently so that their internal state variables evolve differently
+    auto initialize = [&sizes, n] {
+      auto d = IntegrationPointsData(sizes, n);
+      for (std::size_t i = 0; i != n; ++i) {
+        d.mp[i * sizes[2]] = 150e9;
+        d.mp[i * sizes[2] + 1] = 0.3;
+        d.eto1[i * sizes[0]] = 1.e-4 * static_cast<double>(i + 1);
+        d.eto1[i * sizes[0] + 3] = 2.e-4 * static_cast<double>(n - i);
+        // consistent tangent operator
+        d.K[i * sizes[5]] = 4;
+      }
+      return d;
+    };
+    auto d1 = initialize();
+    auto status = std::vector<int>(n, -2);
+    for (std::size_t i = 0; i != n; ++i) {
+      auto rdt = double{1};
+      auto d = d1.get(sizes, i);
+      d.rdt = &rdt;
+      status[i] = integrate(&d);
+      d1.rdt = std::min(d1.rdt, rdt);
+    }
+    auto d2 = initialize();
+    auto status2 = std::vector<int>(n, -2);
+    auto d = d2.get(sizes, 0);
+    const auto r = integrateArray(status2.data(), &d, n);
+    TFEL_TESTS_ASSERT(r == *(std::min_element(status.begin(), status.end())));
+    TFEL_TESTS_ASSERT(status == status2);
+    TFEL_TESTS_ASSERT(std::abs(d1.rdt - d2.rdt) < 1.e-14);
+    TFEL_TESTS_ASSERT(r == 1);
+    this->check(d1.sig1, d2.sig1, 1.e-3);
+    this->check(d1.isvs1, d2.isvs1, 1.e-14);
+    this->check(d1.K, d2.K, 1.e-3);
+    // the integration points are not loaded identically
+    TFEL_TESTS_ASSERT(std::abs(d2.isvs1[6] - d2.isvs1[sizes[3] + 6]) >
+                      1.e-14);
+  }  // end of test1
+  /*!
+   * \brief finite strain behaviour returning the first Piola-Kirchhoff
+   * stress, which is not symmetric, and its derivative with respect to the
+   * deformation gradient.
+   */
+  void test2() {
+    constexpr auto n = std::size_t{5};
+    constexpr auto b = "SaintVenantKirchhoffElasticity_Tridimensional";
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    // the thermodynamic forces and the tangent operator have the sizes of
+    // the first Piola-Kirchhoff stress and of its derivative with respect to
+    // the deformation gradient
+    const auto sizes = elm.getGenericBehaviourIntegrateArraySizes(library, b);
+    TFEL_TESTS_ASSERT((sizes == std::vector<int>{9, 9, 2, 0, 1, 81, 3}));
+    if (sizes != std::vector<int>{9, 9, 2, 0, 1, 81, 3}) {
+      return;
+    }
+    const auto integrate = elm.getGenericBehaviourFunction(library, b);
+    const auto integrateArray =
+        elm.getGenericBehaviourIntegrateArrayFunction(library, b);
+    // initialisation of the integration points, which are loaded
+    // differently. The components of the deformation gradient are stored in
+    // the following order: F11, F22, F33, F12, F21, F13, F31, F23, F32.
+    auto initialize = [&sizes](const std::size_t ni, const std::size_t i0) {
+      auto d = IntegrationPointsData(sizes, ni);
+      for (std::size_t i = 0; i != ni; ++i) {
+        const auto ri = static_cast<double>(i0 + i + 1);
+        for (std::size_t j = 0; j != 3; ++j) {
+          d.eto0[i * sizes[0] + j] = 1;
+          d.eto1[i * sizes[0] + j] = 1;
+        }
+        d.mp[i * sizes[2]] = 150e9;
+        d.mp[i * sizes[2] + 1] = 0.3;
+        d.eto1[i * sizes[0]] += 1.e-3 * ri;
+        d.eto1[i * sizes[0] + 3] = 2.e-2 * ri;
+        d.eto1[i * sizes[0] + 8] = -1.e-2 * ri;
+        // consistent tangent operator, first Piola-Kirchhoff stress and its
+        // derivative with respect to the deformation gradient
+        d.K[i * sizes[5]] = 4;
+        d.K[i * sizes[5] + 1] = 2;
+        d.K[i * sizes[5] + 2] = 2;
+      }
+      return d;
+    };
+    auto d = initialize(n, 0);
+    auto status = std::vector<int>(n, -2);
+    auto bd = d.get(sizes, 0);
+    TFEL_TESTS_ASSERT(integrateArray(status.data(), &bd, n) == 1);
+    TFEL_TESTS_ASSERT(status == std::vector<int>(n, 1));
+    for (std::size_t i = 0; i != n; ++i) {
+      auto di = initialize(1, i);
+      auto bdi = di.get(sizes, 0);
+      TFEL_TESTS_ASSERT(integrate(&bdi) == 1);
+      // the first Piola-Kirchhoff stress is not symmetric
+      TFEL_TESTS_ASSERT(std::abs(di.sig1[3] - di.sig1[4]) > 1.e3);
+      const auto pk1 = std::vector<double>(
+          d.sig1.begin() + i * sizes[1], d.sig1.begin() + (i + 1) * sizes[1]);
+      const auto K = std::vector<double>(d.K.begin() + i * sizes[5],
+                                         d.K.begin() + (i + 1) * sizes[5]);
+      this->check(di.sig1, pk1, 1.e-3);
+      this->check(di.K, K, 1.e-3);
+    }
+  }  // end of test2
+  /*!
+   * \brief check that two arrays are equal
+   * \param[in] v1: first array
+   * \param[in] v2: second array
+   * \param[in] eps: criterion
+   */
+  void check(const std::vector<double>& v1,
+             const std::vector<double>& v2,
+             const double eps) {
+    TFEL_TESTS_ASSERT(v1.size() == v2.size());
+    if (v1.size() != v2.size()) {
+      return;
+    }
+    for (std::size_t i = 0; i != v1.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(v1[i] - v2[i]) < eps);
+    }
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(IntegrateArrayTest, "IntegrateArrayTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "IntegrateArrayTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("IntegrateArrayTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/JacobianBlockStructureTest.cxx
+ * \brief  This test checks that solving the linear systems of the implicit
+ * scheme using the block structure of the jacobian (see the
+ * `@UseJacobianBlockStructure` keyword) gives the same results than the
+ * dense LU decomposition used by default.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+
+struct JacobianBlockStructureTest final : public tfel::tests::TestCase {
+  JacobianBlockStructureTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "JacobianBlockStructureTest") {
+  }  // end of JacobianBlockStructureTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief state of a material point
+  struct State {
+    //! \brief strain
+    std::vector<double> eto = std::vector<double>(6, 0.);
+    //! \brief stress
+    std::vector<double> sig = std::vector<double>(6, 0.);
+    //! \brief internal state variables (elastic strain and equivalent
+    //! viscoplastic strain)
+    std::vector<double> isvs = std::vector<double>(7, 0.);
+    //! \brief consistent tangent operator
+    std::vector<double> K = std::vector<double>(36, 0.);
+  };
+  /*!
+   * \brief integrate the behaviour over one time step
+   * \return the value returned by the behaviour
+   * \param[in,out] s: state of the material point
+   * \param[in] b: behaviour
+   * \param[in] deto: strain increment
+   * \param[in] dt: time increment
+   */
+  static int integrate(State& s,
+                       const std::string& b,
+                       const std::vector<double>& deto,
+                       const double dt) {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct =
+        elm.getGenericBehaviourFunction(library, b + "_Tridimensional");
+    auto eto1 = s.eto;
+    for (std::size_t i = 0; i != 6; ++i) {
+      eto1[i] += deto[i];
+    }
+    auto sig1 = s.sig;
+    auto isvs1 = s.isvs;
+    auto mp = std::vector<double>{150e9, 0.3};
+    auto esv = std::vector<double>{293.15};
+    auto rdt = double{1};
+    auto scalars = std::vector<double>(4, 0.);
+    char msg[512] = {};
+    auto d = mfront_gb_BehaviourData{};
+    // consistent tangent operator
+    s.K[0] = 4;
+    d.error_message = msg;
+    d.dt = dt;
+    d.rdt = &rdt;
+    d.K = s.K.data();
+    d.speed_of_sound = &scalars[0];
+    d.s0.gradients = s.eto.data();
+    d.s1.gradients = eto1.data();
+    d.s0.thermodynamic_forces = s.sig.data();
+    d.s1.thermodynamic_forces = sig1.data();
+    d.s0.mass_density = &scalars[1];
+    d.s1.mass_density = &scalars[1];
+    d.s0.material_properties = mp.data();
+    d.s1.material_properties = mp.data();
+    d.s0.internal_state_variables = s.isvs.data();
+    d.s1.internal_state_variables = isvs1.data();
+    d.s0.stored_energy = &scalars[2];
+    d.s1.stored_energy = &scalars[2];
+    d.s0.dissipated_energy = &scalars[3];
+    d.s1.dissipated_energy = &scalars[3];
+    d.s0.external_state_variables = esv.data();
+    d.s1.external_state_variables = esv.data();
+    const auto r = fct(&d);
+    if (r == 1) {
+      s.eto = eto1;
+      s.sig = sig1;
+      s.isvs = isvs1;
+    }
+    return r;
+  }  // end of integrate
+  /*!
+   * \return if the given vectors are equal up to the given relative
+   * tolerance
+   * \param[in] v1: reference values
+   * \param[in] v2: values
+   * \param[in] eps: tolerance, relative to the maximum absolute value of
+   * the reference values
+   */
+  static bool compare(const std::vector<double>& v1,
+                      const std::vector<double>& v2,
+                      const double eps) {
+    if (v1.size() != v2.size()) {
+      return false;
+    }
+    auto m = double{};
+    for (const auto& v : v1) {
+      m = std::max(m, std::abs(v));
+    }
+    for (std::size_t i = 0; i != v1.size(); ++i) {
+      if (std::abs(v1[i] - v2[i]) > eps * m) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of compare
+  //! \brief multiaxial loading leading to significant viscoplastic strains
+  void test1() {
+    constexpr auto nsteps = 10;
+    const auto deto =
+        std::vector<double>{4e-5, -1e-5, -2e-5, 3e-5, 1e-5, -2e-5};
+    auto s1 = State{};
+    auto s2 = State{};
+    for (int i = 0; i != nsteps; ++i) {
+      TFEL_TESTS_ASSERT(integrate(s1, "ImplicitNorton", deto, 1) == 1);
+      TFEL_TESTS_ASSERT(integrate(s2, "ImplicitNorton_JacobianBlockStructure",
+                                  deto, 1) == 1);
+      TFEL_TESTS_ASSERT(compare(s1.sig, s2.sig, 1e-10));
+      TFEL_TESTS_ASSERT(compare(s1.isvs, s2.isvs, 1e-10));
+      TFEL_TESTS_ASSERT(compare(s1.K, s2.K, 1e-8));
+    }
+    // the viscoplastic strain must be significant for this test to be
+    // meaningful
+    TFEL_TESTS_ASSERT(s1.isvs[6] > 1e-5);
+  }  // end of test1
+};
+
+TFEL_TESTS_GENERATE_PROXY(JacobianBlockStructureTest,
+                          "JacobianBlockStructureTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "JacobianBlockStructureTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("JacobianBlockStructureTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
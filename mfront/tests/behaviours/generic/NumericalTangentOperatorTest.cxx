@@ -0,0 +1,167 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/NumericalTangentOperatorTest.cxx
+ * \brief  This test checks that the numerical approximation of the tangent
+ * operator computed by several threads is equal to the one computed by a
+ * single thread and to the tangent operator returned by the behaviour.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <map>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
+#include "MTest/StudyCurrentState.hxx"
+#include "MTest/StructureCurrentState.hxx"
+#include "MTest/MTest.hxx"
+
+//! \brief path to the library containing the `ImplicitNorton` behaviour
+static std::string library;
+//! \brief directory containing the input files
+static std::string srcdir;
+
+/*!
+ * \brief an `MTest` object which, each time the consistent tangent operator
+ * is computed, compares the numerical approximation of the tangent operator
+ * computed by the thread pool to the one computed by a single thread, and
+ * to the tangent operator returned by the behaviour.
+ */
+struct CheckedMTest final : public mtest::MTest {
+  [[nodiscard]] std::pair<bool, mtest::real> computeStiffnessMatrixAndResidual(
+      mtest::StudyCurrentState& state,
+      tfel::math::matrix<mtest::real>& k,
+      tfel::math::vector<mtest::real>& r,
+      const mtest::real t,
+      const mtest::real dt,
+      const mtest::StiffnessMatrixType mt) const override {
+    auto& scs = state.getStructureCurrentState("");
+    auto& bwk = scs.getBehaviourWorkSpace();
+    // columns which are not computed are detected
+    std::fill(bwk.nk.begin(), bwk.nk.end(),
+              std::numeric_limits<mtest::real>::quiet_NaN());
+    const auto rb =
+        mtest::MTest::computeStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+    if ((!rb.first) ||
+        (mt != mtest::StiffnessMatrixType::CONSISTENTTANGENTOPERATOR)) {
+      return rb;
+    }
+    const auto& s1 = scs.istates[0];
+    const auto ndv = this->b->getGradientsSize();
+    const auto nth = this->b->getThermodynamicForcesSize();
+    auto nk = bwk.nk;
+    std::fill(nk.begin(), nk.end(),
+              std::numeric_limits<mtest::real>::quiet_NaN());
+    auto s = s1;
+    if (!this->computeNumericalTangentOperatorColumns(
+            nk, s, scs.getBehaviourWorkSpace(1), s1, dt, mt, 0, ndv)) {
+      ++(this->failures);
+      return rb;
+    }
+    // the criterion used to compare the numerical approximation to the
+    // tangent operator returned by the behaviour is relative to the largest
+    // component of the tangent operator
+    auto kmax = mtest::real{};
+    for (size_type i = 0; i != nth; ++i) {
+      for (size_type j = 0; j != ndv; ++j) {
+        kmax = std::max(kmax, std::abs(bwk.k(i, j)));
+      }
+    }
+    for (size_type i = 0; i != nth; ++i) {
+      for (size_type j = 0; j != ndv; ++j) {
+        const auto e1 = std::abs(bwk.nk(i, j) - nk(i, j));
+        const auto e2 = std::abs(bwk.k(i, j) - bwk.nk(i, j));
+        if (!((e1 <= this->rounding_eps * std::abs(nk(i, j))) &&
+              (e2 <= this->eps * kmax))) {
+          ++(this->failures);
+        }
+      }
+    }
+    ++(this->comparisons);
+    return rb;
+  }  // end of computeStiffnessMatrixAndResidual
+  //! \brief number of comparisons of the tangent operators
+  mutable int comparisons = 0;
+  //! \brief number of failed comparisons
+  mutable int failures = 0;
+  //! \brief relative criterion used to compare the threaded computations
+  mtest::real rounding_eps = 10 * std::numeric_limits<mtest::real>::epsilon();
+  /*!
+   * \brief criterion used to compare the numerical approximation to the
+   * tangent operator returned by the behaviour, relative to the largest
+   * component of this tangent operator
+   */
+  mtest::real eps = 1e-5;
+};  // end of CheckedMTest
+
+struct NumericalTangentOperatorTest final : public tfel::tests::TestCase {
+  NumericalTangentOperatorTest()
+      : tfel::tests::TestCase("MTest", "NumericalTangentOperatorTest") {
+  }  // end of NumericalTangentOperatorTest
+  tfel::tests::TestResult execute() override {
+    for (const auto n : {2, 4, 5}) {
+      // forward difference scheme
+      this->check("implicitnorton7", n, 1.e-5);
+      // centred difference scheme
+      this->check("implicitnorton8", n, 1.e-8);
+    }
+    return this->result;
+  }  // end of execute()
+
+ private:
+  /*!
+   * \brief run the given test case using the given number of threads
+   * \param[in] f: test case
+   * \param[in] n: number of threads
+   * \param[in] eps: criterion used to compare the numerical approximation
+   * to the tangent operator returned by the behaviour
+   */
+  void check(const std::string& f, const int n, const mtest::real eps) {
+    auto t = CheckedMTest{};
+    t.eps = eps;
+    t.readInputFile(
+        srcdir + "/" + f + ".mtest", {},
+        {{"@library@", "\"" + library + "\""},
+         {"@xml_output@",
+          "\"" + f + "-" + std::to_string(n) + "-threads.xml\""}});
+    t.setNumberOfThreads(n);
+    TFEL_TESTS_ASSERT(t.execute().success());
+    TFEL_TESTS_ASSERT(t.comparisons > 0);
+    TFEL_TESTS_ASSERT(t.failures == 0);
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(NumericalTangentOperatorTest,
+                          "NumericalTangentOperatorTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 3) {
+    std::cerr << "NumericalTangentOperatorTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  srcdir = argv[2];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("NumericalTangentOperatorTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
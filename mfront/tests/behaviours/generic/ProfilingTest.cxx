@@ -0,0 +1,167 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/ProfilingTest.cxx
+ * \brief  This test checks that the profiling measures of a behaviour
+ * generated with the `@Profiling` keyword can be queried and reset through
+ * the `ExternalLibraryManager` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief path to the library containing the `ProfilerTest3` behaviour
+static std::string library;
+
+struct ProfilingTest final : public tfel::tests::TestCase {
+  ProfilingTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour", "ProfilingTest") {
+  }  // end of ProfilingTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief name of the profiled behaviour
+  static constexpr const char* const b = "ProfilerTest3";
+  //! \return the measures of the given code block
+  static std::pair<intmax_t, intmax_t> getMeasures(const std::string& n) {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto blocks = elm.getProfilingCodeBlocks(library, b);
+    auto calls = std::vector<intmax_t>{};
+    auto times = std::vector<intmax_t>{};
+    elm.getProfilingMeasures(calls, times, library, b);
+    const auto p = std::find(blocks.begin(), blocks.end(), n);
+    if ((p == blocks.end()) || (calls.size() != blocks.size()) ||
+        (times.size() != blocks.size())) {
+      return {-1, -1};
+    }
+    const auto i = static_cast<std::size_t>(p - blocks.begin());
+    return {calls[i], times[i]};
+  }  // end of getMeasures
+  //! \brief integrate the behaviour over one time step
+  static int integrate() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct = elm.getGenericBehaviourFunction(
+        library, "ProfilerTest3_Tridimensional");
+    // the arrays are large enough for the gradients (deformation
+    // gradient), the thermodynamic forces (Cauchy stress) and the tangent
+    // operator of the behaviour.
+    auto F0 = std::vector<double>{1, 1, 1, 0, 0, 0, 0, 0, 0};
+    auto F1 = std::vector<double>{1.001, 1, 1, 0, 0, 0, 0, 0, 0};
+    auto sig0 = std::vector<double>(9, 0.);
+    auto sig1 = std::vector<double>(9, 0.);
+    auto mp = std::vector<double>{150e9, 0.3};
+    auto esv = std::vector<double>{293.15};
+    auto K = std::vector<double>(81, 0.);
+    auto rdt = double{1};
+    auto scalars = std::vector<double>(5, 0.);
+    char msg[512] = {};
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = msg;
+    d.dt = 1;
+    d.rdt = &rdt;
+    d.K = K.data();
+    d.speed_of_sound = &scalars[0];
+    d.s0.gradients = F0.data();
+    d.s1.gradients = F1.data();
+    d.s0.thermodynamic_forces = sig0.data();
+    d.s1.thermodynamic_forces = sig1.data();
+    d.s0.mass_density = &scalars[1];
+    d.s1.mass_density = &scalars[1];
+    d.s0.material_properties = mp.data();
+    d.s1.material_properties = mp.data();
+    d.s0.internal_state_variables = nullptr;
+    d.s1.internal_state_variables = nullptr;
+    d.s0.stored_energy = &scalars[2];
+    d.s1.stored_energy = &scalars[3];
+    d.s0.dissipated_energy = &scalars[4];
+    d.s1.dissipated_energy = &scalars[4];
+    d.s0.external_state_variables = esv.data();
+    d.s1.external_state_variables = esv.data();
+    return fct(&d);
+  }  // end of integrate
+  //! \brief measures of a profiled behaviour
+  void test1() {
+    constexpr auto n = intmax_t{3};
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    TFEL_TESTS_ASSERT(elm.hasProfilingSupport(library, b));
+    const auto blocks = elm.getProfilingCodeBlocks(library, b);
+    TFEL_TESTS_ASSERT(std::find(blocks.begin(), blocks.end(), "TotalTime") !=
+                      blocks.end());
+    elm.resetProfilingMeasures(library, b);
+    TFEL_TESTS_ASSERT(getMeasures("TotalTime").first == 0);
+    for (intmax_t i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(integrate() == 1);
+    }
+    const auto m = getMeasures("TotalTime");
+    TFEL_TESTS_ASSERT(m.first == n);
+    TFEL_TESTS_ASSERT(m.second >= 0);
+    TFEL_TESTS_ASSERT(getMeasures("Integrator").first == n);
+    // reset
+    elm.resetProfilingMeasures(library, b);
+    TFEL_TESTS_ASSERT(getMeasures("TotalTime").first == 0);
+    TFEL_TESTS_ASSERT(integrate() == 1);
+    TFEL_TESTS_ASSERT(getMeasures("TotalTime").first == 1);
+  }  // end of test1
+  //! \brief behaviour without profiling support
+  void test2() {
+    constexpr auto b2 = "ImplicitNorton";
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    TFEL_TESTS_ASSERT(!elm.hasProfilingSupport(library, b2));
+    // the error message must describe the failed lookup, even if the
+    // symbol has already been looked up
+    for (int i = 0; i != 2; ++i) {
+      auto msg = std::string{};
+      try {
+        elm.resetProfilingMeasures(library, b2);
+      } catch (std::exception& e) {
+        msg = e.what();
+      }
+      TFEL_TESTS_ASSERT(msg.find("ImplicitNorton_mfront_profiling_reset") !=
+                        std::string::npos);
+    }
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(ProfilingTest, "ProfilingTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "ProfilingTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ProfilingTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
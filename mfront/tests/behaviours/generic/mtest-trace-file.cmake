@@ -0,0 +1,95 @@
+# This script checks the `--trace-file` option of mtest. The trace file,
+# written using the Chrome trace format, is parsed and the following
+# points are checked:
+#
+# - every event is a complete event (`ph` is `X`) with a name, a
+#   category, a non negative start time and a non negative duration.
+# - the expected events (parsing of the input file, time steps,
+#   iterations, outputs) are present.
+#
+# arguments checking
+if(NOT MTEST)
+  message(FATAL_ERROR "Require MTEST to be defined")
+endif(NOT MTEST)
+if(NOT LIBRARY)
+  message(FATAL_ERROR "Require LIBRARY to be defined")
+endif(NOT LIBRARY)
+if(NOT SOURCE_DIR)
+  message(FATAL_ERROR "Require SOURCE_DIR to be defined")
+endif(NOT SOURCE_DIR)
+
+set(trace_file "implicitnorton-trace.json")
+file(REMOVE "${trace_file}")
+execute_process(
+  COMMAND ${MTEST} --verbose=level0 --xml-output=false
+  --result-file-output=false --trace-file=${trace_file}
+  "--@library@=\"${LIBRARY}\""
+  "--@xml_output@=\"implicitnorton-trace.xml\""
+  "${SOURCE_DIR}/implicitnorton.mtest"
+  OUTPUT_VARIABLE TEST_OUTPUT
+  ERROR_VARIABLE TEST_ERROR
+  RESULT_VARIABLE TEST_RESULT)
+if(TEST_RESULT)
+  message(FATAL_ERROR "Failed: ${MTEST} exited != 0.\n"
+    "${TEST_OUTPUT}\n${TEST_ERROR}")
+endif(TEST_RESULT)
+if(NOT EXISTS "${trace_file}")
+  message(FATAL_ERROR "Failed: file '${trace_file}' not generated")
+endif(NOT EXISTS "${trace_file}")
+
+# the `string(JSON)` command raises an error if the file is not well formed
+file(READ "${trace_file}" trace)
+string(JSON unit GET "${trace}" "displayTimeUnit")
+if(NOT unit STREQUAL "ms")
+  message(FATAL_ERROR "Failed: invalid display time unit '${unit}'")
+endif(NOT unit STREQUAL "ms")
+string(JSON nevents LENGTH "${trace}" "traceEvents")
+if(nevents EQUAL 0)
+  message(FATAL_ERROR "Failed: no event recorded")
+endif(nevents EQUAL 0)
+foreach(name Parsing LoadBehaviour TimeStep NewtonIteration
+    computeStiffnessMatrixAndResidual LinearSolve Output)
+  set(count_${name} 0)
+endforeach(name)
+math(EXPR last "${nevents} - 1")
+foreach(i RANGE ${last})
+  string(JSON event GET "${trace}" "traceEvents" ${i})
+  string(JSON name GET "${event}" "name")
+  string(JSON category GET "${event}" "cat")
+  string(JSON phase GET "${event}" "ph")
+  if((NOT category STREQUAL "mtest") OR (NOT phase STREQUAL "X"))
+    message(FATAL_ERROR "Failed: invalid event '${event}'")
+  endif((NOT category STREQUAL "mtest") OR (NOT phase STREQUAL "X"))
+  foreach(member ts dur pid tid)
+    string(JSON type TYPE "${event}" "${member}")
+    string(JSON value GET "${event}" "${member}")
+    if((NOT type STREQUAL "NUMBER") OR (NOT value MATCHES "^[0-9]+$"))
+      message(FATAL_ERROR "Failed: invalid value for member "
+        "'${member}' of event '${event}'")
+    endif((NOT type STREQUAL "NUMBER") OR (NOT value MATCHES "^[0-9]+$"))
+  endforeach(member)
+  if(DEFINED count_${name})
+    math(EXPR count_${name} "${count_${name}} + 1")
+  endif(DEFINED count_${name})
+endforeach(i)
+
+# the input file is parsed once and defines 20 time steps. The results are
+# written at the beginning of the computation and at the end of each time
+# step.
+foreach(check "Parsing;1" "LoadBehaviour;1" "TimeStep;20" "Output;21")
+  list(GET check 0 name)
+  list(GET check 1 expected)
+  if(NOT count_${name} EQUAL expected)
+    message(FATAL_ERROR "Failed: ${count_${name}} '${name}' events found, "
+      "${expected} expected")
+  endif(NOT count_${name} EQUAL expected)
+endforeach(check)
+# at least one iteration per time step
+foreach(name NewtonIteration computeStiffnessMatrixAndResidual LinearSolve)
+  if(count_${name} LESS 20)
+    message(FATAL_ERROR "Failed: ${count_${name}} '${name}' events found, "
+      "at least 20 expected")
+  endif(count_${name} LESS 20)
+endforeach(name)
+
+message(STATUS "Passed")
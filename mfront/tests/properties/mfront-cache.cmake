@@ -0,0 +1,153 @@
+# This script checks the code generation cache of mfront (`--cache`
+# option). The following cases are considered:
+#
+# - hit: the second treatment of an input file is skipped.
+# - dependency: modifying a file on which the input file depends, here a
+#   material law, invalidates the entry of the cache.
+# - missing-output: removing a generated file invalidates the entry of the
+#   cache.
+# - mtime: the modification time of a generated file is preserved by a
+#   cache hit and by a treatment regenerating identical outputs, so that
+#   the build system does not recompile it. It changes when the input file
+#   is modified.
+#
+# arguments checking
+if(NOT MFRONT)
+  message(FATAL_ERROR "Require MFRONT to be defined")
+endif(NOT MFRONT)
+if(NOT SOURCE_DIR)
+  message(FATAL_ERROR "Require SOURCE_DIR to be defined")
+endif(NOT SOURCE_DIR)
+if(NOT CACHE_TEST)
+  message(FATAL_ERROR "Require CACHE_TEST to be defined")
+endif(NOT CACHE_TEST)
+
+set(mfront_file "VanadiumAlloy_ShearModulus_SRMA.mfront")
+set(mfront_output "src/VanadiumAlloy_ShearModulus_SRMA-generic.cxx")
+# the input files are copied so that they can be modified
+file(REMOVE_RECURSE "${CACHE_TEST}")
+file(MAKE_DIRECTORY "${CACHE_TEST}/inputs")
+foreach(f ${mfront_file}
+    VanadiumAlloy_YoungModulus_SRMA.mfront
+    VanadiumAlloy_PoissonRatio_SRMA.mfront)
+  configure_file("${SOURCE_DIR}/${f}" "${CACHE_TEST}/inputs/${f}" COPYONLY)
+endforeach(f)
+
+# treat the input file and set the variable `is_up_to_date` in the parent
+# scope if the treatment of the input file has been skipped
+function(call_mfront)
+  execute_process(
+    COMMAND ${MFRONT} --cache --verbose=level2 --interface=generic
+    --search-path=inputs "inputs/${mfront_file}"
+    WORKING_DIRECTORY "${CACHE_TEST}"
+    OUTPUT_VARIABLE TEST_OUTPUT
+    ERROR_VARIABLE TEST_ERROR
+    RESULT_VARIABLE TEST_RESULT)
+  if(TEST_RESULT)
+    message(FATAL_ERROR "Failed: ${MFRONT} exited != 0.\n${TEST_ERROR}")
+  endif(TEST_RESULT)
+  if(NOT EXISTS "${CACHE_TEST}/${mfront_output}")
+    message(FATAL_ERROR "Failed: file '${mfront_output}' not generated")
+  endif(NOT EXISTS "${CACHE_TEST}/${mfront_output}")
+  string(FIND "${TEST_OUTPUT}" "is up to date" pos)
+  if(pos EQUAL -1)
+    set(is_up_to_date FALSE PARENT_SCOPE)
+  else(pos EQUAL -1)
+    set(is_up_to_date TRUE PARENT_SCOPE)
+  endif(pos EQUAL -1)
+endfunction(call_mfront)
+
+# set the variable `output_mtime` in the parent scope to the modification
+# time of the generated file, in seconds
+function(get_output_mtime)
+  file(TIMESTAMP "${CACHE_TEST}/${mfront_output}" t "%s" UTC)
+  set(output_mtime "${t}" PARENT_SCOPE)
+endfunction(get_output_mtime)
+
+# wait long enough so that rewriting a file changes its modification time
+function(wait_for_mtime_change)
+  execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 2)
+endfunction(wait_for_mtime_change)
+
+# first treatment
+call_mfront()
+if(is_up_to_date)
+  message(FATAL_ERROR "Failed: the cache shall be empty")
+endif(is_up_to_date)
+
+if(CACHE_TEST STREQUAL "hit")
+  call_mfront()
+  if(NOT is_up_to_date)
+    message(FATAL_ERROR "Failed: the treatment of '${mfront_file}' "
+      "shall have been skipped")
+  endif(NOT is_up_to_date)
+elseif(CACHE_TEST STREQUAL "dependency")
+  file(APPEND "${CACHE_TEST}/inputs/VanadiumAlloy_PoissonRatio_SRMA.mfront"
+    "\n// modified\n")
+  call_mfront()
+  if(is_up_to_date)
+    message(FATAL_ERROR "Failed: a modification of a material law "
+      "shall invalidate the entry of '${mfront_file}'")
+  endif(is_up_to_date)
+  call_mfront()
+  if(NOT is_up_to_date)
+    message(FATAL_ERROR "Failed: the treatment of '${mfront_file}' "
+      "shall have been skipped")
+  endif(NOT is_up_to_date)
+elseif(CACHE_TEST STREQUAL "missing-output")
+  file(REMOVE "${CACHE_TEST}/${mfront_output}")
+  call_mfront()
+  if(is_up_to_date)
+    message(FATAL_ERROR "Failed: a missing output "
+      "shall invalidate the entry of '${mfront_file}'")
+  endif(is_up_to_date)
+elseif(CACHE_TEST STREQUAL "mtime")
+  get_output_mtime()
+  set(mtime0 "${output_mtime}")
+  # cache hit
+  wait_for_mtime_change()
+  call_mfront()
+  if(NOT is_up_to_date)
+    message(FATAL_ERROR "Failed: the treatment of '${mfront_file}' "
+      "shall have been skipped")
+  endif(NOT is_up_to_date)
+  get_output_mtime()
+  if(NOT output_mtime EQUAL mtime0)
+    message(FATAL_ERROR "Failed: a cache hit shall not modify "
+      "'${mfront_output}'")
+  endif(NOT output_mtime EQUAL mtime0)
+  # the modification of a comment of a dependency invalidates the entry of
+  # the cache but does not change the generated file
+  wait_for_mtime_change()
+  file(APPEND "${CACHE_TEST}/inputs/VanadiumAlloy_PoissonRatio_SRMA.mfront"
+    "\n// modified\n")
+  call_mfront()
+  if(is_up_to_date)
+    message(FATAL_ERROR "Failed: a modification of a material law "
+      "shall invalidate the entry of '${mfront_file}'")
+  endif(is_up_to_date)
+  get_output_mtime()
+  if(NOT output_mtime EQUAL mtime0)
+    message(FATAL_ERROR "Failed: the modification time of "
+      "'${mfront_output}' shall be preserved when its content is unchanged")
+  endif(NOT output_mtime EQUAL mtime0)
+  # a real change of the input file
+  wait_for_mtime_change()
+  file(READ "${CACHE_TEST}/inputs/${mfront_file}" input)
+  string(REPLACE "G = E/(2.*(1+n));" "G = E/(2*(1+n));" input "${input}")
+  file(WRITE "${CACHE_TEST}/inputs/${mfront_file}" "${input}")
+  call_mfront()
+  if(is_up_to_date)
+    message(FATAL_ERROR "Failed: a modification of '${mfront_file}' "
+      "shall invalidate its entry")
+  endif(is_up_to_date)
+  get_output_mtime()
+  if(output_mtime EQUAL mtime0)
+    message(FATAL_ERROR "Failed: the modification time of "
+      "'${mfront_output}' shall change with its content")
+  endif(output_mtime EQUAL mtime0)
+else(CACHE_TEST STREQUAL "hit")
+  message(FATAL_ERROR "Unsupported test '${CACHE_TEST}'")
+endif(CACHE_TEST STREQUAL "hit")
+
+message(STATUS "Passed")
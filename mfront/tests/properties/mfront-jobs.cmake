@@ -0,0 +1,55 @@
+# This script checks that treating several input files in parallel
+# (`--jobs` option) gives the same outputs than treating them sequentially.
+#
+# arguments checking
+if(NOT MFRONT)
+  message(FATAL_ERROR "Require MFRONT to be defined")
+endif(NOT MFRONT)
+if(NOT INTERFACE)
+  message(FATAL_ERROR "Require INTERFACE to be defined")
+endif(NOT INTERFACE)
+if(NOT SEARCH_PATH)
+  message(FATAL_ERROR "Require SEARCH_PATH to be defined")
+endif(NOT SEARCH_PATH)
+if(NOT MFRONT_FILES)
+  message(FATAL_ERROR "Require MFRONT_FILES to be defined")
+endif(NOT MFRONT_FILES)
+string(REPLACE "," ";" mfront_files "${MFRONT_FILES}")
+
+foreach(mode sequential jobs)
+  file(REMOVE_RECURSE "${mode}")
+  file(MAKE_DIRECTORY "${mode}")
+  if(mode STREQUAL "jobs")
+    set(mfront_args "--jobs=4")
+  else(mode STREQUAL "jobs")
+    set(mfront_args "")
+  endif(mode STREQUAL "jobs")
+  execute_process(
+    COMMAND ${MFRONT} ${mfront_args} --interface=${INTERFACE}
+    --search-path=${SEARCH_PATH} ${mfront_files}
+    WORKING_DIRECTORY "${mode}"
+    OUTPUT_VARIABLE TEST_OUTPUT
+    ERROR_VARIABLE TEST_ERROR
+    RESULT_VARIABLE TEST_RESULT)
+  if(TEST_RESULT)
+    message(FATAL_ERROR "Failed: ${MFRONT} exited != 0 (${mode}).\n${TEST_ERROR}")
+  endif(TEST_RESULT)
+endforeach(mode)
+
+# the generated files and the targets description must be the same
+file(GLOB_RECURSE generated_files RELATIVE "${CMAKE_CURRENT_BINARY_DIR}/sequential"
+  "${CMAKE_CURRENT_BINARY_DIR}/sequential/*")
+list(LENGTH generated_files nb_generated_files)
+if(nb_generated_files EQUAL 0)
+  message(FATAL_ERROR "Failed: no file generated")
+endif(nb_generated_files EQUAL 0)
+foreach(f ${generated_files})
+  execute_process(
+    COMMAND ${CMAKE_COMMAND} -E compare_files "sequential/${f}" "jobs/${f}"
+    RESULT_VARIABLE TEST_RESULT)
+  if(TEST_RESULT)
+    message(FATAL_ERROR "Failed: file '${f}' differs when using the --jobs option")
+  endif(TEST_RESULT)
+endforeach(f)
+
+message(STATUS "Passed: ${nb_generated_files} files compared")
@@ -0,0 +1,163 @@
+/*!
+ * \file   mfront/tests/properties/test-generic-array.cxx
+ * \brief  This test checks that the evaluation of a material property over
+ * an array of points, generated by the `generic` interface, gives the same
+ * results than the evaluation of the material property at each point.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the library generated by the `generic` interface
+static std::string library;
+
+struct GenericArrayMaterialPropertyTest final : public tfel::tests::TestCase {
+  GenericArrayMaterialPropertyTest()
+      : tfel::tests::TestCase("MFront/GenericMaterialProperty",
+                              "GenericArrayMaterialPropertyTest") {
+  }  // end of GenericArrayMaterialPropertyTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief name of the tested material property
+  static constexpr const char* const mp = "VanadiumAlloy_YoungModulus_SRMA";
+  //! \brief reference value of the material property
+  static double E(const double T) {
+    return 127.8e9 * (1. - 7.825e-5 * (T - 293.15));
+  }  // end of E
+  //! \brief contiguous arguments
+  void test1() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto f = elm.getGenericMaterialProperty(library, mp);
+    const auto fa = elm.getGenericArrayMaterialProperty(library, mp);
+    const auto T = std::vector<double>{300, 400, 500, 600, 700, 800, 900};
+    const auto n = T.size();
+    auto E1 = std::vector<double>(n, 0.);
+    const double* const args[1] = {T.data()};
+    const mfront_gmp_size_type strides[1] = {1};
+    auto s = mfront_gmp_OutputStatus{};
+    const auto r = fa(&s, E1.data(), n, args, strides, 1,
+                      GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    TFEL_TESTS_ASSERT(r == n);
+    TFEL_TESTS_ASSERT(s.status == 0);
+    TFEL_TESTS_ASSERT(s.bounds_status == 0);
+    for (std::size_t i = 0; i != n; ++i) {
+      auto s2 = mfront_gmp_OutputStatus{};
+      const auto E2 =
+          f(&s2, &T[i], 1, GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+      TFEL_TESTS_ASSERT(s2.status == 0);
+      TFEL_TESTS_ASSERT(std::abs(E1[i] - E2) < 1.e-14 * E2);
+      TFEL_TESTS_ASSERT(std::abs(E1[i] - E(T[i])) < 1.e-14 * E(T[i]));
+    }
+  }  // end of test1
+  //! \brief the same value is used for all points (null stride)
+  void test2() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto fa = elm.getGenericArrayMaterialProperty(library, mp);
+    const auto T = double{600};
+    const auto n = std::size_t{4};
+    auto E1 = std::vector<double>(n, 0.);
+    const double* const args[1] = {&T};
+    const mfront_gmp_size_type strides[1] = {0};
+    auto s = mfront_gmp_OutputStatus{};
+    const auto r = fa(&s, E1.data(), n, args, strides, 1,
+                      GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    TFEL_TESTS_ASSERT(r == n);
+    TFEL_TESTS_ASSERT(s.status == 0);
+    for (const auto& v : E1) {
+      TFEL_TESTS_ASSERT(std::abs(v - E(T)) < 1.e-14 * E(T));
+    }
+  }  // end of test2
+  //! \brief strided arguments, e.g. a column of a row-major array
+  void test3() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto fa = elm.getGenericArrayMaterialProperty(library, mp);
+    // the temperature is stored every two values
+    const auto values = std::vector<double>{300, -1, 500, -1, 700, -1};
+    const auto n = std::size_t{3};
+    auto E1 = std::vector<double>(n, 0.);
+    const double* const args[1] = {values.data()};
+    const mfront_gmp_size_type strides[1] = {2};
+    auto s = mfront_gmp_OutputStatus{};
+    const auto r = fa(&s, E1.data(), n, args, strides, 1,
+                      GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    TFEL_TESTS_ASSERT(r == n);
+    TFEL_TESTS_ASSERT(s.status == 0);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto T = values[2 * i];
+      TFEL_TESTS_ASSERT(std::abs(E1[i] - E(T)) < 1.e-14 * E(T));
+    }
+  }  // end of test3
+  //! \brief failures
+  void test4() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto fa = elm.getGenericArrayMaterialProperty(library, mp);
+    const auto T = std::vector<double>{300, 400, -10, 600};
+    const auto n = T.size();
+    auto E1 = std::vector<double>(n, 0.);
+    const double* const args[1] = {T.data()};
+    const mfront_gmp_size_type strides[1] = {1};
+    // the third point is out of the physical bounds
+    auto s = mfront_gmp_OutputStatus{};
+    const auto r = fa(&s, E1.data(), n, args, strides, 1,
+                      GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    TFEL_TESTS_ASSERT(r == 2);
+    TFEL_TESTS_ASSERT(s.status == -1);
+    TFEL_TESTS_ASSERT(std::abs(E1[0] - E(T[0])) < 1.e-14 * E(T[0]));
+    TFEL_TESTS_ASSERT(std::abs(E1[1] - E(T[1])) < 1.e-14 * E(T[1]));
+    TFEL_TESTS_ASSERT(std::isnan(E1[2]));
+    TFEL_TESTS_ASSERT(std::isnan(E1[3]));
+    // invalid number of arguments
+    auto s2 = mfront_gmp_OutputStatus{};
+    const auto r2 = fa(&s2, E1.data(), n, args, strides, 2,
+                       GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    TFEL_TESTS_ASSERT(r2 == 0);
+    TFEL_TESTS_ASSERT(s2.status == -5);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenericArrayMaterialPropertyTest,
+                          "GenericArrayMaterialPropertyTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "test-generic-array: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("GenericArrayMaterialProperty.xml");
+  const auto r = manager.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
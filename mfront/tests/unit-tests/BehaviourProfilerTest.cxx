@@ -0,0 +1,157 @@
+/*!
+ * \file   mfront/tests/unit-tests/BehaviourProfilerTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/BehaviourProfiler.hxx"
+
+struct BehaviourProfilerTest final : public tfel::tests::TestCase {
+  BehaviourProfilerTest()
+      : tfel::tests::TestCase("MFront", "BehaviourProfilerTest") {
+  }  // end of BehaviourProfilerTest
+
+  tfel::tests::TestResult execute() override {
+#if !(defined _WIN32 || defined _WIN64)
+    this->test1();
+#endif
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+#if !(defined _WIN32 || defined _WIN64)
+  // measures made by several threads are merged in the CSV output
+  void test1() {
+    using mfront::BehaviourProfiler;
+    const auto f = std::string{"BehaviourProfilerTest.csv"};
+    std::remove(f.c_str());
+    ::setenv("MFRONT_PROFILING_OUTPUT_FORMAT", "csv", 1);
+    ::setenv("MFRONT_PROFILING_OUTPUT_FILE", f.c_str(), 1);
+    constexpr auto nthreads = 4u;
+    constexpr auto ncalls = 100u;
+    {
+      BehaviourProfiler p("ProfilerUnitTest");
+      auto threads = std::vector<std::thread>{};
+      for (auto t = 0u; t != nthreads; ++t) {
+        threads.emplace_back([&p] {
+          for (auto i = 0u; i != ncalls; ++i) {
+            BehaviourProfiler::Timer timer(p, BehaviourProfiler::FLOWRULE);
+            p.addNumberOfIterations(3);
+          }
+          p.addNumberOfIterations(1000);
+        });
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    }
+    ::unsetenv("MFRONT_PROFILING_OUTPUT_FORMAT");
+    ::unsetenv("MFRONT_PROFILING_OUTPUT_FILE");
+    // reading the results
+    std::ifstream in(f);
+    TFEL_TESTS_ASSERT(static_cast<bool>(in));
+    auto line = std::string{};
+    std::getline(in, line);
+    TFEL_TESTS_ASSERT(line ==
+                      "behaviour,code_block,calls,time,"
+                      "bin_lower_bound,bin_count");
+    auto calls = std::map<std::string, long long>{};
+    auto counts = std::map<std::string, long long>{};
+    auto iterations = std::map<long long, long long>{};
+    while (std::getline(in, line)) {
+      auto columns = std::vector<std::string>{};
+      std::istringstream l(line);
+      auto c = std::string{};
+      while (std::getline(l, c, ',')) {
+        columns.push_back(c);
+      }
+      TFEL_TESTS_ASSERT(columns.size() == 6u);
+      if (columns.size() != 6u) {
+        continue;
+      }
+      TFEL_TESTS_ASSERT(columns[0] == "ProfilerUnitTest");
+      calls[columns[1]] = std::stoll(columns[2]);
+      counts[columns[1]] += std::stoll(columns[5]);
+      if (columns[1] == "ImplicitSchemeIterations") {
+        iterations[std::stoll(columns[4])] = std::stoll(columns[5]);
+      }
+    }
+    TFEL_TESTS_ASSERT(calls["FlowRule"] == nthreads * ncalls);
+    TFEL_TESTS_ASSERT(counts["FlowRule"] == nthreads * ncalls);
+    TFEL_TESTS_ASSERT(calls["ImplicitSchemeIterations"] ==
+                      nthreads * (ncalls + 1));
+    TFEL_TESTS_ASSERT(iterations.size() == 2u);
+    TFEL_TESTS_ASSERT(iterations[3] == nthreads * ncalls);
+    TFEL_TESTS_ASSERT(
+        iterations[BehaviourProfiler::maximumNumberOfIterations] == nthreads);
+    in.close();
+    std::remove(f.c_str());
+  }  // end of test1
+#endif
+  // snapshots and reset of the measures
+  void test2() {
+    using mfront::BehaviourProfiler;
+    BehaviourProfiler p("ProfilerUnitTest2");
+    auto run = [&p](const unsigned int n) {
+      for (auto i = 0u; i != n; ++i) {
+        BehaviourProfiler::Timer timer(p, BehaviourProfiler::COMPUTEFDF);
+      }
+      p.addNumberOfIterations(2);
+    };
+    run(10);
+    p.addJacobianReuseStatistics(2, 3);
+    const auto s1 = p.getSummary();
+    TFEL_TESTS_ASSERT(s1.blocks[BehaviourProfiler::COMPUTEFDF].calls == 10);
+    TFEL_TESTS_ASSERT(s1.blocks[BehaviourProfiler::FLOWRULE].calls == 0);
+    TFEL_TESTS_ASSERT(s1.iterations[2] == 1);
+    TFEL_TESTS_ASSERT(s1.jacobianDecompositions == 2);
+    TFEL_TESTS_ASSERT(s1.jacobianReuses == 3);
+    p.reset();
+    const auto s2 = p.getSummary();
+    TFEL_TESTS_ASSERT(s2.blocks[BehaviourProfiler::COMPUTEFDF].calls == 0);
+    TFEL_TESTS_ASSERT(s2.blocks[BehaviourProfiler::COMPUTEFDF].time == 0);
+    TFEL_TESTS_ASSERT(s2.iterations[2] == 0);
+    TFEL_TESTS_ASSERT(s2.jacobianReuses == 0);
+    std::thread([&run] { run(5); }).join();
+    const auto s3 = p.getSummary();
+    TFEL_TESTS_ASSERT(s3.blocks[BehaviourProfiler::COMPUTEFDF].calls == 5);
+    TFEL_TESTS_ASSERT(s3.iterations[2] == 1);
+    TFEL_TESTS_ASSERT(std::string(BehaviourProfiler::getCodeBlockName(
+                          BehaviourProfiler::COMPUTEFDF)) ==
+                      "Integrator::ComputeFdF");
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BehaviourProfilerTest, "BehaviourProfilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BehaviourProfiler.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,94 @@
+/*!
+ * \file   BorderedBandMatrixSolver.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BORDEREDBANDMATRIXSOLVER_HXX
+#define LIB_MTEST_BORDEREDBANDMATRIXSOLVER_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a linear solver dedicated to bordered banded matrices, i.e.
+   * matrices of the form:
+   *
+   * \f[
+   * \begin{pmatrix}
+   * A   & b \\
+   * c^T & d
+   * \end{pmatrix}
+   * \f]
+   *
+   * where \f$A\f$ is a banded matrix. Such matrices are built by the
+   * `PipeTest` class: the radial displacements of the nodes are only coupled
+   * to their neighbours, whereas the axial strain is coupled to all the
+   * nodes.
+   *
+   * The last unknown is eliminated using a Schur complement and \f$A\f$ is
+   * factorized using a banded LU decomposition with partial pivoting. The
+   * cost of the factorization and of the resolution is linear in the size
+   * of the matrix.
+   */
+  struct MTEST_VISIBILITY_EXPORT BorderedBandMatrixSolver {
+    //! \brief a simple alias
+    using size_type = tfel::math::matrix<real>::size_type;
+    /*!
+     * \brief factorize the given matrix
+     * \param[in] K: matrix. Only the band of the first block and the last
+     * row and column are read.
+     * \param[in] w: half-bandwidth of the first block
+     */
+    void factorize(const tfel::math::matrix<real>&, const size_type);
+    /*!
+     * \brief solve the linear system using the last factorization
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    void solve(tfel::math::vector<real>&) const;
+
+   private:
+    //! \return the LU factor at the given position
+    real& lu(const size_type, const size_type);
+    //! \return the LU factor at the given position
+    const real& lu(const size_type, const size_type) const;
+    /*!
+     * \brief solve the linear system associated with the first block
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    void solveFirstBlock(real* const) const;
+    //! \brief size of the first block
+    size_type n = 0;
+    //! \brief half-bandwidth of the first block
+    size_type w = 0;
+    /*!
+     * \brief LU factors of the first block, stored by rows. The \f$i\f$-th
+     * row stores the columns \f$i-w\f$ to \f$i+2\,w\f$, to handle the fill-in
+     * due to row interchanges.
+     */
+    std::vector<real> factors;
+    //! \brief row interchanges
+    std::vector<size_type> pivots;
+    //! \brief solution of \f$A\,z=b\f$
+    std::vector<real> z;
+    //! \brief last row of the matrix, without its last component
+    std::vector<real> c;
+    //! \brief Schur complement \f$d-c^{T}\,z\f$
+    real schur = real(0);
+  };  // end of struct BorderedBandMatrixSolver
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BORDEREDBANDMATRIXSOLVER_HXX */
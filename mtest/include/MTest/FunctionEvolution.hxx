@@ -14,6 +14,10 @@
 #ifndef LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 #define LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <string>
 #include "TFEL/Math/Evaluator.hxx"
 
 #include "MTest/Config.hxx"
@@ -37,10 +41,26 @@ namespace mtest {
     ~FunctionEvolution() override;
 
    private:
+    //! \brief a simple alias
+    using EvaluationContext = tfel::math::Evaluator::EvaluationContext;
+    /*!
+     * \return the evaluation context associated with the current thread.
+     * This context is built at the first call of this method by the
+     * current thread and is reused by the following calls.
+     */
+    EvaluationContext& getEvaluationContext() const;
     //! \brief externally defined evolutions
     const EvolutionManager& evm;
     //! \brief Evaluator
-    mutable tfel::math::Evaluator f;
+    tfel::math::Evaluator f;
+    //! \brief names of the variables of the formula
+    const std::vector<std::string> variables;
+    //! \brief identifier of the evolution
+    const std::size_t identifier;
+    //! \brief evaluation contexts built so far, one per thread
+    mutable std::vector<std::unique_ptr<EvaluationContext>> contexts;
+    //! \brief mutex protecting the `contexts` member
+    mutable std::mutex m;
   };
 
 }  // end of namespace mtest
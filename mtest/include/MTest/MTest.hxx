@@ -36,10 +36,19 @@
 #include "MTest/AccelerationAlgorithm.hxx"
 #include "MTest/SingleStructureScheme.hxx"
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   //! forward declaration
   struct UserDefinedPostProcessing;
+  //! forward declaration
+  struct BehaviourWorkSpace;
+  //! forward declaration
+  struct StructureCurrentState;
 
   /*!
    * \brief MTest is a simple class to test mfront behaviours.
@@ -179,6 +188,32 @@ namespace mtest {
      * \param[in] v : perturbation value
      */
     virtual void setNumericalTangentOperatorPerturbationValue(const real);
+    //! \brief finite difference schemes used to compute the numerical
+    //! approximation of the tangent operator
+    enum FiniteDifferenceScheme {
+      //! \brief forward difference, one integration per gradient component
+      FORWARDDIFFERENCE,
+      //! \brief centred difference, two integrations per gradient component
+      CENTREDDIFFERENCE
+    };  // end of FiniteDifferenceScheme
+    /*!
+     * \brief set the finite difference scheme used to build the numerical
+     * tangent operator. By default, a centred difference scheme is used.
+     * \param[in] s: finite difference scheme
+     */
+    virtual void setNumericalTangentOperatorFiniteDifferenceScheme(
+        const FiniteDifferenceScheme);
+    /*!
+     * \brief set the number of threads used to build the numerical tangent
+     * operator.
+     *
+     * The components of the gradients are split in contiguous blocks, one
+     * per thread. Each thread uses its own copy of the current state and
+     * its own behaviour workspace.
+     *
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const int);
     /*!
      * \brief set the rotation matrix
      * \param[in] r : rotation matrix
@@ -259,6 +294,41 @@ namespace mtest {
      * the number of lagrangian multipliers)
      */
     virtual size_t getNumberOfUnknowns() const override;
+    /*!
+     * \brief compute some columns of the numerical approximation of the
+     * tangent operator
+     * \return true on success
+     * \param[out] nk: numerical tangent operator
+     * \param[in,out] s: working state
+     * \param[in,out] wk: behaviour workspace
+     * \param[in] s1: state at the end of the time step
+     * \param[in] dt: time increment
+     * \param[in] mt: type of stiffness matrix
+     * \param[in] cb: first column
+     * \param[in] ce: past-the-end column
+     */
+    bool computeNumericalTangentOperatorColumns(tfel::math::matrix<real>&,
+                                                CurrentState&,
+                                                BehaviourWorkSpace&,
+                                                const CurrentState&,
+                                                const real,
+                                                const StiffnessMatrixType,
+                                                const size_type,
+                                                const size_type) const;
+    /*!
+     * \brief compute the numerical approximation of the tangent operator
+     * \return true on success
+     * \param[out] nk: numerical tangent operator
+     * \param[in] scs: structure current state
+     * \param[in] s1: state at the end of the time step
+     * \param[in] dt: time increment
+     * \param[in] mt: type of stiffness matrix
+     */
+    bool computeNumericalTangentOperator(tfel::math::matrix<real>&,
+                                         const StructureCurrentState&,
+                                         const CurrentState&,
+                                         const real,
+                                         const StiffnessMatrixType) const;
     //! list of events
     std::map<double, std::vector<std::string>> events;
     //! list of tests
@@ -281,6 +351,11 @@ namespace mtest {
     real pv = -1;
     //! compare to numerical jacobian
     bool cto = false;
+    //! \brief finite difference scheme used to build the numerical tangent
+    //! operator
+    FiniteDifferenceScheme fds = CENTREDDIFFERENCE;
+    //! \brief thread pool used to build the numerical tangent operator
+    std::unique_ptr<tfel::system::ThreadPool> pool;
   };  // end of struct MTest
 
 }  // end of namespace mtest
@@ -67,6 +67,8 @@ namespace mtest {
     ~MTestParser() override;
 
    protected:
+    // the overloads of the tokenizer shall not be hidden
+    using tfel::utilities::CxxTokenizer::parseString;
     //! a simple alias
     using CallBack = void (MTestParser::*)(MTest&, tokens_iterator&);
     /*!
@@ -105,6 +107,20 @@ namespace mtest {
      */
     virtual void handleNumericalTangentOperatorPerturbationValue(
         MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumericalTangentOperatorFiniteDifferenceScheme`
+     * keyword.
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumericalTangentOperatorFiniteDifferenceScheme(
+        MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(MTest&, tokens_iterator&);
     /*!
      * \brief handle the `@Test` keyword
      * \param[in,out] t: `MTest` object to be configured
@@ -29,6 +29,8 @@ namespace mtest {
   struct Behaviour;
   // forward declaration
   struct StructureCurrentState;
+  // forward declaration
+  struct BehaviourWorkSpace;
 
   /*!
    * \brief structure describing a linear element for pipes
@@ -100,6 +102,7 @@ namespace mtest {
      * \param[out] k:   stiffness matrix
      * \param[out] r:   residual
      * \param[out] scs: structure current state
+     * \param[in]  bwk: behaviour workspace
      * \param[in]  u1:  current displacement estimation
      * \param[in]  m:   pipe mesh
      * \param[in]  b:   behaviour
@@ -111,6 +114,7 @@ namespace mtest {
         tfel::math::matrix<real>&,
         tfel::math::vector<real>&,
         StructureCurrentState&,
+        BehaviourWorkSpace&,
         const Behaviour&,
         const tfel::math::vector<real>&,
         const PipeMesh&,
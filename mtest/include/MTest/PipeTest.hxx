@@ -16,7 +16,9 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 #include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
@@ -29,6 +31,11 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declarations
@@ -36,6 +43,8 @@ namespace mtest {
   struct GasEquationOfState;
   struct PipeFailureCriterion;
   struct OxidationStatusEvolution;
+  struct BehaviourWorkSpace;
+  struct StructureCurrentState;
 
   //! \brief a study describing mechanical tests on pipes
   struct MTEST_VISIBILITY_EXPORT PipeTest : public SingleStructureScheme {
@@ -79,6 +88,19 @@ namespace mtest {
                                         * optimizing material parameters.
                                         */
     };                                 // end of FailurePolicy
+    //! \brief linear solver used to solve the equilibrium equations
+    enum LinearSolver {
+      DENSE,  /*!<
+               * \brief the stiffness matrix is treated as a dense matrix and
+               * solved using a LU decomposition.
+               */
+      BANDED  /*!<
+               * \brief the stiffness matrix is treated as a banded matrix
+               * bordered by the line and the column associated with the axial
+               * strain. The cost of the resolution is linear in the number of
+               * nodes.
+               */
+    };        // end of LinearSolver
     //! \brief base class for tests
     struct UTest {
       /*!
@@ -154,6 +176,24 @@ namespace mtest {
      * \param[in] e: element type
      */
     virtual void setElementType(const PipeMesh::ElementType);
+    /*!
+     * \brief set the linear solver
+     * \param[in] s: linear solver
+     */
+    virtual void setLinearSolver(const LinearSolver);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour over
+     * the elements.
+     *
+     * The elements are split in contiguous blocks, one per thread. Each
+     * thread uses its own behaviour workspace and assembles the contributions
+     * of its elements in its own stiffness matrix and residual. Those are
+     * then summed in a fixed order, so the results are reproducible for a
+     * given number of threads.
+     *
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const int);
     /*!
      * \brief set the pipe axial loading
      * \param[in] al: axial loading
@@ -280,6 +320,9 @@ namespace mtest {
                                   const SolverOptions&,
                                   const real,
                                   const real) const override;
+    void solveLinearSystem(SolverWorkSpace&) const override;
+    void solveWithFactorizedStiffnessMatrix(
+        SolverWorkSpace&, tfel::math::vector<real>&) const override;
     [[nodiscard]] bool postConvergence(StudyCurrentState&,
                                        const real,
                                        const real,
@@ -490,12 +533,60 @@ namespace mtest {
      */
     void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    /*!
+     * \return the half-bandwidth of the part of the stiffness matrix
+     * associated with the radial displacements of the nodes
+     */
+    size_type getHalfBandwidth() const;
+    /*!
+     * \brief reset the part of a stiffness matrix associated with a range of
+     * nodes, i.e. the band of the rows associated with those nodes and the
+     * terms coupling those nodes with the axial strain.
+     * \param[out] k: stiffness matrix
+     * \param[in] nb: first node
+     * \param[in] ne: node after the last node
+     */
+    void resetStiffnessMatrix(tfel::math::matrix<real>&,
+                              const size_type,
+                              const size_type) const;
+    /*!
+     * \brief add the contributions of a range of elements to the stiffness
+     * matrix and the residual.
+     * \return a boolean and a scaling factor, as the
+     * `computeStiffnessMatrixAndResidual` method
+     * \param[out] k: stiffness matrix
+     * \param[out] r: residual
+     * \param[out] scs: structure current state
+     * \param[in] bwk: behaviour workspace
+     * \param[in] u1: current estimate of the unknowns
+     * \param[in] dt: time increment
+     * \param[in] mt: type of stiffness matrix
+     * \param[in] eb: first element
+     * \param[in] ee: element after the last element
+     */
+    std::pair<bool, real> computeElementsContributions(
+        tfel::math::matrix<real>&,
+        tfel::math::vector<real>&,
+        StructureCurrentState&,
+        BehaviourWorkSpace&,
+        const tfel::math::vector<real>&,
+        const real,
+        const StiffnessMatrixType,
+        const size_type,
+        const size_type) const;
+    //! \brief stiffness matrix and residual assembled by a thread
+    struct ThreadWorkSpace {
+      //! \brief stiffness matrix
+      tfel::math::matrix<real> k;
+      //! \brief residual
+      tfel::math::vector<real> r;
+    };
     //! \brief description of an additional
     struct AdditionalOutput {
       //! \brief description
       std::string d;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
@@ -543,6 +634,12 @@ namespace mtest {
     AxialLoading al = DEFAULTAXIALLOADING;
     //! \brief failure policy
     FailurePolicy failure_policy = REPORTONLY;
+    //! \brief linear solver
+    LinearSolver linear_solver = DENSE;
+    //! \brief thread pool used to integrate the behaviour over the elements
+    std::unique_ptr<tfel::system::ThreadPool> pool;
+    //! \brief workspaces of the threads
+    mutable std::vector<ThreadWorkSpace> twks;
     //! \brief element type
     //! \brief small strain hypothesis
     bool hpp = false;
@@ -65,6 +65,8 @@ namespace mtest {
     ~PipeTestParser() override;
 
    protected:
+    // the overloads of the tokenizer shall not be hidden
+    using tfel::utilities::CxxTokenizer::parseString;
     /*!
      * \brief handle the `@RadialLoading` keyword
      * \param[out]    t: test
@@ -101,6 +103,18 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleElementType(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@LinearSolver` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleLinearSolver(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(PipeTest&, tokens_iterator&);
     /*!
      * \brief handle the `@PerformSmallStrainAnalysis` keyword
      * \param[out]    t: test
@@ -28,6 +28,13 @@
 #include "MTest/Scheme.hxx"
 #include "MTest/SolverOptions.hxx"
 
+namespace tfel::utilities {
+
+  // forward declaration
+  struct BinaryDataWriter;
+
+}  // end of namespace tfel::utilities
+
 namespace mtest {
 
   // forward declaration
@@ -39,6 +46,11 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output file
+    enum OutputFormat {
+      TEXTOUTPUT,
+      BINARYOUTPUT
+    };  // end of enum OutputFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -80,6 +92,11 @@ namespace mtest {
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the format of the output file
+     * \param[in] f: format
+     */
+    virtual void setOutputFormat(const OutputFormat);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -249,6 +266,25 @@ namespace mtest {
      * \param[in] v : variable names
      */
     void declareVariables(const std::vector<std::string>&, const bool);
+    /*!
+     * \brief open the output file in the binary format, if required.
+     * \param[in] c: descriptions of the columns
+     *
+     * In the binary format, the output file can only be opened once the
+     * descriptions of the columns are known. This method must be called
+     * by the derived classes at the end of the initialisation.
+     */
+    void openBinaryOutputFile(const std::vector<std::string>&);
+    //! \brief flush the output file
+    void flushOutputFile() const;
+    /*!
+     * \brief flush the output file, ignoring any error.
+     *
+     * This method is meant to be called when handling an exception, so
+     * that the error reported to the user is the one that interrupted the
+     * computation.
+     */
+    void flushOutputFileOnError() const noexcept;
     //! declared variable names
     std::vector<std::string> vnames;
     //! initilisation stage
@@ -272,6 +308,10 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! \brief output file, in the binary format
+    mutable std::unique_ptr<tfel::utilities::BinaryDataWriter> bout;
+    //! \brief descriptions of the columns of the binary output file
+    std::vector<std::string> bout_columns;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -281,6 +321,8 @@ namespace mtest {
     mutable std::ofstream residual;
     //! output frequency
     OutputFrequency output_frequency = USERDEFINEDTIMES;
+    //! \brief format of the output file
+    OutputFormat output_format = TEXTOUTPUT;
     //! output file precision
     int oprec = -1;
     //! residual file precision
@@ -20,6 +20,7 @@
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
+#include "MTest/BorderedBandMatrixSolver.hxx"
 
 namespace mtest {
 
@@ -39,6 +40,8 @@ namespace mtest {
     tfel::math::Permutation<size_type> p_lu;
     // temporary vector used by the LUSolve::exe function
     tfel::math::vector<real> x;
+    //! solver dedicated to bordered banded matrices
+    BorderedBandMatrixSolver bsolver;
   };  // end of struct SolverWorkSpace
 
   /*!
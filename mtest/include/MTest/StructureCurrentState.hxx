@@ -64,6 +64,18 @@ namespace mtest {
     void setModellingHypothesis(const Hypothesis);
     //! \return the behaviour workspace associated to the current thread.
     BehaviourWorkSpace &getBehaviourWorkSpace() const;
+    /*!
+     * \return the `i`-th behaviour workspace. This workspace is allocated if
+     * needed.
+     *
+     * This method is meant to give each thread of a parallel loop over the
+     * integration points its own workspace. The allocation is not
+     * thread-safe, so the last workspace used must be retrieved before
+     * starting the parallel loop.
+     *
+     * \param[in] i: index of the workspace
+     */
+    BehaviourWorkSpace &getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour &getBehaviour() const;
     /*!
@@ -175,6 +175,29 @@ namespace mtest {
                                           const SolverOptions&,
                                           const real,
                                           const real) const = 0;
+    /*!
+     * \brief solve the linear system built by the
+     * `computeStiffnessMatrixAndResidual` or the
+     * `computePredictionStiffnessAndResidual` methods.
+     *
+     * On input, `wk.du` contains the residual. On output, it contains the
+     * correction of the unknowns. The factorization of the stiffness matrix
+     * is kept in the workspace for later use by the
+     * `solveWithFactorizedStiffnessMatrix` method.
+     *
+     * The default implementation relies on a dense LU decomposition.
+     *
+     * \param[in,out] wk: solver workspace
+     */
+    virtual void solveLinearSystem(SolverWorkSpace&) const;
+    /*!
+     * \brief solve a linear system using the factorization of the stiffness
+     * matrix computed by the last call to the `solveLinearSystem` method.
+     * \param[in,out] wk: solver workspace
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    virtual void solveWithFactorizedStiffnessMatrix(
+        SolverWorkSpace&, tfel::math::vector<real>&) const;
     /*!
      * \param[out] s: current structure state
      * \param[in]  t:  current time
@@ -0,0 +1,128 @@
+/*!
+ * \file   mtest/include/MTest/Tracer.hxx
+ * \brief  This file declares the `Tracer` class, which records the time
+ * spent in the main phases of a simulation and writes it using the Chrome
+ * trace format, and the `TraceEvent` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_TRACER_HXX
+#define LIB_MTEST_TRACER_HXX
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include "MTest/Config.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a class recording the time spent in the main phases of a
+   * simulation (time steps, iterations, resolution of the linear systems,
+   * etc.).
+   *
+   * The events are written in the `Chrome trace` format, which can be
+   * read by `chrome://tracing` or `perfetto`.
+   *
+   * Tracing is disabled by default. When disabled, recording an event
+   * only requires to check an atomic flag.
+   */
+  struct MTEST_VISIBILITY_EXPORT Tracer {
+    //! \brief a simple alias
+    using clock = std::chrono::steady_clock;
+    //! \return the unique instance of this class
+    static Tracer& getTracer();
+    /*!
+     * \brief enable tracing
+     * \param[in] f: name of the file where the events will be written
+     */
+    void enable(const std::string&);
+    //! \return if tracing is enabled
+    bool isEnabled() const noexcept {
+      return this->enabled.load(std::memory_order_relaxed);
+    }
+    /*!
+     * \brief add a new event
+     * \param[in] n: name of the event. This name must be a string literal.
+     * \param[in] s: start of the event
+     * \param[in] e: end of the event
+     */
+    void addEvent(const char* const, const clock::time_point&,
+                  const clock::time_point&);
+    /*!
+     * \brief write the events recorded so far in the output file.
+     * This method does nothing if tracing is disabled.
+     */
+    void write();
+
+   private:
+    //! \brief description of an event
+    struct Event {
+      //! \brief name of the event
+      const char* name;
+      //! \brief start of the event, in microseconds since the origin
+      std::int64_t start;
+      //! \brief duration of the event, in microseconds
+      std::int64_t duration;
+      //! \brief identifier of the thread
+      std::size_t thread;
+    };
+    //! \brief default constructor
+    Tracer();
+    Tracer(Tracer&&) = delete;
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(Tracer&&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+    //! \brief output file
+    std::string file;
+    //! \brief origin of times
+    clock::time_point origin;
+    //! \brief recorded events
+    std::vector<Event> events;
+    //! \brief small identifiers associated with threads
+    std::map<std::thread::id, std::size_t> threads;
+    //! \brief mutex protecting the recorded events
+    std::mutex m;
+    //! \brief boolean stating if tracing is enabled
+    std::atomic<bool> enabled;
+  };  // end of struct Tracer
+
+  /*!
+   * \brief an helper class recording an event from its construction
+   * to its destruction
+   */
+  struct MTEST_VISIBILITY_EXPORT TraceEvent {
+    /*!
+     * \brief constructor
+     * \param[in] n: name of the event. This name must be a string literal.
+     */
+    explicit TraceEvent(const char* const) noexcept;
+    //! \brief destructor
+    ~TraceEvent();
+
+   private:
+    TraceEvent(TraceEvent&&) = delete;
+    TraceEvent(const TraceEvent&) = delete;
+    TraceEvent& operator=(TraceEvent&&) = delete;
+    TraceEvent& operator=(const TraceEvent&) = delete;
+    //! \brief name of the event, or `nullptr` if tracing is disabled
+    const char* const name;
+    //! \brief start of the event
+    Tracer::clock::time_point start;
+  };  // end of struct TraceEvent
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_TRACER_HXX */
@@ -18,6 +18,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/Tracer.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/Behaviour.hxx"
@@ -290,6 +291,7 @@ namespace mtest {
                                                      const std::string& f,
                                                      const Parameters& d,
                                                      const Hypothesis h) {
+    TraceEvent e("LoadBehaviour");
     auto throw_if = [](const bool c, const std::string& m) {
       tfel::raise_if(c, "Behaviour::getBehaviour: " + m);
     };
@@ -0,0 +1,136 @@
+/*!
+ * \file   BorderedBandMatrixSolver.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "MTest/BorderedBandMatrixSolver.hxx"
+
+namespace mtest {
+
+  real& BorderedBandMatrixSolver::lu(const size_type i, const size_type j) {
+    return this->factors[i * (3 * this->w + 1) + (j + this->w - i)];
+  }  // end of lu
+
+  const real& BorderedBandMatrixSolver::lu(const size_type i,
+                                           const size_type j) const {
+    return this->factors[i * (3 * this->w + 1) + (j + this->w - i)];
+  }  // end of lu
+
+  void BorderedBandMatrixSolver::factorize(const tfel::math::matrix<real>& K,
+                                           const size_type bw) {
+    constexpr auto eps = 100 * std::numeric_limits<real>::min();
+    tfel::raise_if((K.getNbRows() != K.getNbCols()) || (K.getNbRows() < 2),
+                   "BorderedBandMatrixSolver::factorize: invalid matrix");
+    this->n = K.getNbRows() - 1;
+    this->w = bw;
+    const auto nb = this->n;
+    this->factors.assign(nb * (3 * bw + 1), real(0));
+    this->pivots.resize(nb);
+    this->z.resize(nb);
+    this->c.resize(nb);
+    // copy of the band and of the border
+    for (size_type i = 0; i != nb; ++i) {
+      const auto jb = i > bw ? i - bw : size_type(0);
+      const auto je = std::min(i + bw + 1, nb);
+      for (size_type j = jb; j != je; ++j) {
+        this->lu(i, j) = K(i, j);
+      }
+      this->z[i] = K(i, nb);
+      this->c[i] = K(nb, i);
+    }
+    // banded LU decomposition with partial pivoting
+    for (size_type k = 0; k != nb; ++k) {
+      const auto re = std::min(k + bw + 1, nb);
+      const auto je = std::min(k + 2 * bw + 1, nb);
+      auto p = k;
+      auto vmax = std::abs(this->lu(k, k));
+      for (size_type r = k + 1; r != re; ++r) {
+        if (std::abs(this->lu(r, k)) > vmax) {
+          vmax = std::abs(this->lu(r, k));
+          p = r;
+        }
+      }
+      if (vmax < eps) {
+        tfel::raise<tfel::math::LUNullPivot>();
+      }
+      this->pivots[k] = p;
+      if (p != k) {
+        for (size_type j = k; j != je; ++j) {
+          std::swap(this->lu(k, j), this->lu(p, j));
+        }
+      }
+      const auto pv = this->lu(k, k);
+      for (size_type r = k + 1; r != re; ++r) {
+        const auto l = this->lu(r, k) / pv;
+        this->lu(r, k) = l;
+        for (size_type j = k + 1; j != je; ++j) {
+          this->lu(r, j) -= l * this->lu(k, j);
+        }
+      }
+    }
+    // elimination of the last unknown
+    this->solveFirstBlock(this->z.data());
+    this->schur = K(nb, nb);
+    for (size_type i = 0; i != nb; ++i) {
+      this->schur -= this->c[i] * this->z[i];
+    }
+    if (std::abs(this->schur) < eps) {
+      tfel::raise<tfel::math::LUNullPivot>();
+    }
+  }  // end of factorize
+
+  void BorderedBandMatrixSolver::solveFirstBlock(real* const x) const {
+    const auto nb = this->n;
+    const auto bw = this->w;
+    // forward substitution
+    for (size_type k = 0; k != nb; ++k) {
+      const auto p = this->pivots[k];
+      if (p != k) {
+        std::swap(x[k], x[p]);
+      }
+      const auto re = std::min(k + bw + 1, nb);
+      for (size_type r = k + 1; r != re; ++r) {
+        x[r] -= this->lu(r, k) * x[k];
+      }
+    }
+    // backward substitution
+    for (size_type k = nb; k-- != 0;) {
+      const auto je = std::min(k + 2 * bw + 1, nb);
+      auto v = x[k];
+      for (size_type j = k + 1; j != je; ++j) {
+        v -= this->lu(k, j) * x[j];
+      }
+      x[k] = v / this->lu(k, k);
+    }
+  }  // end of solveFirstBlock
+
+  void BorderedBandMatrixSolver::solve(tfel::math::vector<real>& x) const {
+    const auto nb = this->n;
+    tfel::raise_if(x.size() != nb + 1,
+                   "BorderedBandMatrixSolver::solve: unmatched size");
+    this->solveFirstBlock(x.data());
+    auto v = x[nb];
+    for (size_type i = 0; i != nb; ++i) {
+      v -= this->c[i] * x[i];
+    }
+    x[nb] = v / this->schur;
+    for (size_type i = 0; i != nb; ++i) {
+      x[i] -= this->z[i] * x[nb];
+    }
+  }  // end of solve
+
+}  // end of namespace mtest
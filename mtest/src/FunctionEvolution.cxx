@@ -11,35 +11,78 @@
  * project under specific licensing conditions.
  */
 
+#include <atomic>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MTest/FunctionEvolution.hxx"
 
 namespace mtest {
 
+  /*!
+   * \return a new identifier for a function evolution. Identifiers are
+   * never reused, so that the evaluation context of a destroyed evolution
+   * cached by a thread can't be mistaken for the one of a new evolution.
+   */
+  static std::size_t getNewFunctionEvolutionIdentifier() {
+    static std::atomic<std::size_t> i{0};
+    return i++;
+  }  // end of getNewFunctionEvolutionIdentifier
+
   FunctionEvolution::FunctionEvolution(const std::string& f_,
                                        const EvolutionManager& evm_)
       : evm(evm_),
-        f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)) {
+        f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)),
+        variables(this->f.getVariablesNames()),
+        identifier(getNewFunctionEvolutionIdentifier()) {
+    this->f.compile();
   }  // end of FunctionEvolution::FunctionEvolution
 
+  FunctionEvolution::EvaluationContext&
+  FunctionEvolution::getEvaluationContext() const {
+    struct CachedContext {
+      //! \brief identifier of the evolution
+      std::size_t identifier;
+      //! \brief evaluation context of the current thread
+      EvaluationContext* context;
+    };
+    // evaluation contexts of the current thread for all the evolutions
+    // evaluated so far. The number of function evolutions being small, a
+    // linear search is used.
+    thread_local std::vector<CachedContext> cache;
+    for (const auto& c : cache) {
+      if (c.identifier == this->identifier) {
+        return *(c.context);
+      }
+    }
+    auto c = std::make_unique<EvaluationContext>(
+        this->f.makeEvaluationContext());
+    auto& r = *c;
+    {
+      auto lock = std::lock_guard<std::mutex>{this->m};
+      this->contexts.push_back(std::move(c));
+    }
+    cache.push_back({this->identifier, &r});
+    return r;
+  }  // end of getEvaluationContext
+
   real FunctionEvolution::operator()(const real t) const {
-    const auto& args = this->f.getVariablesNames();
-    std::vector<std::string>::size_type i;
-    for (i = 0; i != args.size(); ++i) {
-      if (args[i] == "t") {
-        this->f.setVariableValue("t", t);
+    // the evaluation context is specific to the current thread, so that
+    // this method can be called concurrently
+    auto& c = this->getEvaluationContext();
+    for (const auto& v : this->variables) {
+      if (v == "t") {
+        this->f.setVariableValue(c, "t", t);
       } else {
-        auto pev = evm.find(args[i]);
+        auto pev = evm.find(v);
         tfel::raise_if(pev == evm.end(),
                        "FunctionEvolution::operator(): "
                        "can't evaluate argument '" +
-                           args[i] + "'");
+                           v + "'");
         const auto& ev = *(pev->second);
-        this->f.setVariableValue(args[i], ev(t));
+        this->f.setVariableValue(c, v, ev(t));
       }
     }
-    return this->f.getValue();
+    return this->f.getValue(c);
   }  // end of FunctionEvolution::operator()
 
   bool FunctionEvolution::isConstant() const {
@@ -20,6 +20,7 @@
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/RoundingMode.hxx"
+#include "MTest/Tracer.hxx"
 #include "MTest/SolverOptions.hxx"
 #include "MTest/AccelerationAlgorithm.hxx"
 #include "MTest/SolverWorkSpace.hxx"
@@ -58,8 +59,11 @@ namespace mtest {
         }
       }
     }
-    const auto r =
-        s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+    const auto r = [&] {
+      TraceEvent e("computeStiffnessMatrixAndResidual");
+      return s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt,
+                                                 o.ktype);
+    }();
     if (!r.first) {
       return r;
     }
@@ -113,11 +117,12 @@ namespace mtest {
       } else if (o.ppolicy == PredictionPolicy::TANGENTOPERATORPREDICTION) {
         smt = StiffnessMatrixType::TANGENTOPERATOR;
       }
+      TraceEvent prediction("Prediction");
       if (s.computePredictionStiffnessAndResidual(scs, wk.K, wk.r, t, dt, smt)
               .first) {
         wk.du = wk.r;
         setRoundingMode();
-        LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+        s.solveLinearSystem(wk);
         setRoundingMode();
         u1 -= wk.du;
       } else {
@@ -143,12 +148,16 @@ namespace mtest {
     /* prediction */
     auto r_dt = real{};
     while ((!converged) && (iter != o.iterMax)) {
+      TraceEvent iteration("NewtonIteration");
       ++(scs.iterations);
       ++iter;
       nep2 = nep;
       nep = ne;
-      auto r =
-          s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+      auto r = [&] {
+        TraceEvent e("computeStiffnessMatrixAndResidual");
+        return s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt,
+                                                   o.ktype);
+      }();
       if (!r.first) {
         return r;
       }
@@ -175,7 +184,10 @@ namespace mtest {
       }
       wk.du = wk.r;
       setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+      {
+        TraceEvent e("LinearSolve");
+        s.solveLinearSystem(wk);
+      }
       setRoundingMode();
       u1 -= wk.du;
       converged =
@@ -196,7 +208,10 @@ namespace mtest {
           s.computeLoadingCorrection(scs, wk, o, t, dt);
           // call the acceleration algorithm
           if (o.aa != nullptr) {
-            o.aa->execute(u1, wk.du, wk.r, o.eeps, o.seps, iter);
+            {
+              TraceEvent e("AccelerationAlgorithm::execute");
+              o.aa->execute(u1, wk.du, wk.r, o.eeps, o.seps, iter);
+            }
             if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL2) {
               wk.du = u1 - scs.u10;
               const auto nit = s.getErrorNorm(wk.du);
@@ -248,6 +263,7 @@ namespace mtest {
                               const SolverOptions& o,
                               const real ti,
                               const real te) {
+    TraceEvent time_step("TimeStep");
     unsigned short subStep = 0;
     auto t_eps = (te - ti) * 100 * std::numeric_limits<real>::epsilon();
     auto t = ti;
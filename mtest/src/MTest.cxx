@@ -24,6 +24,7 @@
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
@@ -32,8 +33,10 @@
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/stensor.hxx"
 #include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
+#include "MTest/Tracer.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/MTestParser.hxx"
 #include "MTest/Evolution.hxx"
@@ -294,11 +297,9 @@ namespace mtest {
     }
     SingleStructureScheme::completeInitialisation();
     // post-processing
-    unsigned short cnbr = 2;
-    const char* dvn;
-    const char* thn;
-    if (this->out) {
-      this->out << "# first column: time\n";
+    if ((this->output_format == SchemeBase::BINARYOUTPUT) || (this->out)) {
+      const char* dvn;
+      const char* thn;
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
         dvn = "strain";
@@ -319,15 +320,15 @@ namespace mtest {
       const auto gc = this->b->getGradientsComponents();
       const auto nth = this->b->getThermodynamicForcesSize();
       const auto thc = this->b->getThermodynamicForcesComponents();
+      // descriptions of the columns
+      auto columns = std::vector<std::string>{"time"};
       for (unsigned short i = 0; i != ndv; ++i) {
-        this->out << "# " << cnbr << " column: " << i + 1
-                  << "th component of the " << dvn << " (" << gc[i] << ")\n";
-        ++cnbr;
+        columns.push_back(std::to_string(i + 1) + "th component of the " +
+                          dvn + " (" + gc[i] + ")");
       }
       for (unsigned short i = 0; i != nth; ++i) {
-        this->out << "# " << cnbr << " column: " << i + 1
-                  << "th component of the " << thn << " (" << thc[i] << ")\n";
-        ++cnbr;
+        columns.push_back(std::to_string(i + 1) + "th component of the " +
+                          thn + " (" + thc[i] + ")");
       }
       const auto& ivdes = this->b->getInternalStateVariablesDescriptions();
       tfel::raise_if(ivdes.size() != this->b->getInternalStateVariablesSize(),
@@ -335,13 +336,18 @@ namespace mtest {
                      "(the number of descriptions given by "
                      "the mechanical behaviour don't match "
                      "the number of internal state variables)");
-      for (std::vector<std::string>::size_type i = 0; i != ivdes.size(); ++i) {
-        this->out << "# " << cnbr << " column: " << ivdes[i] << '\n';
-        ++cnbr;
+      columns.insert(columns.end(), ivdes.begin(), ivdes.end());
+      columns.push_back("stored energy");
+      columns.push_back("disspated energy");
+      if (this->output_format == SchemeBase::BINARYOUTPUT) {
+        this->openBinaryOutputFile(columns);
+      } else {
+        this->out << "# first column: time\n";
+        for (std::vector<std::string>::size_type i = 1; i != columns.size();
+             ++i) {
+          this->out << "# " << i + 1 << " column: " << columns[i] << '\n';
+        }
       }
-      this->out << "# " << cnbr << " column: stored energy\n";
-      this->out << "# " << cnbr + 1 << " column: disspated energy\n";
-      ++cnbr;
     }
     // convergence criterion value for driving variables
     if (this->options.eeps < 0) {
@@ -520,15 +526,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFileOnError();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFileOnError();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -555,6 +561,24 @@ namespace mtest {
     this->pv = v;
   }  // end of setNumericalTangentOperatorPerturbationValue
 
+  void MTest::setNumericalTangentOperatorFiniteDifferenceScheme(
+      const FiniteDifferenceScheme s) {
+    this->fds = s;
+  }  // end of setNumericalTangentOperatorFiniteDifferenceScheme
+
+  void MTest::setNumberOfThreads(const int n) {
+    tfel::raise_if(n < 1,
+                   "MTest::setNumberOfThreads: "
+                   "invalid number of threads (" +
+                       std::to_string(n) + ")");
+    if (n == 1) {
+      this->pool.reset();
+    } else {
+      this->pool = std::make_unique<tfel::system::ThreadPool>(
+          static_cast<tfel::system::ThreadPool::size_type>(n));
+    }
+  }  // end of setNumberOfThreads
+
   std::pair<bool, real> MTest::prepare(StudyCurrentState& state,
                                        const real t,
                                        const real dt) const {
@@ -684,48 +708,8 @@ namespace mtest {
       return rb;
     }
     if ((this->cto) && (mt == StiffnessMatrixType::CONSISTENTTANGENTOPERATOR)) {
-      bool ok = true;
-      bwk.ne.swap(s.e1);
-      bwk.ns.swap(s.s1);
-      bwk.nivs.swap(s.iv1);
-      for (size_type i = 0; i != ndv; ++i) {
-        revert(s);
-        std::copy(bwk.ne.begin(), bwk.ne.end(), s.e1.begin());
-        s.e1[i] += this->pv;
-        try {
-          setRoundingMode();
-          ok = this->b->integrate(s, bwk, dt, mt).first;
-          setRoundingMode();
-        } catch (...) {
-          ok = false;
-        }
-        if (!ok) {
-          break;
-        }
-        for (size_type j = 0; j != nth; ++j) {
-          bwk.nk(j, i) = s.s1(j);
-        }
-        revert(s);
-        std::copy(bwk.ne.begin(), bwk.ne.end(), s.e1.begin());
-        s.e1[i] -= this->pv;
-        try {
-          setRoundingMode();
-          ok = this->b->integrate(s, bwk, dt, mt).first;
-          setRoundingMode();
-        } catch (...) {
-          ok = false;
-        }
-        if (!ok) {
-          break;
-        }
-        for (size_type j = 0; j != nth; ++j) {
-          bwk.nk(j, i) -= s.s1(j);
-          bwk.nk(j, i) /= 2 * (this->pv);
-        }
-      }
-      bwk.ne.swap(s.e1);
-      bwk.ns.swap(s.s1);
-      bwk.nivs.swap(s.iv1);
+      const auto ok =
+          this->computeNumericalTangentOperator(bwk.nk, scs, s, dt, mt);
       if (ok) {
         real merr(0);
         size_type mi = 0;
@@ -785,6 +769,102 @@ namespace mtest {
     return rb;
   }  // end of computeStiffnessMatrixAndResidual
 
+  bool MTest::computeNumericalTangentOperatorColumns(
+      tfel::math::matrix<real>& nk,
+      CurrentState& s,
+      BehaviourWorkSpace& wk,
+      const CurrentState& s1,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_type cb,
+      const size_type ce) const {
+    const auto nth = this->b->getThermodynamicForcesSize();
+    auto integrate = [this, &s, &wk, &s1, dt, mt](const size_type i,
+                                                  const real de) {
+      revert(s);
+      std::copy(s1.e1.begin(), s1.e1.end(), s.e1.begin());
+      s.e1[i] += de;
+      try {
+        setRoundingMode();
+        const auto r = this->b->integrate(s, wk, dt, mt).first;
+        setRoundingMode();
+        return r;
+      } catch (...) {
+      }
+      return false;
+    };
+    for (size_type i = cb; i != ce; ++i) {
+      if (!integrate(i, this->pv)) {
+        return false;
+      }
+      for (size_type j = 0; j != nth; ++j) {
+        nk(j, i) = s.s1(j);
+      }
+      if (this->fds == CENTREDDIFFERENCE) {
+        if (!integrate(i, -(this->pv))) {
+          return false;
+        }
+        for (size_type j = 0; j != nth; ++j) {
+          nk(j, i) = (nk(j, i) - s.s1(j)) / (2 * (this->pv));
+        }
+      } else {
+        for (size_type j = 0; j != nth; ++j) {
+          nk(j, i) = (nk(j, i) - s1.s1(j)) / (this->pv);
+        }
+      }
+    }
+    return true;
+  }  // end of computeNumericalTangentOperatorColumns
+
+  bool MTest::computeNumericalTangentOperator(
+      tfel::math::matrix<real>& nk,
+      const StructureCurrentState& scs,
+      const CurrentState& s1,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    const auto ndv = this->b->getGradientsSize();
+    const auto nt = (this->pool == nullptr)
+                        ? size_type(1)
+                        : std::min(size_type(this->pool->getNumberOfThreads()),
+                                   size_type(ndv));
+    // the perturbed integrations never use the first behaviour workspace,
+    // which holds the tangent operator returned by the behaviour
+    if (nt == 1) {
+      auto s = s1;
+      return this->computeNumericalTangentOperatorColumns(
+          nk, s, scs.getBehaviourWorkSpace(1), s1, dt, mt, 0, ndv);
+    }
+    // parallel treatment. The workspaces are allocated before launching the
+    // threads.
+    scs.getBehaviourWorkSpace(nt);
+    auto results =
+        std::vector<std::future<tfel::system::ThreadedTaskResult<bool>>>{};
+    results.reserve(nt);
+    for (size_type th = 0; th != nt; ++th) {
+      const auto cb = (th * ndv) / nt;
+      const auto ce = ((th + 1) * ndv) / nt;
+      results.push_back(
+          this->pool->addTask([this, &nk, &scs, &s1, dt, mt, th, cb, ce] {
+            auto s = s1;
+            return this->computeNumericalTangentOperatorColumns(
+                nk, s, scs.getBehaviourWorkSpace(th + 1), s1, dt, mt, cb, ce);
+          }));
+    }
+    auto tresults = std::vector<tfel::system::ThreadedTaskResult<bool>>{};
+    tresults.reserve(nt);
+    for (auto& result : results) {
+      tresults.push_back(result.get());
+    }
+    auto ok = true;
+    for (auto& tresult : tresults) {
+      if (!tresult) {
+        tresult.rethrow();
+      }
+      ok = ok && *tresult;
+    }
+    return ok;
+  }  // end of computeNumericalTangentOperator
+
   /*!
    * \brief compute the error norm
    * \param[in] v: values
@@ -942,7 +1022,19 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    TraceEvent e("Output");
+    if (this->bout != nullptr) {
+      auto& cs = s.getStructureCurrentState("").istates[0];
+      const auto ndv = this->b->getGradientsSize();
+      const auto nth = this->b->getThermodynamicForcesSize();
+      auto& w = *(this->bout);
+      w.write(t);
+      w.write(s.u0.begin(), s.u0.begin() + ndv);
+      w.write(cs.s0.begin(), cs.s0.begin() + nth);
+      w.write(cs.iv0.begin(), cs.iv0.end());
+      w.write(cs.se0);
+      w.write(cs.de0);
+    } else if (this->out) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       // number of components of the driving variables and the thermodynamic
       // forces
@@ -13,11 +13,15 @@
 
 #include <cfenv>
 #include <regex>
+#include <chrono>
+#include <future>
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <sstream>
 #include <utility>
 #include <iostream>
+#include <algorithm>
 
 #if defined _WIN32 || defined _WIN64
 #ifndef NOMINMAX
@@ -41,6 +45,9 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Tests/TestManager.hxx"
 #include "TFEL/Tests/XMLTestOutput.hxx"
+#include "TFEL/Tests/StdStreamTestOutput.hxx"
+#include "TFEL/Tests/MultipleTestOutputs.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 
@@ -50,6 +57,7 @@
 
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
+#include "MTest/Tracer.hxx"
 #include "MTest/Constraint.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/MTest.hxx"
@@ -85,6 +93,10 @@ namespace mtest {
     void treatEnableFloatingPointExceptions();
     //! treat the `--rounding-direction-mode` option
     void treatRoundingDirectionMode();
+    //! treat the `--trace-file` option
+    void treatTraceFile();
+    //! treat the `--jobs` option
+    void treatJobs();
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
     //! treat the `--backtrace` option
     void treatBacktrace();
@@ -98,6 +110,11 @@ namespace mtest {
      * \param[in] n: name of the test
      */
     void addTest(std::shared_ptr<SchemeBase>, const std::string&);
+    /*!
+     * \brief execute the tests concurrently
+     * \return true on success
+     */
+    bool executeTestsInParallel();
     std::shared_ptr<SchemeBase> createMTestTest(const std::string&);
     std::shared_ptr<SchemeBase> createPTestTest(const std::string&);
     void treatMadnexInputFile(const std::string&);
@@ -136,6 +153,19 @@ namespace mtest {
     bool result_file_output = true;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief description of a test executed concurrently
+    struct TestDescription {
+      //! \brief name of the test
+      std::string name;
+      //! \brief test
+      std::shared_ptr<SchemeBase> test;
+      //! \brief outputs associated with the test
+      std::shared_ptr<tfel::tests::MultipleTestOutputs> outputs;
+    };
+    //! \brief tests executed concurrently, in the order of the input files
+    std::vector<TestDescription> tests;
+    //! \brief number of tests executed concurrently
+    unsigned short numberOfJobs = 1;
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -199,6 +229,16 @@ namespace mtest {
         "Random:     Rounding mode is randomly changed at various "
         "stage of the compution.",
         true);
+    this->registerNewCallBack(
+        "--trace-file", &MTestMain::treatTraceFile,
+        "write the time spent in the main phases of the computations "
+        "(time steps, iterations, linear solver, etc.) in the given file, "
+        "using the Chrome trace format",
+        true);
+    this->registerNewCallBack("--jobs", &MTestMain::treatJobs,
+                              "number of tests executed in parallel "
+                              "(default: 1)",
+                              true);
 #ifdef MTEST_HAVE_MADNEX
     auto treatBehaviour = [this] {
       if (!this->behaviour.empty()) {
@@ -309,6 +349,41 @@ namespace mtest {
     mtest::setRoundingMode(o);
   }  // end of MTestMain::setRoundingDirectionMode
 
+  void MTestMain::treatTraceFile() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatTraceFile: "
+                   "no option given");
+    Tracer::getTracer().enable(o);
+  }  // end of MTestMain::treatTraceFile
+
+  void MTestMain::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatJobs: "
+                   "no argument given to the "
+                   "--jobs option");
+    const auto n = [&o] {
+      try {
+        auto pos = std::size_t{};
+        const auto v = std::stoi(o, &pos);
+        if (pos == o.size()) {
+          return v;
+        }
+      } catch (std::exception&) {
+      }
+      tfel::raise(
+          "MTestMain::treatJobs: "
+          "invalid argument '" +
+          o + "' given to the --jobs option");
+    }();
+    tfel::raise_if((n < 1) || (n > 1024),
+                   "MTestMain::treatJobs: "
+                   "invalid number of jobs '" +
+                       o + "'");
+    this->numberOfJobs = static_cast<unsigned short>(n);
+  }  // end of MTestMain::treatJobs
+
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
   void MTestMain::treatBacktrace() {
     using namespace tfel::system;
@@ -507,13 +582,87 @@ namespace mtest {
         }
       }
     }
+    if (this->numberOfJobs > 1) {
+      const auto r = this->executeTestsInParallel();
+      Tracer::getTracer().write();
+      return r ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
     auto& tm = tfel::tests::TestManager::getTestManager();
     const auto r = tm.execute();
+    Tracer::getTracer().write();
     return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
   }  // end of execute
 
+  bool MTestMain::executeTestsInParallel() {
+    using tfel::tests::TestResult;
+    struct Result {
+      //! \brief result of the test
+      TestResult result;
+      //! \brief buffered log messages
+      std::string log;
+    };
+    auto run = [](SchemeBase& t) {
+      using namespace std::chrono;
+      auto r = Result{};
+      auto log = std::ostringstream{};
+      mfront::setThreadLocalLogStream(&log);
+      const auto start = high_resolution_clock::now();
+      try {
+        r.result = t.execute();
+      } catch (std::exception& e) {
+        r.result = TestResult(false, "test '" + t.name() +
+                                         "' has thrown an exception "
+                                         "(" +
+                                         std::string(e.what()) + ")");
+      } catch (...) {
+        r.result = TestResult(false, "test '" + t.name() +
+                                         "' has thrown an "
+                                         "unknown exception");
+      }
+      const auto stop = high_resolution_clock::now();
+      const auto nsec = duration_cast<nanoseconds>(stop - start).count();
+      r.result.setTestDuration(1.e-9 * nsec);
+      mfront::setThreadLocalLogStream(nullptr);
+      r.log = log.str();
+      return r;
+    };
+    if (this->tests.empty()) {
+      return true;
+    }
+    const auto n = std::min(static_cast<std::size_t>(this->numberOfJobs),
+                            this->tests.size());
+    tfel::system::ThreadPool pool(n);
+    auto results =
+        std::vector<std::future<tfel::system::ThreadedTaskResult<Result>>>{};
+    results.reserve(this->tests.size());
+    for (const auto& t : this->tests) {
+      results.push_back(pool.addTask([&run, &t] { return run(*(t.test)); }));
+    }
+    // results are reported in the order of the input files, so that the
+    // outputs do not depend on the scheduling of the tests
+    auto& log = mfront::getLogStream();
+    auto success = true;
+    auto pt = this->tests.begin();
+    for (auto& f : results) {
+      auto r = f.get();
+      if (!r) {
+        r.rethrow();
+      }
+      log << r->log;
+      log.flush();
+      auto& o = *(pt->outputs);
+      o.beginTestSuite("MTest/" + pt->name);
+      o.addTest(pt->test->classname(), pt->test->name(), r->result);
+      o.endTestSuite(TestResult(r->result.success()));
+      success = success && r->result.success();
+      ++pt;
+    }
+    return success;
+  }  // end of executeTestsInParallel
+
   std::shared_ptr<SchemeBase> MTestMain::createMTestTest(
       const std::string& path) {
+    TraceEvent e("Parsing");
     auto t = std::make_shared<MTest>();
     t->readInputFile(path, this->ecmds, this->substitutions);
     return t;
@@ -521,6 +670,7 @@ namespace mtest {
 
   std::shared_ptr<SchemeBase> MTestMain::createPTestTest(
       const std::string& path) {
+    TraceEvent e("Parsing");
     auto t = std::make_shared<PipeTest>();
     PipeTestParser().execute(*t, path, this->ecmds, this->substitutions);
     return t;
@@ -698,15 +848,28 @@ namespace mtest {
         t->setResidualFileName(n + "-residual.res");
       }
     }
-    tm.addTest("MTest/" + n, t);
+    auto outputs = std::vector<std::shared_ptr<tfel::tests::TestOutput>>{};
     if (this->xml_output) {
-      std::shared_ptr<tfel::tests::TestOutput> o;
       if (!t->isXMLOutputFileNameDefined()) {
-        o = std::make_shared<tfel::tests::XMLTestOutput>(n + ".xml");
+        outputs.push_back(
+            std::make_shared<tfel::tests::XMLTestOutput>(n + ".xml"));
       } else {
-        o = std::make_shared<tfel::tests::XMLTestOutput>(
-            t->getXMLOutputFileName());
+        outputs.push_back(std::make_shared<tfel::tests::XMLTestOutput>(
+            t->getXMLOutputFileName()));
+      }
+    }
+    if (this->numberOfJobs > 1) {
+      auto mo = std::make_shared<tfel::tests::MultipleTestOutputs>();
+      for (const auto& o : outputs) {
+        mo->addTestOutput(o);
       }
+      mo->addTestOutput(
+          std::make_shared<tfel::tests::StdStreamTestOutput>(std::cout));
+      this->tests.push_back({n, t, mo});
+      return;
+    }
+    tm.addTest("MTest/" + n, t);
+    for (const auto& o : outputs) {
       tm.addTestOutput("MTest/" + n, o);
     }
     tm.addTestOutput("MTest/" + n, std::cout);
@@ -271,6 +271,9 @@ namespace mtest {
         &MTestParser::handleTangentOperatorComparisonCriterion);
     add("@NumericalTangentOperatorPerturbationValue",
         &MTestParser::handleNumericalTangentOperatorPerturbationValue);
+    add("@NumericalTangentOperatorFiniteDifferenceScheme",
+        &MTestParser::handleNumericalTangentOperatorFiniteDifferenceScheme);
+    add("@NumberOfThreads", &MTestParser::handleNumberOfThreads);
     add("@UserDefinedPostProcessing",
         &MTestParser::handleUserDefinedPostProcessing);
   }
@@ -341,6 +344,45 @@ namespace mtest {
         this->tokens.end());
   }  // end of MTestParser::handleNumericalTangentOperatorPerturbationValue
 
+  void MTestParser::handleNumericalTangentOperatorFiniteDifferenceScheme(
+      MTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine(
+        "handleNumericalTangentOperatorFiniteDifferenceScheme", p,
+        this->tokens.end());
+    const auto& s = this->readString(p, this->tokens.end());
+    if (s == "Centred") {
+      t.setNumericalTangentOperatorFiniteDifferenceScheme(
+          MTest::CENTREDDIFFERENCE);
+    } else if (s == "Forward") {
+      t.setNumericalTangentOperatorFiniteDifferenceScheme(
+          MTest::FORWARDDIFFERENCE);
+    } else {
+      tfel::raise(
+          "MTestParser::handleNumericalTangentOperatorFiniteDifferenceScheme: "
+          "invalid finite difference scheme ('" +
+          s +
+          "').\n"
+          "Valid finite difference schemes are 'Centred' and 'Forward'");
+    }
+    this->checkNotEndOfLine(
+        "handleNumericalTangentOperatorFiniteDifferenceScheme", p,
+        this->tokens.end());
+    this->readSpecifiedToken(
+        "MTestParser::handleNumericalTangentOperatorFiniteDifferenceScheme",
+        ";", p, this->tokens.end());
+  }  // end of
+     // MTestParser::handleNumericalTangentOperatorFiniteDifferenceScheme
+
+  void MTestParser::handleNumberOfThreads(MTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("MTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    t.setNumberOfThreads(this->readInt(p, this->tokens.end()));
+    this->checkNotEndOfLine("MTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("MTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of MTestParser::handleNumberOfThreads
+
   void MTestParser::handleTest(MTest& t, tokens_iterator& p) {
     auto throw_if = [](const bool c, const std::string& m) {
       tfel::raise_if(c, "MTestParser::handleTest: " + m);
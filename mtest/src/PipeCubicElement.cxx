@@ -216,6 +216,7 @@ namespace mtest {
       tfel::math::matrix<real>& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -243,7 +244,6 @@ namespace mtest {
     // radial position of the fourth node
     const auto r3 = r0 + dr;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     // loop over Gauss point
@@ -153,6 +153,7 @@ namespace mtest {
       tfel::math::matrix<real>& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -178,7 +179,6 @@ namespace mtest {
     // jacobian of the transformation
     const auto J = dr / 2;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
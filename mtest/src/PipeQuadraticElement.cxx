@@ -163,6 +163,7 @@ namespace mtest {
       tfel::math::matrix<real>& k,
       tfel::math::vector<real>& r,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -188,7 +189,6 @@ namespace mtest {
     // radial position of the thrid node
     const auto r2 = r0 + dr;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
@@ -20,11 +20,15 @@
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/LUSolve.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
+#include "MTest/Tracer.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
@@ -586,7 +590,42 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
+    if (this->output_format == SchemeBase::BINARYOUTPUT) {
+      // the descriptions of the columns must match the values written by
+      // the `printOutput` method
+      auto columns = std::vector<std::string>{"time",
+                                              "inner radius",
+                                              "outer radius",
+                                              "inner radius displacement",
+                                              "outer radius displacement",
+                                              "axial displacement"};
+      if ((this->rl == IMPOSEDINNERRADIUS) ||
+          (this->rl == IMPOSEDOUTERRADIUS) || (this->rl == TIGHTPIPE)) {
+        columns.push_back("inner pressure");
+      } else if (this->mandrel_radius_evolution != nullptr) {
+        columns.push_back("contact pressure");
+      }
+      if ((this->al == IMPOSEDAXIALGROWTH) ||
+          (this->mandrel_axial_growth_evolution != nullptr)) {
+        columns.push_back("axial force");
+      }
+      if (this->mandrel_radius_evolution != nullptr) {
+        columns.push_back("mandel contact indicator");
+      }
+      for (const auto& ao : this->aoutputs) {
+        columns.push_back(ao.d);
+      }
+      if (this->inner_boundary_oxidation_model.model != nullptr) {
+        columns.push_back("oxidation length at the inner boundary");
+      }
+      if (this->outer_boundary_oxidation_model.model != nullptr) {
+        columns.push_back("oxidation length at the outer boundary");
+      }
+      for (const auto& fc : this->failure_criteria) {
+        columns.push_back("status of the " + fc->getName() + " criterion");
+      }
+      this->openBinaryOutputFile(columns);
+    } else if (this->out) {
       auto c = 7u;
       this->out << "# first  column : time\n"
                    "# second column : inner radius\n"
@@ -877,14 +916,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFileOnError();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFileOnError();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -1064,14 +1104,16 @@ namespace mtest {
       const real t,
       const real dt,
       const StiffnessMatrixType mt) const {
-    using LE = PipeLinearElement;
-    using QE = PipeQuadraticElement;
-    using CE = PipeCubicElement;
     constexpr real pi = 3.14159265358979323846;
     // reset r and k
     std::fill(r.begin(), r.end(), real(0));
     if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-      std::fill(k.begin(), k.end(), real(0));
+      if (this->linear_solver == BANDED) {
+        // only the band and the border are used by the linear solver
+        this->resetStiffnessMatrix(k, 0, this->getNumberOfNodes());
+      } else {
+        std::fill(k.begin(), k.end(), real(0));
+      }
     }
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
@@ -1237,24 +1279,133 @@ namespace mtest {
       }
     }
     // loop over the elements
+    const auto nt = (this->pool == nullptr)
+                        ? size_type(1)
+                        : std::min(size_type(this->pool->getNumberOfThreads()),
+                                   ne);
+    if (nt == 1) {
+      return this->computeElementsContributions(
+          k, r, scs, scs.getBehaviourWorkSpace(), state.u1, dt, mt, 0, ne);
+    }
+    // parallel treatment. The workspaces are allocated before launching the
+    // threads.
+    scs.getBehaviourWorkSpace(nt - 1);
+    if (this->twks.size() != nt) {
+      this->twks.resize(nt);
+    }
+    for (auto& twk : this->twks) {
+      if (twk.r.size() != n + 1) {
+        twk.k = tfel::math::matrix<real>(n + 1, n + 1, real(0));
+        twk.r = tfel::math::vector<real>(n + 1, real(0));
+      }
+    }
+    const auto w = this->getHalfBandwidth();
+    using Result = std::pair<bool, real>;
+    auto results = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<Result>>>{};
+    results.reserve(nt);
+    for (size_type th = 0; th != nt; ++th) {
+      const auto eb = (th * ne) / nt;
+      const auto ee = ((th + 1) * ne) / nt;
+      results.push_back(this->pool->addTask([this, &scs, &state, dt, mt, w,
+                                             th, eb, ee] {
+        auto& twk = this->twks[th];
+        std::fill(twk.r.begin(), twk.r.end(), real(0));
+        if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+          this->resetStiffnessMatrix(twk.k, w * eb, w * ee + 1);
+        }
+        return this->computeElementsContributions(
+            twk.k, twk.r, scs, scs.getBehaviourWorkSpace(th), state.u1, dt, mt,
+            eb, ee);
+      }));
+    }
+    auto tresults = std::vector<tfel::system::ThreadedTaskResult<Result>>{};
+    tresults.reserve(nt);
+    for (auto& result : results) {
+      tresults.push_back(result.get());
+    }
+    for (auto& tresult : tresults) {
+      if (!tresult) {
+        tresult.rethrow();
+      }
+    }
+    // reduction, in a fixed order to get reproducible results
+    auto success = true;
+    auto r_dt = tresults[0]->second;
+    for (size_type th = 0; th != nt; ++th) {
+      const auto& twk = this->twks[th];
+      const auto nb = w * ((th * ne) / nt);
+      const auto nn = w * (((th + 1) * ne) / nt) + 1;
+      for (size_type i = nb; i != nn; ++i) {
+        r(i) += twk.r(i);
+      }
+      r(n) += twk.r(n);
+      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+        for (size_type i = nb; i != nn; ++i) {
+          const auto jb = std::max(i > w ? i - w : size_type(0), nb);
+          const auto je = std::min(i + w + 1, nn);
+          for (size_type j = jb; j != je; ++j) {
+            k(i, j) += twk.k(i, j);
+          }
+          k(i, n) += twk.k(i, n);
+          k(n, i) += twk.k(n, i);
+        }
+        k(n, n) += twk.k(n, n);
+      }
+      success = success && tresults[th]->first;
+      r_dt = std::min(r_dt, tresults[th]->second);
+    }
+    return {success, r_dt};
+  }  // end of computeStiffnessMatrixAndResidual
+
+  void PipeTest::resetStiffnessMatrix(tfel::math::matrix<real>& k,
+                                      const size_type nb,
+                                      const size_type ne) const {
+    const auto n = this->getNumberOfNodes();
+    const auto w = this->getHalfBandwidth();
+    for (size_type i = nb; i != ne; ++i) {
+      const auto jb = std::max(i > w ? i - w : size_type(0), nb);
+      const auto je = std::min(i + w + 1, ne);
+      for (size_type j = jb; j != je; ++j) {
+        k(i, j) = real(0);
+      }
+      k(i, n) = real(0);
+      k(n, i) = real(0);
+    }
+    k(n, n) = real(0);
+  }  // end of resetStiffnessMatrix
+
+  std::pair<bool, real> PipeTest::computeElementsContributions(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
+      const tfel::math::vector<real>& u1,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_type eb,
+      const size_type ee) const {
+    using LE = PipeLinearElement;
+    using QE = PipeQuadraticElement;
+    using CE = PipeCubicElement;
     auto r_dt = real{};
-    for (size_type i = 0; i != ne; ++i) {
+    for (size_type i = eb; i != ee; ++i) {
       auto ri = std::pair<bool, real>{};
       if (this->mesh.etype == PipeMesh::LINEAR) {
         ri = LE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+            k, r, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
       } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
         ri = QE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+            k, r, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
       } else if (this->mesh.etype == PipeMesh::CUBIC) {
         ri = CE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+            k, r, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
       } else {
         tfel::raise(
             "PipeTest::computeStiffnessMatrixAndResidual: "
             "unknown element type");
       }
-      if (i == 0) {
+      if (i == eb) {
         r_dt = ri.second;
       }
       r_dt = std::min(r_dt, ri.second);
@@ -1263,7 +1414,7 @@ namespace mtest {
       }
     }
     return {true, r_dt};
-  }  // end of computeStiffnessMatrixAndResidual
+  }  // end of computeElementsContributions
 
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
@@ -1533,7 +1684,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->solveWithFactorizedStiffnessMatrix(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1556,7 +1707,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->solveWithFactorizedStiffnessMatrix(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1582,7 +1733,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      this->solveWithFactorizedStiffnessMatrix(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1606,6 +1757,33 @@ namespace mtest {
     }
   }  // end of computeLoadingCorrection
 
+  PipeTest::size_type PipeTest::getHalfBandwidth() const {
+    if (this->mesh.etype == PipeMesh::QUADRATIC) {
+      return 2;
+    } else if (this->mesh.etype == PipeMesh::CUBIC) {
+      return 3;
+    }
+    return 1;
+  }  // end of getHalfBandwidth
+
+  void PipeTest::solveLinearSystem(SolverWorkSpace& wk) const {
+    if (this->linear_solver == BANDED) {
+      wk.bsolver.factorize(wk.K, this->getHalfBandwidth());
+      wk.bsolver.solve(wk.du);
+    } else {
+      SingleStructureScheme::solveLinearSystem(wk);
+    }
+  }  // end of solveLinearSystem
+
+  void PipeTest::solveWithFactorizedStiffnessMatrix(
+      SolverWorkSpace& wk, tfel::math::vector<real>& x) const {
+    if (this->linear_solver == BANDED) {
+      wk.bsolver.solve(x);
+    } else {
+      SingleStructureScheme::solveWithFactorizedStiffnessMatrix(wk, x);
+    }
+  }  // end of solveWithFactorizedStiffnessMatrix
+
   bool PipeTest::postConvergence(StudyCurrentState& state,
                                  const real t,
                                  const real dt,
@@ -1691,39 +1869,39 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n,
                                           Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
@@ -2022,6 +2200,24 @@ namespace mtest {
     this->mesh.etype = ph;
   }  // end of setElementType
 
+  void PipeTest::setLinearSolver(const LinearSolver s) {
+    this->linear_solver = s;
+  }  // end of setLinearSolver
+
+  void PipeTest::setNumberOfThreads(const int n) {
+    tfel::raise_if(n < 1,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads (" +
+                       std::to_string(n) + ")");
+    this->twks.clear();
+    if (n == 1) {
+      this->pool.reset();
+    } else {
+      this->pool = std::make_unique<tfel::system::ThreadPool>(
+          static_cast<tfel::system::ThreadPool::size_type>(n));
+    }
+  }  // end of setNumberOfThreads
+
   void PipeTest::setMandrelRadiusEvolution(std::shared_ptr<Evolution> r) {
     this->mandrel_radius_evolution = r;
   }  // end of setMandrelRadiusEvolution
@@ -2143,15 +2339,55 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (!this->out) {
+    if ((this->bout == nullptr) && (!this->out)) {
       return;
     }
+    TraceEvent e("Output");
     const auto& u1 = state.u1;
     const auto n = this->getNumberOfNodes();
     // inner radius
     const auto Ri = this->mesh.inner_radius;
     // outer radius
     const auto Re = this->mesh.outer_radius;
+    if (this->bout != nullptr) {
+      auto& w = *(this->bout);
+      w.write(t);
+      w.write(Ri + u1[0]);
+      w.write(Re + u1[n - 1]);
+      w.write(u1[0]);
+      w.write(u1[n - 1]);
+      w.write(u1[n]);
+      if ((this->rl == IMPOSEDOUTERRADIUS) ||
+          (this->rl == IMPOSEDINNERRADIUS) || (this->rl == TIGHTPIPE) ||
+          (this->mandrel_radius_evolution != nullptr)) {
+        w.write(state.getEvolution("InnerPressure")(t));
+      }
+      if ((this->al == IMPOSEDAXIALGROWTH) ||
+          (this->mandrel_axial_growth_evolution != nullptr)) {
+        w.write(state.getEvolution("AxialForce")(t));
+      }
+      if (this->mandrel_radius_evolution != nullptr) {
+        const auto c =
+            state.containsParameter("MandrelContactStateAtEndOfTimeStep") &&
+            state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep");
+        w.write(c ? 1 : 0);
+      }
+      for (const auto& ao : this->aoutputs) {
+        w.write(ao.f(state));
+      }
+      if (this->inner_boundary_oxidation_model.model != nullptr) {
+        w.write(
+            getOxidationLength(state, this->inner_boundary_oxidation_model));
+      }
+      if (this->outer_boundary_oxidation_model.model != nullptr) {
+        w.write(
+            getOxidationLength(state, this->outer_boundary_oxidation_model));
+      }
+      for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
+        w.write(state.getFailureCriterionStatus(i) ? 1 : 0);
+      }
+      return;
+    }
     this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " " << u1[0]
               << " " << u1[n - 1] << " " << u1[n];
     if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
@@ -2175,8 +2411,7 @@ namespace mtest {
       }
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      this->out << " " << ao.f(state);
     }
     if (this->inner_boundary_oxidation_model.model != nullptr) {
       this->out << getOxidationLength(state,
@@ -228,6 +228,10 @@ namespace mtest {
     this->registerCallBack("@NumberOfElements",
                            &PipeTestParser::handleNumberOfElements);
     this->registerCallBack("@ElementType", &PipeTestParser::handleElementType);
+    this->registerCallBack("@LinearSolver",
+                           &PipeTestParser::handleLinearSolver);
+    this->registerCallBack("@NumberOfThreads",
+                           &PipeTestParser::handleNumberOfThreads);
     this->registerCallBack("@MandrelRadiusEvolution",
                            &PipeTestParser::handleMandrelRadiusEvolution);
     this->registerCallBack("@MandrelAxialGrowthEvolution",
@@ -383,6 +387,38 @@ namespace mtest {
                              this->tokens.end());
   }  // end of PipeTestParser::handleElementType
 
+  void PipeTestParser::handleLinearSolver(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleLinearSolver", p,
+                            this->tokens.end());
+    const auto& s = this->readString(p, this->tokens.end());
+    if (s == "Banded") {
+      t.setLinearSolver(PipeTest::BANDED);
+    } else if (s == "Dense") {
+      t.setLinearSolver(PipeTest::DENSE);
+    } else {
+      tfel::raise(
+          "PipeTestParser::handleLinearSolver: "
+          "invalid linear solver ('" +
+          s +
+          "').\n"
+          "Valid linear solvers are 'Banded' and 'Dense'");
+    }
+    this->checkNotEndOfLine("PipeTestParser::handleLinearSolver", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleLinearSolver", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleLinearSolver
+
+  void PipeTestParser::handleNumberOfThreads(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    t.setNumberOfThreads(this->readInt(p, this->tokens.end()));
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleNumberOfThreads
+
   void PipeTestParser::handleGasEquationOfState(PipeTest& t,
                                                 tokens_iterator& p) {
     const auto& e = this->readString(p, this->tokens.end());
@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/AccelerationAlgorithmFactory.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
@@ -312,7 +313,15 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    if ((!this->output.empty()) && (this->output_format == BINARYOUTPUT)) {
+      // the binary output file is opened by the `openBinaryOutputFile`
+      // method once the columns are known
+      if (this->bout != nullptr) {
+        this->bout.reset();
+        this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+            this->output, this->bout_columns);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -445,6 +454,35 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFormat(const OutputFormat f) {
+    this->output_format = f;
+  }  // end of setOutputFormat
+
+  void SchemeBase::openBinaryOutputFile(const std::vector<std::string>& c) {
+    if ((this->output.empty()) || (this->output_format != BINARYOUTPUT)) {
+      return;
+    }
+    this->bout_columns = c;
+    this->bout.reset();
+    this->bout = std::make_unique<tfel::utilities::BinaryDataWriter>(
+        this->output, this->bout_columns);
+  }  // end of openBinaryOutputFile
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->bout != nullptr) {
+      this->bout->flush();
+    } else {
+      this->out.flush();
+    }
+  }  // end of flushOutputFile
+
+  void SchemeBase::flushOutputFileOnError() const noexcept {
+    try {
+      this->flushOutputFile();
+    } catch (...) {
+    }
+  }  // end of flushOutputFileOnError
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
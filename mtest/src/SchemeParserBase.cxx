@@ -190,6 +190,23 @@ namespace mtest {
                              ";", p, this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFilePrecision
 
+  void SchemeParserBase::handleOutputFormat(SchemeBase& t,
+                                            tokens_iterator& p) {
+    const auto f = this->readString(p, this->tokens.end());
+    if (f == "text") {
+      t.setOutputFormat(SchemeBase::TEXTOUTPUT);
+    } else if (f == "binary") {
+      t.setOutputFormat(SchemeBase::BINARYOUTPUT);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleOutputFormat: "
+          "invalid format '" +
+          f + "'");
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFormat", ";", p,
+                             this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFormat
+
   void SchemeParserBase::handleResidualFile(SchemeBase& t, tokens_iterator& p) {
     t.setResidualFileName(this->readString(p, this->tokens.end()));
     this->readSpecifiedToken("SchemeParserBase::handleResidualFiles", ";", p,
@@ -747,6 +764,7 @@ namespace mtest {
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFormat", &SchemeParserBase::handleOutputFormat);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
@@ -11,10 +11,21 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Study.hxx"
 
 namespace mtest {
 
+  void Study::solveLinearSystem(SolverWorkSpace& wk) const {
+    tfel::math::LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+  }  // end of solveLinearSystem
+
+  void Study::solveWithFactorizedStiffnessMatrix(
+      SolverWorkSpace& wk, tfel::math::vector<real>& x) const {
+    tfel::math::LUSolve::back_substitute(wk.K, x, wk.x, wk.p_lu);
+  }  // end of solveWithFactorizedStiffnessMatrix
+
   Study::~Study() = default;
 
 }  // end of namespace mtest
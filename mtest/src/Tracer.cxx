@@ -0,0 +1,92 @@
+/*!
+ * \file   mtest/src/Tracer.cxx
+ * \brief  This file implements the `Tracer` and `TraceEvent` classes.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <fstream>
+#include "TFEL/Raise.hxx"
+#include "MTest/Tracer.hxx"
+
+namespace mtest {
+
+  Tracer& Tracer::getTracer() {
+    static Tracer t;
+    return t;
+  }  // end of getTracer
+
+  Tracer::Tracer() : origin(clock::now()), enabled(false) {}
+
+  void Tracer::enable(const std::string& f) {
+    tfel::raise_if(f.empty(), "Tracer::enable: empty file name");
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    this->file = f;
+    this->origin = clock::now();
+    this->enabled.store(true);
+  }  // end of enable
+
+  void Tracer::addEvent(const char* const n,
+                        const clock::time_point& s,
+                        const clock::time_point& e) {
+    using namespace std::chrono;
+    if (!this->isEnabled()) {
+      return;
+    }
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    const auto p = this->threads.insert({std::this_thread::get_id(),
+                                         this->threads.size()});
+    const auto start = duration_cast<microseconds>(s - this->origin).count();
+    const auto duration = duration_cast<microseconds>(e - s).count();
+    this->events.push_back({n, static_cast<std::int64_t>(start),
+                            static_cast<std::int64_t>(duration),
+                            p.first->second});
+  }  // end of addEvent
+
+  void Tracer::write() {
+    if (!this->isEnabled()) {
+      return;
+    }
+    auto lock = std::lock_guard<std::mutex>{this->m};
+    std::ofstream out(this->file);
+    tfel::raise_if(!out,
+                   "Tracer::write: can't open file '" + this->file + "'");
+    out << "{\"traceEvents\": [\n";
+    for (decltype(this->events.size()) i = 0; i != this->events.size(); ++i) {
+      const auto& e = this->events[i];
+      out << "{\"name\": \"" << e.name << "\", \"cat\": \"mtest\", "
+          << "\"ph\": \"X\", \"ts\": " << e.start << ", \"dur\": " << e.duration
+          << ", \"pid\": 0, \"tid\": " << e.thread << "}";
+      if (i + 1 != this->events.size()) {
+        out << ",";
+      }
+      out << '\n';
+    }
+    out << "],\n\"displayTimeUnit\": \"ms\"}\n";
+  }  // end of write
+
+  TraceEvent::TraceEvent(const char* const n) noexcept
+      : name(Tracer::getTracer().isEnabled() ? n : nullptr) {
+    if (this->name != nullptr) {
+      this->start = Tracer::clock::now();
+    }
+  }  // end of TraceEvent
+
+  TraceEvent::~TraceEvent() {
+    if (this->name == nullptr) {
+      return;
+    }
+    try {
+      Tracer::getTracer().addEvent(this->name, this->start,
+                                   Tracer::clock::now());
+    } catch (...) {
+    }
+  }  // end of ~TraceEvent
+
+}  // end of namespace mtest
@@ -27,6 +27,7 @@ namespace mtest {
     auto cevs = buildExternalFunctionManagerFromConstantEvolutions(this->evm);
     for (const auto& p : ps) {
       auto eval = std::make_shared<tfel::math::Evaluator>(p, cevs);
+      eval->compile();
       const auto& vns = eval->getVariablesNames();
       for (const auto& vn : vns) {
         if (isBehaviourVariable(b, vn)) {
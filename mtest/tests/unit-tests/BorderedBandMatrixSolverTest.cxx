@@ -0,0 +1,142 @@
+/*!
+ * \file   BorderedBandMatrixSolverTest.cxx
+ * \brief  This test compares the solutions given by the
+ * `BorderedBandMatrixSolver` class to the ones given by a dense LU
+ * decomposition.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "MTest/BorderedBandMatrixSolver.hxx"
+
+struct BorderedBandMatrixSolverTest final : public tfel::tests::TestCase {
+  BorderedBandMatrixSolverTest()
+      : tfel::tests::TestCase("MTest", "BorderedBandMatrixSolverTest") {
+  }  // end of BorderedBandMatrixSolverTest
+  tfel::tests::TestResult execute() override {
+    for (const auto w : {size_type(1), size_type(2), size_type(3)}) {
+      this->test1(w, false);
+      this->test1(w, true);
+    }
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief a simple alias
+  using real = mtest::real;
+  //! \brief a simple alias
+  using size_type = mtest::BorderedBandMatrixSolver::size_type;
+  //! \brief size of the first block
+  static constexpr size_type n = 12;
+  /*!
+   * \return a bordered banded matrix of size `n+1`
+   * \param[in] w: half-bandwidth of the first block
+   * \param[in] b: if true, the diagonal of the first block is null, which
+   * requires row interchanges
+   */
+  static tfel::math::matrix<real> makeMatrix(const size_type w,
+                                             const bool b) {
+    auto K = tfel::math::matrix<real>(n + 1, n + 1, real(0));
+    for (size_type i = 0; i != n; ++i) {
+      const auto jb = i > w ? i - w : size_type(0);
+      const auto je = std::min(i + w + 1, n);
+      for (size_type j = jb; j != je; ++j) {
+        K(i, j) = std::sin(real(3 * i + 7 * j + 1));
+      }
+      if (b) {
+        K(i, i) = real(0);
+      } else {
+        K(i, i) += real(4);
+      }
+      K(i, n) = std::cos(real(2 * i + 1));
+      K(n, i) = std::cos(real(5 * i + 3));
+    }
+    K(n, n) = real(3);
+    return K;
+  }  // end of makeMatrix
+  //! \return a right hand side
+  static tfel::math::vector<real> makeRightHandSide(const real a) {
+    auto x = tfel::math::vector<real>(n + 1);
+    for (size_type i = 0; i != n + 1; ++i) {
+      x[i] = std::cos(a * real(i + 1));
+    }
+    return x;
+  }  // end of makeRightHandSide
+  /*!
+   * \brief compare the solutions of the bordered banded solver to the ones
+   * of a dense LU decomposition for two right hand sides, so that the
+   * reuse of the factorization is also checked.
+   * \param[in] w: half-bandwidth of the first block
+   * \param[in] b: if true, the diagonal of the first block is null
+   */
+  void test1(const size_type w, const bool b) {
+    constexpr auto eps = real(1.e-12);
+    const auto K = makeMatrix(w, b);
+    auto s = mtest::BorderedBandMatrixSolver{};
+    s.factorize(K, w);
+    for (const auto a : {real(0.3), real(1.7)}) {
+      auto x1 = makeRightHandSide(a);
+      auto x2 = x1;
+      auto K2 = K;
+      tfel::math::LUSolve::exe(K2, x2);
+      s.solve(x1);
+      for (size_type i = 0; i != n + 1; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(x1[i] - x2[i]) <
+                          eps * std::max(real(1), std::abs(x2[i])));
+      }
+    }
+  }  // end of test1
+  //! \brief singular matrices and invalid arguments
+  void test2() {
+    auto s = mtest::BorderedBandMatrixSolver{};
+    // null first block
+    auto K = makeMatrix(2, false);
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        K(i, j) = real(0);
+      }
+    }
+    TFEL_TESTS_CHECK_THROW(s.factorize(K, 2), tfel::math::LUNullPivot);
+    // null Schur complement
+    auto K2 = tfel::math::matrix<real>(n + 1, n + 1, real(0));
+    for (size_type i = 0; i != n; ++i) {
+      K2(i, i) = real(1);
+    }
+    TFEL_TESTS_CHECK_THROW(s.factorize(K2, 1), tfel::math::LUNullPivot);
+    // unmatched sizes
+    s.factorize(makeMatrix(1, false), 1);
+    auto x = tfel::math::vector<real>(n, real(1));
+    TFEL_TESTS_CHECK_THROW(s.solve(x), std::runtime_error);
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BorderedBandMatrixSolverTest,
+                          "BorderedBandMatrixSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BorderedBandMatrixSolverTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -16,6 +16,8 @@
 #endif /* NDEBUG */
 
 #include <cmath>
+#include <thread>
+#include <vector>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
@@ -25,6 +27,7 @@
 #include "TFEL/Tests/TestManager.hxx"
 
 #include "MTest/Evolution.hxx"
+#include "MTest/FunctionEvolution.hxx"
 
 struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
   EvolutionTestUnitTest()
@@ -51,8 +54,43 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(lev->setValue(4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(cev->setValue(2., 4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(mtest::LPIEvolution({}, {})(2.), std::runtime_error);
+    this->testFunctionEvolution();
     return this->result;
   }  // end of execute()
+  //! \brief concurrent evaluations of a function evolution
+  void testFunctionEvolution() {
+    constexpr int nthreads = 4;
+    constexpr int nevaluations = 1000;
+    auto evm = mtest::EvolutionManager{};
+    evm["E"] = mtest::make_evolution(2.);
+    evm["T"] = mtest::make_evolution({{0., 1.}, {1., 3.}});
+    // `E` is a constant evolution, evaluated as an external function
+    const auto f = mtest::FunctionEvolution("E*t+sin(T)", evm);
+    const auto value = [](const double t) {
+      const auto T = (t < 0) ? 1. : ((t > 1) ? 3. : 1 + 2 * t);
+      return 2 * t + std::sin(T);
+    };
+    TFEL_TESTS_ASSERT(!f.isConstant());
+    TFEL_TESTS_ASSERT(std::abs(f(0.5) - value(0.5)) < 1.e-14);
+    auto success = std::vector<int>(nthreads, 1);
+    auto threads = std::vector<std::thread>{};
+    for (int th = 0; th != nthreads; ++th) {
+      threads.emplace_back([&f, &success, &value, th] {
+        for (int i = 0; i != nevaluations; ++i) {
+          const auto t = (th + 1) * 0.2 + i * 1.e-4;
+          if (std::abs(f(t) - value(t)) > 1.e-12) {
+            success[th] = 0;
+          }
+        }
+      });
+    }
+    for (auto& th : threads) {
+      th.join();
+    }
+    for (const auto s : success) {
+      TFEL_TESTS_ASSERT(s == 1);
+    }
+  }  // end of testFunctionEvolution
   //! destructor
   ~EvolutionTestUnitTest() override = default;
 };
@@ -0,0 +1,1043 @@
+/*!
+ * \file   src/Math/Bytecode.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <cerrno>
+#include <limits>
+#include <cstring>
+#include <functional>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/BinaryFunction.hxx"
+#include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
+
+namespace tfel::math::parser {
+
+  Bytecode::Bytecode(const std::vector<double>& v)
+      : variables(&v) {}  // end of Bytecode
+
+  bool Bytecode::isVariablesVector(const std::vector<double>& v) const
+      noexcept {
+    return this->variables == &v;
+  }  // end of isVariablesVector
+
+  bool Bytecode::empty() const noexcept {
+    return this->code.empty();
+  }  // end of empty
+
+  Bytecode::size_type Bytecode::size() const noexcept {
+    return this->code.size();
+  }  // end of size
+
+  Bytecode::size_type Bytecode::getStackSize() const noexcept {
+    return this->max_depth;
+  }  // end of getStackSize
+
+  Bytecode::size_type Bytecode::getNumberOfResults() const noexcept {
+    return this->operands.size();
+  }  // end of getNumberOfResults
+
+  bool Bytecode::isVectorizable() const noexcept {
+    return std::none_of(
+        this->code.begin(), this->code.end(), [](const Instruction& i) {
+          return (i.opcode == EXPRESSION) || (i.opcode == LOGICALEXPRESSION) ||
+                 (i.opcode == JUMPIFFALSE) || (i.opcode == JUMP);
+        });
+  }  // end of isVectorizable
+
+  bool Bytecode::isReentrant() const noexcept {
+    return std::none_of(
+        this->code.begin(), this->code.end(), [](const Instruction& i) {
+          return (i.opcode == EXPRESSION) || (i.opcode == LOGICALEXPRESSION);
+        });
+  }  // end of isReentrant
+
+  bool Bytecode::areIdentical(const Instruction& i1,
+                              const Instruction& i2) noexcept {
+    if (i1.opcode != i2.opcode) {
+      return false;
+    }
+    switch (i1.opcode) {
+      case NUMBER:
+        // bitwise comparison, so that 0 and -0 are distinguished
+        return std::memcmp(&(i1.value), &(i2.value), sizeof(double)) == 0;
+      case VARIABLE:
+      case JUMPIFFALSE:
+      case JUMP:
+      case SAVE:
+      case LOAD:
+        return i1.position == i2.position;
+      case FUNCTION:
+      case STANDARDFUNCTION:
+        return i1.f1 == i2.f1;
+      case STANDARDBINARYFUNCTION:
+        return i1.f2 == i2.f2;
+      case INTEGERPOWER:
+        return i1.exponent == i2.exponent;
+      case COMPARISON:
+        return i1.comparison == i2.comparison;
+      case LOGICALOPERATION:
+        return i1.logical_operator == i2.logical_operator;
+      case EXPRESSION:
+        return i1.expr == i2.expr;
+      case LOGICALEXPRESSION:
+        return i1.logical_expr == i2.logical_expr;
+      case NEGATION:
+      case ADDITION:
+      case SUBTRACTION:
+      case MULTIPLICATION:
+      case DIVISION:
+      case POWER:
+      case LOGICALNEGATION:
+        break;
+    }
+    return true;
+  }  // end of areIdentical
+
+  const Bytecode::SharedValue& Bytecode::getSavedValue(
+      const size_type k) const {
+    const auto p = std::find_if(
+        this->shared_values.begin(), this->shared_values.end(),
+        [k](const SharedValue& sv) { return sv.saved && (sv.slot == k); });
+    tfel::raise_if(p == this->shared_values.end(),
+                   "Bytecode::getSavedValue: invalid saved value");
+    return *p;
+  }  // end of getSavedValue
+
+  Bytecode::Signature Bytecode::getSignature(const size_type b,
+                                             const size_type e) const {
+    auto combine = [](std::size_t& h, const std::size_t v) {
+      h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+    };
+    // hashes of the values on the stack
+    auto hashes = std::vector<std::size_t>{};
+    auto n = size_type{};
+    for (auto p = b; p != e; ++p) {
+      const auto& i = this->code[p];
+      if (i.opcode == SAVE) {
+        continue;
+      }
+      if (i.opcode == LOAD) {
+        const auto& sv = this->getSavedValue(i.position);
+        hashes.push_back(sv.signature.hash);
+        n += sv.signature.size;
+        continue;
+      }
+      auto h = std::hash<int>{}(i.opcode);
+      auto np = size_type{2};
+      switch (i.opcode) {
+        case NUMBER:
+          combine(h, std::hash<double>{}(i.value));
+          np = 0;
+          break;
+        case VARIABLE:
+          combine(h, std::hash<size_type>{}(i.position));
+          np = 0;
+          break;
+        case EXPRESSION:
+        case LOGICALEXPRESSION:
+        case JUMPIFFALSE:
+        case JUMP:
+          np = 0;
+          break;
+        case FUNCTION:
+        case STANDARDFUNCTION:
+          combine(h, std::hash<UnaryFunctionPtr>{}(i.f1));
+          np = 1;
+          break;
+        case INTEGERPOWER:
+          combine(h, std::hash<int>{}(i.exponent));
+          np = 1;
+          break;
+        case NEGATION:
+        case LOGICALNEGATION:
+          np = 1;
+          break;
+        case STANDARDBINARYFUNCTION:
+          combine(h, std::hash<BinaryFunctionPtr>{}(i.f2));
+          break;
+        default:
+          break;
+      }
+      np = std::min(np, hashes.size());
+      for (auto k = hashes.size() - np; k != hashes.size(); ++k) {
+        combine(h, hashes[k]);
+      }
+      hashes.resize(hashes.size() - np);
+      hashes.push_back(h);
+      ++n;
+    }
+    return {hashes.empty() ? 0 : hashes.back(), n};
+  }  // end of getSignature
+
+  void Bytecode::expand(std::vector<Instruction>& l,
+                        const size_type b,
+                        const size_type e) const {
+    for (auto p = b; p != e; ++p) {
+      const auto& i = this->code[p];
+      if (i.opcode == SAVE) {
+        continue;
+      }
+      if (i.opcode == LOAD) {
+        const auto& sv = this->getSavedValue(i.position);
+        this->expand(l, sv.start, sv.end);
+        continue;
+      }
+      l.push_back(i);
+    }
+  }  // end of expand
+
+  bool Bytecode::isNumber(const size_type k, const double v) const noexcept {
+    const auto b = this->operands[k].start;
+    const auto e = (k + 1 < this->operands.size())
+                       ? this->operands[k + 1].start
+                       : this->code.size();
+    if ((e != b + 1) || (this->code[b].opcode != NUMBER)) {
+      return false;
+    }
+    const auto x = this->code[b].value;
+    return (x >= v) && (x <= v);
+  }  // end of isNumber
+
+  void Bytecode::truncate(const size_type p) {
+    // saved values which are no longer used
+    auto unused = std::vector<size_type>{};
+    for (auto q = p; q < this->code.size(); ++q) {
+      if (this->code[q].opcode == LOAD) {
+        const auto k = this->code[q].position;
+        --(this->loads[k]);
+        if (this->loads[k] == 0) {
+          unused.push_back(k);
+        }
+      }
+    }
+    for (const auto k : unused) {
+      for (auto& sv : this->shared_values) {
+        if (sv.saved && (sv.slot == k)) {
+          sv.saved = false;
+        }
+      }
+      this->free_slots.push_back(k);
+    }
+    this->code.resize(p);
+    this->shared_values.erase(
+        std::remove_if(this->shared_values.begin(), this->shared_values.end(),
+                       [p](const SharedValue& sv) { return sv.end > p; }),
+        this->shared_values.end());
+    this->fence = std::min(this->fence, p);
+    // remove the instructions saving unused values
+    for (const auto k : unused) {
+      const auto ps = std::find_if(
+          this->code.begin(), this->code.end(), [k](const Instruction& i) {
+            return (i.opcode == SAVE) && (i.position == k);
+          });
+      if (ps != this->code.end()) {
+        this->erase(static_cast<size_type>(ps - this->code.begin()));
+      }
+    }
+  }  // end of truncate
+
+  void Bytecode::erase(const size_type p) {
+    this->code.erase(this->code.begin() + static_cast<std::ptrdiff_t>(p));
+    auto update = [p](size_type& v) {
+      if (v > p) {
+        --v;
+      }
+    };
+    for (auto& o : this->operands) {
+      update(o.start);
+    }
+    for (auto& sv : this->shared_values) {
+      update(sv.start);
+      update(sv.end);
+    }
+    for (auto& c : this->conditions) {
+      update(c);
+    }
+    for (auto& i : this->code) {
+      if ((i.opcode == JUMP) || (i.opcode == JUMPIFFALSE)) {
+        update(i.position);
+      }
+    }
+    update(this->fence);
+  }  // end of erase
+
+  void Bytecode::insert(const size_type p, const Instruction& ni) {
+    auto update = [p](size_type& v) {
+      if (v >= p) {
+        ++v;
+      }
+    };
+    for (auto& i : this->code) {
+      if ((i.opcode == JUMP) || (i.opcode == JUMPIFFALSE)) {
+        update(i.position);
+      }
+    }
+    this->code.insert(this->code.begin() + static_cast<std::ptrdiff_t>(p),
+                      ni);
+    for (auto& o : this->operands) {
+      update(o.start);
+    }
+    for (auto& sv : this->shared_values) {
+      update(sv.start);
+      if (sv.end > p) {
+        ++(sv.end);
+      }
+    }
+    for (auto& c : this->conditions) {
+      update(c);
+    }
+    update(this->fence);
+  }  // end of insert
+
+  bool Bytecode::canFold(const size_type n) const noexcept {
+    if ((this->code.size() < n) || (this->code.size() - n < this->fence)) {
+      return false;
+    }
+    return std::all_of(
+        this->code.end() - static_cast<std::ptrdiff_t>(n), this->code.end(),
+        [](const Instruction& i) { return i.opcode == NUMBER; });
+  }  // end of canFold
+
+  bool Bytecode::fold(const Instruction& i, const size_type n) {
+    if (!this->canFold(n)) {
+      return false;
+    }
+    auto b = Bytecode(*(this->variables));
+    b.code.assign(this->code.end() - static_cast<std::ptrdiff_t>(n),
+                  this->code.end());
+    b.code.push_back(i);
+    b.max_depth = n;
+    auto r = double{};
+    try {
+      r = b.execute(nullptr);
+    } catch (...) {
+      // the error will be reported at runtime
+      return false;
+    }
+    this->truncate(this->code.size() - n);
+    this->operands.resize(this->operands.size() - n);
+    this->addNumber(r);
+    return true;
+  }  // end of fold
+
+  bool Bytecode::simplify(const Instruction& i) {
+    const auto n = this->operands.size();
+    // remove the value on top of the stack, which is a known value
+    auto drop_top = [this] {
+      this->truncate(this->operands.back().start);
+      this->operands.pop_back();
+      return true;
+    };
+    // remove the value below the top of the stack, which is a known value
+    auto drop_below = [this] {
+      const auto p = this->operands[this->operands.size() - 2].start;
+      this->operands.erase(this->operands.end() - 2);
+      this->erase(p);
+      return true;
+    };
+    switch (i.opcode) {
+      case NEGATION:
+        // -(-x) -> x. The last instruction must not end a conditional
+        // expression
+        if ((this->code.back().opcode == NEGATION) &&
+            (this->code.size() - 1 >= this->fence) &&
+            (this->code.size() - 1 > this->operands.back().start)) {
+          this->truncate(this->code.size() - 1);
+          return true;
+        }
+        break;
+      case ADDITION:
+        if (this->isNumber(n - 1, 0)) {
+          return drop_top();
+        }
+        if (this->isNumber(n - 2, 0)) {
+          return drop_below();
+        }
+        break;
+      case SUBTRACTION:
+        if (this->isNumber(n - 1, 0)) {
+          return drop_top();
+        }
+        if (this->isNumber(n - 2, 0)) {
+          drop_below();
+          this->addNegation();
+          return true;
+        }
+        break;
+      case MULTIPLICATION:
+        if (this->isNumber(n - 1, 1)) {
+          return drop_top();
+        }
+        if (this->isNumber(n - 2, 1)) {
+          return drop_below();
+        }
+        if (this->isNumber(n - 1, -1)) {
+          drop_top();
+          this->addNegation();
+          return true;
+        }
+        if (this->isNumber(n - 2, -1)) {
+          drop_below();
+          this->addNegation();
+          return true;
+        }
+        break;
+      case DIVISION:
+        if (this->isNumber(n - 1, 1)) {
+          return drop_top();
+        }
+        if (this->isNumber(n - 1, -1)) {
+          drop_top();
+          this->addNegation();
+          return true;
+        }
+        break;
+      case POWER:
+        if (this->isNumber(n - 1, 1)) {
+          return drop_top();
+        }
+        break;
+      case INTEGERPOWER:
+        return i.exponent == 1;
+      default:
+        break;
+    }
+    return false;
+  }  // end of simplify
+
+  void Bytecode::share() {
+    const auto b = this->operands.back().start;
+    const auto e = this->code.size();
+    // sharing is restricted to sub-programs which are always evaluated,
+    // i.e. outside conditional expressions
+    if ((!this->operands.back().shareable) || (!this->conditions.empty())) {
+      return;
+    }
+    const auto s = this->getSignature(b, e);
+    // sharing small sub-programs is not worth it
+    if (s.size < 3) {
+      return;
+    }
+    auto l1 = std::vector<Instruction>{};
+    auto l2 = std::vector<Instruction>{};
+    for (auto& sv : this->shared_values) {
+      if ((sv.signature.hash != s.hash) || (sv.signature.size != s.size) ||
+          (sv.end > b)) {
+        continue;
+      }
+      l1.clear();
+      l2.clear();
+      this->expand(l1, b, e);
+      this->expand(l2, sv.start, sv.end);
+      if (!std::equal(l1.begin(), l1.end(), l2.begin(), l2.end(),
+                      areIdentical)) {
+        continue;
+      }
+      if (!sv.saved) {
+        if (this->free_slots.empty()) {
+          if (this->loads.size() == maximumNumberOfSavedValues) {
+            return;
+          }
+          this->free_slots.push_back(this->loads.size());
+          this->loads.push_back(0);
+        }
+        sv.saved = true;
+        sv.slot = this->free_slots.back();
+        this->free_slots.pop_back();
+        auto save = Instruction{};
+        save.opcode = SAVE;
+        save.position = sv.slot;
+        this->insert(sv.end, save);
+      }
+      auto load = Instruction{};
+      load.opcode = LOAD;
+      load.position = sv.slot;
+      ++(this->loads[sv.slot]);
+      this->truncate(this->operands.back().start);
+      this->code.push_back(load);
+      return;
+    }
+    this->shared_values.push_back({b, e, s, false, 0});
+  }  // end of share
+
+  void Bytecode::add(const Instruction& i, const size_type np) {
+    tfel::raise_if(this->operands.size() < np,
+                   "Bytecode::add: "
+                   "invalid instruction (empty stack)");
+    if ((np != 0) && (this->fold(i, np))) {
+      return;
+    }
+    if ((np != 0) && (this->simplify(i))) {
+      return;
+    }
+    auto o = Operand{this->code.size(), true};
+    if (np != 0) {
+      const auto first =
+          this->operands.end() - static_cast<std::ptrdiff_t>(np);
+      o.start = first->start;
+      o.shareable = std::all_of(first, this->operands.end(),
+                                [](const Operand& a) { return a.shareable; });
+      this->operands.erase(first, this->operands.end());
+    }
+    this->code.push_back(i);
+    this->operands.push_back(o);
+    this->max_depth = std::max(this->max_depth, this->operands.size());
+    if (np != 0) {
+      this->share();
+    }
+  }  // end of add
+
+  void Bytecode::push(const Instruction& i) {
+    this->operands.push_back({this->code.size(), false});
+    this->code.push_back(i);
+    this->max_depth = std::max(this->max_depth, this->operands.size());
+  }  // end of push
+
+  void Bytecode::addNumber(const double v) {
+    auto i = Instruction{};
+    i.opcode = NUMBER;
+    i.value = v;
+    this->add(i, 0);
+  }  // end of addNumber
+
+  void Bytecode::addVariable(const size_type p) {
+    tfel::raise_if(p >= this->variables->size(),
+                   "Bytecode::addVariable: invalid variable position");
+    auto i = Instruction{};
+    i.opcode = VARIABLE;
+    i.position = p;
+    this->add(i, 0);
+  }  // end of addVariable
+
+  void Bytecode::addNegation() {
+    auto i = Instruction{};
+    i.opcode = NEGATION;
+    this->add(i, 1);
+  }  // end of addNegation
+
+  void Bytecode::addAddition() {
+    auto i = Instruction{};
+    i.opcode = ADDITION;
+    this->add(i, 2);
+  }  // end of addAddition
+
+  void Bytecode::addSubtraction() {
+    auto i = Instruction{};
+    i.opcode = SUBTRACTION;
+    this->add(i, 2);
+  }  // end of addSubtraction
+
+  void Bytecode::addMultiplication() {
+    auto i = Instruction{};
+    i.opcode = MULTIPLICATION;
+    this->add(i, 2);
+  }  // end of addMultiplication
+
+  void Bytecode::addDivision() {
+    auto i = Instruction{};
+    i.opcode = DIVISION;
+    this->add(i, 2);
+  }  // end of addDivision
+
+  void Bytecode::addPower() {
+    auto i = Instruction{};
+    i.opcode = POWER;
+    this->add(i, 2);
+  }  // end of addPower
+
+  void Bytecode::addFunction(const UnaryFunctionPtr f) {
+    auto i = Instruction{};
+    i.opcode = FUNCTION;
+    i.f1 = f;
+    this->add(i, 1);
+  }  // end of addFunction
+
+  void Bytecode::addStandardFunction(const UnaryFunctionPtr f) {
+    auto i = Instruction{};
+    i.opcode = STANDARDFUNCTION;
+    i.f1 = f;
+    this->add(i, 1);
+  }  // end of addStandardFunction
+
+  void Bytecode::addStandardBinaryFunction(const BinaryFunctionPtr f) {
+    auto i = Instruction{};
+    i.opcode = STANDARDBINARYFUNCTION;
+    i.f2 = f;
+    this->add(i, 2);
+  }  // end of addStandardBinaryFunction
+
+  void Bytecode::addIntegerPower(const int n) {
+    auto i = Instruction{};
+    i.opcode = INTEGERPOWER;
+    i.exponent = n;
+    this->add(i, 1);
+  }  // end of addIntegerPower
+
+  void Bytecode::addComparison(const ComparisonOperatorPtr op) {
+    auto i = Instruction{};
+    i.opcode = COMPARISON;
+    i.comparison = op;
+    this->add(i, 2);
+  }  // end of addComparison
+
+  void Bytecode::addLogicalOperation(const LogicalOperatorPtr op) {
+    auto i = Instruction{};
+    i.opcode = LOGICALOPERATION;
+    i.logical_operator = op;
+    this->add(i, 2);
+  }  // end of addLogicalOperation
+
+  void Bytecode::addLogicalNegation() {
+    auto i = Instruction{};
+    i.opcode = LOGICALNEGATION;
+    this->add(i, 1);
+  }  // end of addLogicalNegation
+
+  void Bytecode::addExpression(const Expr& e) {
+    auto i = Instruction{};
+    i.opcode = EXPRESSION;
+    i.expr = &e;
+    this->push(i);
+  }  // end of addExpression
+
+  void Bytecode::addLogicalExpression(const LogicalExpr& e) {
+    auto i = Instruction{};
+    i.opcode = LOGICALEXPRESSION;
+    i.logical_expr = &e;
+    this->push(i);
+  }  // end of addLogicalExpression
+
+  Bytecode::size_type Bytecode::addJumpIfFalse() {
+    tfel::raise_if(this->operands.empty(),
+                   "Bytecode::addJumpIfFalse: "
+                   "invalid instruction (empty stack)");
+    auto i = Instruction{};
+    i.opcode = JUMPIFFALSE;
+    i.position = 0;
+    // the condition is the first part of the conditional expression
+    this->conditions.push_back(this->operands.back().start);
+    this->operands.pop_back();
+    this->code.push_back(i);
+    return this->code.size() - 1;
+  }  // end of addJumpIfFalse
+
+  Bytecode::size_type Bytecode::addJump() {
+    tfel::raise_if(this->operands.empty(),
+                   "Bytecode::addJump: "
+                   "invalid instruction (empty stack)");
+    auto i = Instruction{};
+    i.opcode = JUMP;
+    i.position = 0;
+    // the value on top of the stack is the result of the first branch. The
+    // second branch will push its own result.
+    this->operands.pop_back();
+    this->code.push_back(i);
+    return this->code.size() - 1;
+  }  // end of addJump
+
+  void Bytecode::setJumpTarget(const size_type j) {
+    tfel::raise_if((j >= this->code.size()) ||
+                       ((this->code[j].opcode != JUMP) &&
+                        (this->code[j].opcode != JUMPIFFALSE)),
+                   "Bytecode::setJumpTarget: invalid jump");
+    this->code[j].position = this->code.size();
+    this->fence = this->code.size();
+    if (this->code[j].opcode == JUMP) {
+      // end of the conditional expression
+      tfel::raise_if(this->conditions.empty() || this->operands.empty(),
+                     "Bytecode::setJumpTarget: unmatched jump");
+      this->operands.back().start = this->conditions.back();
+      this->operands.back().shareable = false;
+      this->conditions.pop_back();
+    }
+  }  // end of setJumpTarget
+
+  bool Bytecode::popNumber(double& v) {
+    if (!this->canFold(1)) {
+      return false;
+    }
+    v = this->code.back().value;
+    this->truncate(this->code.size() - 1);
+    this->operands.pop_back();
+    return true;
+  }  // end of popNumber
+
+  double Bytecode::execute(const double* const v) const {
+    double stack[maximumStackSize];
+    double saved[maximumNumberOfSavedValues];
+    return *(this->run(stack, saved, v) - 1);
+  }  // end of execute
+
+  void Bytecode::execute(double* const r, const double* const v) const {
+    double stack[maximumStackSize];
+    double saved[maximumNumberOfSavedValues];
+    const auto* const top = this->run(stack, saved, v);
+    std::copy(static_cast<const double*>(stack), top, r);
+  }  // end of execute
+
+  double* Bytecode::run(double* const stack,
+                        double* const saved,
+                        const double* const v) const {
+    tfel::raise_if(this->code.empty(), "Bytecode::execute: empty program");
+    tfel::raise_if(this->max_depth > maximumStackSize,
+                   "Bytecode::execute: program requires too many registers");
+    // logical values are stored as 0 (false) and 1 (true)
+    // pointer past the top of the stack
+    auto* top = stack;
+    const auto* const pb = this->code.data();
+    const auto* const pe = pb + this->code.size();
+    for (auto* p = pb; p != pe; ++p) {
+      switch (p->opcode) {
+        case NUMBER:
+          *top = p->value;
+          ++top;
+          break;
+        case VARIABLE:
+          *top = v[p->position];
+          ++top;
+          break;
+        case NEGATION:
+          *(top - 1) = -*(top - 1);
+          break;
+        case ADDITION:
+          --top;
+          *(top - 1) += *top;
+          break;
+        case SUBTRACTION:
+          --top;
+          *(top - 1) -= *top;
+          break;
+        case MULTIPLICATION:
+          --top;
+          *(top - 1) *= *top;
+          break;
+        case DIVISION:
+          --top;
+          *(top - 1) = OpDiv::apply(*(top - 1), *top);
+          break;
+        case POWER:
+          --top;
+          *(top - 1) = std::pow(*(top - 1), *top);
+          break;
+        case FUNCTION:
+          *(top - 1) = p->f1(*(top - 1));
+          break;
+        case STANDARDFUNCTION: {
+          const auto arg = *(top - 1);
+          const auto old = errno;
+          errno = 0;
+          const auto r = p->f1(arg);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            FunctionBase::throwInvalidCallException(arg, e);
+          }
+          errno = old;
+          *(top - 1) = r;
+        } break;
+        case STANDARDBINARYFUNCTION: {
+          --top;
+          const auto old = errno;
+          errno = 0;
+          const auto r = p->f2(*(top - 1), *top);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            StandardBinaryFunctionBase::throwInvalidCallException(e);
+          }
+          errno = old;
+          *(top - 1) = r;
+        } break;
+        case INTEGERPOWER: {
+          const auto arg = *(top - 1);
+          const auto old = errno;
+          errno = 0;
+          const auto r = std::pow(arg, p->exponent);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            FunctionBase::throwInvalidCallException(arg, e);
+          }
+          errno = old;
+          *(top - 1) = r;
+        } break;
+        case COMPARISON:
+          --top;
+          *(top - 1) = p->comparison(*(top - 1), *top) ? 1 : 0;
+          break;
+        case LOGICALOPERATION:
+          --top;
+          *(top - 1) =
+              p->logical_operator(*(top - 1) > 0.5, *top > 0.5) ? 1 : 0;
+          break;
+        case LOGICALNEGATION:
+          *(top - 1) = (*(top - 1) > 0.5) ? 0 : 1;
+          break;
+        case EXPRESSION:
+          *top = p->expr->getValue();
+          ++top;
+          break;
+        case LOGICALEXPRESSION:
+          *top = p->logical_expr->getValue() ? 1 : 0;
+          ++top;
+          break;
+        case JUMPIFFALSE:
+          --top;
+          if (*top < 0.5) {
+            p = pb + p->position - 1;
+          }
+          break;
+        case JUMP:
+          p = pb + p->position - 1;
+          break;
+        case SAVE:
+          saved[p->position] = *(top - 1);
+          break;
+        case LOAD:
+          *top = saved[p->position];
+          ++top;
+          break;
+      }
+    }
+    return top;
+  }  // end of run
+
+  void Bytecode::execute(double* const r,
+                         const double* const* const args,
+                         const size_type n) const {
+    // registers, each register holding the values of a block of points
+    double stack[maximumStackSize][blockSize];
+    // values shared between sub-programs
+    double saved[maximumNumberOfSavedValues][blockSize];
+    tfel::raise_if(this->code.empty(), "Bytecode::execute: empty program");
+    tfel::raise_if(this->max_depth > maximumStackSize,
+                   "Bytecode::execute: program requires too many registers");
+    tfel::raise_if(!this->isVectorizable(),
+                   "Bytecode::execute: program can't be evaluated by blocks");
+    tfel::raise_if(this->operands.size() != 1,
+                   "Bytecode::execute: program must return one value");
+    // apply a standard function reporting errors through errno on the
+    // values of a register
+    auto apply_standard_function = [](double* const a, const size_type s,
+                                      const auto& f) {
+      const auto old = errno;
+      errno = 0;
+      for (size_type k = 0; k != s; ++k) {
+        a[k] = f(a[k]);
+      }
+      const auto e = errno;
+      errno = old;
+      return e;
+    };
+    // apply a standard function given by a pointer on the values of a
+    // register. The most common functions are applied by dedicated loops
+    // which call them directly rather than through the pointer.
+    auto apply_standard_function_ptr = [&apply_standard_function](
+                                           double* const a, const size_type s,
+                                           const UnaryFunctionPtr f) {
+      if (f == static_cast<UnaryFunctionPtr>(::exp)) {
+        return apply_standard_function(
+            a, s, [](const double x) { return std::exp(x); });
+      } else if (f == static_cast<UnaryFunctionPtr>(::log)) {
+        return apply_standard_function(
+            a, s, [](const double x) { return std::log(x); });
+      } else if (f == static_cast<UnaryFunctionPtr>(::sqrt)) {
+        return apply_standard_function(
+            a, s, [](const double x) { return std::sqrt(x); });
+      } else if (f == static_cast<UnaryFunctionPtr>(::sin)) {
+        return apply_standard_function(
+            a, s, [](const double x) { return std::sin(x); });
+      } else if (f == static_cast<UnaryFunctionPtr>(::cos)) {
+        return apply_standard_function(
+            a, s, [](const double x) { return std::cos(x); });
+      }
+      return apply_standard_function(a, s, f);
+    };
+    for (size_type o = 0; o < n; o += blockSize) {
+      const auto s = std::min(blockSize, n - o);
+      // number of registers in use
+      auto top = size_type{};
+      for (const auto& i : this->code) {
+        switch (i.opcode) {
+          case NUMBER:
+            std::fill(stack[top], stack[top] + s, i.value);
+            ++top;
+            break;
+          case VARIABLE:
+            if (args[i.position] == nullptr) {
+              std::fill(stack[top], stack[top] + s,
+                        (*(this->variables))[i.position]);
+            } else {
+              std::copy(args[i.position] + o, args[i.position] + o + s,
+                        stack[top]);
+            }
+            ++top;
+            break;
+          case NEGATION: {
+            auto* const a = stack[top - 1];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = -a[k];
+            }
+          } break;
+          case ADDITION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] += b[k];
+            }
+          } break;
+          case SUBTRACTION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] -= b[k];
+            }
+          } break;
+          case MULTIPLICATION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] *= b[k];
+            }
+          } break;
+          case DIVISION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            const auto pb = std::find_if(b, b + s, [](const double v) {
+              return std::abs(v) < std::numeric_limits<double>::min();
+            });
+            if (pb != b + s) {
+              // report the error
+              OpDiv::apply(a[pb - b], *pb);
+            }
+            for (size_type k = 0; k != s; ++k) {
+              a[k] /= b[k];
+            }
+          } break;
+          case POWER: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = std::pow(a[k], b[k]);
+            }
+          } break;
+          case FUNCTION: {
+            auto* const a = stack[top - 1];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = i.f1(a[k]);
+            }
+          } break;
+          case STANDARDFUNCTION: {
+            auto* const a = stack[top - 1];
+            double tmp[blockSize];
+            std::copy(a, a + s, tmp);
+            const auto e = apply_standard_function_ptr(a, s, i.f1);
+            if (e != 0) {
+              // the faulty argument is searched to report the error
+              for (size_type k = 0; k != s; ++k) {
+                errno = 0;
+                i.f1(tmp[k]);
+                if (errno != 0) {
+                  FunctionBase::throwInvalidCallException(tmp[k], e);
+                }
+              }
+              FunctionBase::throwInvalidCallException(tmp[0], e);
+            }
+          } break;
+          case STANDARDBINARYFUNCTION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            const auto old = errno;
+            errno = 0;
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = i.f2(a[k], b[k]);
+            }
+            const auto e = errno;
+            errno = old;
+            if (e != 0) {
+              StandardBinaryFunctionBase::throwInvalidCallException(e);
+            }
+          } break;
+          case INTEGERPOWER: {
+            auto* const a = stack[top - 1];
+            double tmp[blockSize];
+            std::copy(a, a + s, tmp);
+            const auto e = apply_standard_function(
+                a, s, [&i](const double x) { return std::pow(x, i.exponent); });
+            if (e != 0) {
+              for (size_type k = 0; k != s; ++k) {
+                errno = 0;
+                std::pow(tmp[k], i.exponent);
+                if (errno != 0) {
+                  FunctionBase::throwInvalidCallException(tmp[k], e);
+                }
+              }
+              FunctionBase::throwInvalidCallException(tmp[0], e);
+            }
+          } break;
+          case COMPARISON: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = i.comparison(a[k], b[k]) ? 1 : 0;
+            }
+          } break;
+          case LOGICALOPERATION: {
+            --top;
+            auto* const a = stack[top - 1];
+            const auto* const b = stack[top];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = i.logical_operator(a[k] > 0.5, b[k] > 0.5) ? 1 : 0;
+            }
+          } break;
+          case LOGICALNEGATION: {
+            auto* const a = stack[top - 1];
+            for (size_type k = 0; k != s; ++k) {
+              a[k] = (a[k] > 0.5) ? 0 : 1;
+            }
+          } break;
+          case SAVE:
+            std::copy(stack[top - 1], stack[top - 1] + s,
+                      saved[i.position]);
+            break;
+          case LOAD:
+            std::copy(saved[i.position], saved[i.position] + s, stack[top]);
+            ++top;
+            break;
+          case EXPRESSION:
+          case LOGICALEXPRESSION:
+          case JUMPIFFALSE:
+          case JUMP:
+            // excluded by isVectorizable
+            break;
+        }
+      }
+      std::copy(stack[0], stack[0] + s, r + o);
+    }
+  }  // end of execute
+
+  Bytecode::~Bytecode() = default;
+
+}  // end of namespace tfel::math::parser
@@ -15,6 +15,7 @@
 #include <limits>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/ConditionalExpr.hxx"
 
 namespace tfel::math::parser {
@@ -44,6 +45,26 @@ namespace tfel::math::parser {
     return this->b->getValue();
   }  // end of ConditionalExpr::getValue() const
 
+  void ConditionalExpr::compile(Bytecode& bc) const {
+    this->c->compile(bc);
+    auto v = double{};
+    if (bc.popNumber(v)) {
+      // the condition is known at compile-time
+      if (v > 0.5) {
+        this->a->compile(bc);
+      } else {
+        this->b->compile(bc);
+      }
+      return;
+    }
+    const auto j1 = bc.addJumpIfFalse();
+    this->a->compile(bc);
+    const auto j2 = bc.addJump();
+    bc.setJumpTarget(j1);
+    this->b->compile(bc);
+    bc.setJumpTarget(j2);
+  }  // end of ConditionalExpr::compile
+
   std::string ConditionalExpr::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "(" + this->c->getCxxFormula(m) + ") ? " + "(" +
@@ -1235,7 +1235,171 @@ namespace tfel::math {
     return this->getValue();
   }  // end of getValue
 
+  std::unique_ptr<tfel::math::parser::Bytecode> Evaluator::buildBytecode()
+      const {
+    raise_if(this->expr == nullptr,
+             "Evaluator::buildBytecode: "
+             "uninitialized expression.");
+    auto b = std::make_unique<tfel::math::parser::Bytecode>(this->variables);
+    this->expr->compile(*b);
+    if (b->getStackSize() > tfel::math::parser::Bytecode::maximumStackSize) {
+      return {};
+    }
+    return b;
+  }  // end of buildBytecode
+
+  void Evaluator::compile() {
+    this->bytecode = this->buildBytecode();
+  }  // end of compile
+
+  double Evaluator::getValueAndGradient(
+      double* const g,
+      const std::vector<std::vector<double>::size_type>& vs) {
+    raise_if(this->expr == nullptr,
+             "Evaluator::getValueAndGradient: "
+             "uninitialized expression.");
+    if ((this->gradient_variables != vs) ||
+        (this->gradient.size() != vs.size())) {
+      this->gradient_variables.clear();
+      this->gradient.clear();
+      this->gradient_bytecode.reset();
+      for (const auto p : vs) {
+        raise_if(p >= this->variables.size(),
+                 "Evaluator::getValueAndGradient: "
+                 "invalid variable position");
+        this->gradient.push_back(this->expr->differentiate(p, this->variables));
+      }
+      this->gradient_variables = vs;
+      auto b = std::make_unique<tfel::math::parser::Bytecode>(this->variables);
+      this->expr->compile(*b);
+      for (const auto& d : this->gradient) {
+        d->compile(*b);
+      }
+      if (b->getStackSize() <= tfel::math::parser::Bytecode::maximumStackSize) {
+        this->gradient_bytecode = std::move(b);
+      }
+    }
+    if (this->gradient_bytecode != nullptr) {
+      double r[tfel::math::parser::Bytecode::maximumStackSize];
+      this->gradient_bytecode->execute(r, this->variables.data());
+      std::copy(r + 1, r + 1 + vs.size(), g);
+      return r[0];
+    }
+    for (decltype(vs.size()) i = 0; i != vs.size(); ++i) {
+      g[i] = this->gradient[i]->getValue();
+    }
+    return this->getValue();
+  }  // end of getValueAndGradient
+
+  void Evaluator::getValues(double* const r,
+                            const std::vector<const double*>& args,
+                            const std::vector<double>::size_type n) {
+    using size_type = std::vector<double>::size_type;
+    raise_if(args.size() != this->variables.size(),
+             "Evaluator::getValues: invalid number of arguments");
+    auto lb = std::unique_ptr<tfel::math::parser::Bytecode>{};
+    if (this->bytecode == nullptr) {
+      lb = this->buildBytecode();
+    }
+    const auto* const b =
+        (this->bytecode != nullptr) ? this->bytecode.get() : lb.get();
+    if ((b != nullptr) && (b->isVectorizable())) {
+      b->execute(r, args.data(), n);
+      return;
+    }
+    // some nodes, such as external functions, read the values of the
+    // variables stored in the evaluator. Those values are restored once
+    // all the points are treated
+    const auto values = this->variables;
+    try {
+      for (size_type k = 0; k != n; ++k) {
+        for (size_type i = 0; i != args.size(); ++i) {
+          if (args[i] != nullptr) {
+            this->variables[i] = args[i][k];
+          }
+        }
+        r[k] = (b != nullptr) ? b->execute(this->variables.data())
+                              : this->expr->getValue();
+      }
+    } catch (...) {
+      this->variables = values;
+      throw;
+    }
+    this->variables = values;
+  }  // end of getValues
+
+  void Evaluator::getValues(double* const r,
+                            const std::map<std::string, const double*>& args,
+                            const std::vector<double>::size_type n) {
+    auto pargs = std::vector<const double*>(this->variables.size(), nullptr);
+    for (const auto& a : args) {
+      pargs[this->getVariablePosition(a.first)] = a.second;
+    }
+    this->getValues(r, pargs, n);
+  }  // end of getValues
+
+  bool Evaluator::isCompiled() const noexcept {
+    return this->bytecode != nullptr;
+  }  // end of isCompiled
+
+  Evaluator::EvaluationContext Evaluator::makeEvaluationContext() const {
+    auto c = EvaluationContext{this->variables, nullptr};
+    if (!this->isReentrant()) {
+      raise_if(this->expr == nullptr,
+               "Evaluator::makeEvaluationContext: "
+               "uninitialized evaluator");
+      // the external functions are replaced by private copies
+      this->checkCyclicDependency();
+      c.evaluator = std::make_unique<Evaluator>(*this);
+      auto& e = *(c.evaluator);
+      e.expr = e.expr->resolveDependencies(e.variables);
+      if (e.bytecode != nullptr) {
+        e.compile();
+      }
+    }
+    return c;
+  }  // end of makeEvaluationContext
+
+  void Evaluator::setVariableValue(EvaluationContext& c,
+                                   const std::string& n,
+                                   const double v) const {
+    this->setVariableValue(c, this->getVariablePosition(n), v);
+  }  // end of setVariableValue
+
+  void Evaluator::setVariableValue(EvaluationContext& c,
+                                   const std::vector<double>::size_type p,
+                                   const double v) const {
+    raise_if(p >= c.variables.size(),
+             "Evaluator::setVariableValue: "
+             "position '" +
+                 std::to_string(p) + "' is invalid (" +
+                 std::to_string(c.variables.size()) + " variables defined)");
+    c.variables[p] = v;
+  }  // end of setVariableValue
+
+  bool Evaluator::isReentrant() const noexcept {
+    return (this->bytecode != nullptr) && (this->bytecode->isReentrant());
+  }  // end of isReentrant
+
+  double Evaluator::getValue(const EvaluationContext& c) const {
+    raise_if(c.variables.size() != this->positions.size(),
+             "Evaluator::getValue: invalid evaluation context");
+    if (this->isReentrant()) {
+      return this->bytecode->execute(c.variables.data());
+    }
+    raise_if(c.evaluator == nullptr,
+             "Evaluator::getValue: invalid evaluation context");
+    // the expression tree reads the values of the variables stored in the
+    // private copy of the evaluator
+    auto& e = *(c.evaluator);
+    std::copy(c.variables.begin(), c.variables.end(), e.variables.begin());
+    return e.getValue();
+  }  // end of getValue
+
   double Evaluator::getValue() const {
+    if (this->bytecode != nullptr) {
+      return this->bytecode->execute(this->variables.data());
+    }
     raise_if(this->expr == nullptr,
              "Evaluator::getValue: "
              "uninitialized expression.");
@@ -1300,6 +1464,9 @@ namespace tfel::math {
     if (src.expr != nullptr) {
       this->expr = src.expr->clone(this->variables);
     }
+    if (src.bytecode != nullptr) {
+      this->compile();
+    }
   }  // end of Evaluator
 
   Evaluator& Evaluator::operator=(const Evaluator& src) {
@@ -1307,11 +1474,18 @@ namespace tfel::math {
       this->variables = src.variables;
       this->positions = src.positions;
       this->manager = src.manager;
+      this->bytecode.reset();
+      this->gradient_variables.clear();
+      this->gradient.clear();
+      this->gradient_bytecode.reset();
       if (src.expr != nullptr) {
         this->expr = src.expr->clone(this->variables);
       } else {
         this->expr.reset();
       }
+      if (src.bytecode != nullptr) {
+        this->compile();
+      }
     }
     return *this;
   }  // end of Evaluator
@@ -1349,6 +1523,10 @@ namespace tfel::math {
     this->variables.clear();
     this->positions.clear();
     this->expr.reset();
+    this->bytecode.reset();
+    this->gradient_variables.clear();
+    this->gradient.clear();
+    this->gradient_bytecode.reset();
     this->manager.reset();
   }
 
@@ -1435,6 +1613,9 @@ namespace tfel::math {
       }
       pev->expr = this->expr->differentiate(pos, pev->variables);
     }
+    if (this->bytecode != nullptr) {
+      pev->compile();
+    }
     return std::move(pev);
   }  // end of differentiate
 
@@ -1448,12 +1629,21 @@ namespace tfel::math {
     this->checkCyclicDependency();
     auto f = std::make_shared<Evaluator>(*this);
     f->expr = f->expr->resolveDependencies(f->variables);
+    if (f->bytecode != nullptr) {
+      f->compile();
+    }
     return std::move(f);
   }  // end of resolveDependencies() const
 
   void Evaluator::removeDependencies() {
     this->checkCyclicDependency();
     this->expr = this->expr->resolveDependencies(this->variables);
+    this->gradient_variables.clear();
+    this->gradient.clear();
+    this->gradient_bytecode.reset();
+    if (this->bytecode != nullptr) {
+      this->compile();
+    }
   }  // end of removeDependencies() const
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
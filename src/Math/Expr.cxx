@@ -15,10 +15,15 @@
 #include <algorithm>
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
 
 namespace tfel::math::parser {
 
+  void Expr::compile(Bytecode& b) const {
+    b.addExpression(*this);
+  }  // end of compile
+
   Expr::~Expr() = default;
 
   void mergeVariablesNames(std::vector<std::string>& v,
@@ -12,10 +12,27 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 
 namespace tfel::math::parser {
 
+  void ExternalFunction::getValues(
+      double* const r,
+      const std::vector<const double*>& args,
+      const std::vector<double>::size_type n) {
+    raise_if(args.size() != this->getNumberOfVariables(),
+             "ExternalFunction::getValues: invalid number of arguments");
+    for (std::vector<double>::size_type k = 0; k != n; ++k) {
+      for (std::vector<double>::size_type i = 0; i != args.size(); ++i) {
+        if (args[i] != nullptr) {
+          this->setVariableValue(i, args[i][k]);
+        }
+      }
+      r[k] = this->getValue();
+    }
+  }  // end of getValues
+
   ExternalFunction::~ExternalFunction() = default;
 
 }  // end of namespace tfel::math::parser
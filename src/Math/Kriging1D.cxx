@@ -51,6 +51,17 @@ namespace tfel::math {
     return Kriging<1u, double>::operator()(this->a* vx + this->b);
   }  // end of Kriging1D::operator()
 
+  std::vector<double> Kriging1D::operator()(
+      const std::vector<double>& vx) const {
+    auto p = std::vector<double>(vx.size());
+    for (std::vector<double>::size_type i = 0; i != vx.size(); ++i) {
+      p[i] = this->a * vx[i] + this->b;
+    }
+    auto r = std::vector<double>(vx.size());
+    Kriging<1u, double>::evaluate(r.data(), p.data(), p.size());
+    return r;
+  }  // end of Kriging1D::operator()
+
   Kriging1D::~Kriging1D() = default;
 
 }  // end of namespace tfel::math
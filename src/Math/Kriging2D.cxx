@@ -69,6 +69,19 @@ namespace tfel::math {
     return Kriging<2u, double>::operator()(v);
   }  // end of Kriging2D::operator()
 
+  std::vector<double> Kriging2D::operator()(
+      const std::vector<double>& vx, const std::vector<double>& vy) const {
+    raise_if<KrigingErrorInvalidLength>(vx.size() != vy.size());
+    auto p = std::vector<tvector<2u, double>>(vx.size());
+    for (std::vector<double>::size_type i = 0; i != vx.size(); ++i) {
+      p[i](0) = this->a1 * vx[i] + this->b1;
+      p[i](1) = this->a2 * vy[i] + this->b2;
+    }
+    auto r = std::vector<double>(vx.size());
+    Kriging<2u, double>::evaluate(r.data(), p.data(), p.size());
+    return r;
+  }  // end of Kriging2D::operator()
+
   Kriging2D::~Kriging2D() = default;
 
 }  // end of namespace tfel::math
@@ -92,6 +92,23 @@ namespace tfel::math {
     return Kriging<3u, double>::operator()(v);
   }  // end of Kriging3D::operator()
 
+  std::vector<double> Kriging3D::operator()(
+      const std::vector<double>& vx,
+      const std::vector<double>& vy,
+      const std::vector<double>& vz) const {
+    raise_if<KrigingErrorInvalidLength>((vx.size() != vy.size()) ||
+                                        (vx.size() != vz.size()));
+    auto p = std::vector<tvector<3u, double>>(vx.size());
+    for (std::vector<double>::size_type i = 0; i != vx.size(); ++i) {
+      p[i](0) = this->a1 * vx[i] + this->b1;
+      p[i](1) = this->a2 * vy[i] + this->b2;
+      p[i](2) = this->a3 * vz[i] + this->b3;
+    }
+    auto r = std::vector<double>(vx.size());
+    Kriging<3u, double>::evaluate(r.data(), p.data(), p.size());
+    return r;
+  }  // end of Kriging3D::operator()
+
   Kriging3D::~Kriging3D() = default;
 
 }  // end of namespace tfel::math
@@ -22,7 +22,7 @@ namespace tfel::math::parser {
       std::shared_ptr<tfel::math::Evaluator> ev_,
       const LevenbergMarquardtEvaluatorWrapper::size_type nv_,
       const LevenbergMarquardtEvaluatorWrapper::size_type np_)
-      : ev(std::move(ev_)), dev(np_), nv(nv_), np(np_) {
+      : ev(std::move(ev_)), parameters(np_), nv(nv_), np(np_) {
     using tfel::math::vector;
     auto throw_if = [](const bool b, const std::string& m) {
       raise_if(b, "EvaluatorBase::splitAtTokenSeperator: " + m);
@@ -37,7 +37,7 @@ namespace tfel::math::parser {
     throw_if(this->getNumberOfParameters() == 0, "null parameters number");
     for (vector<double>::size_type i = 0; i != this->getNumberOfParameters();
          ++i) {
-      this->dev[i] = this->ev->differentiate(this->getNumberOfVariables() + i);
+      this->parameters[i] = this->getNumberOfVariables() + i;
     }
   }  // end of
      // LevenbergMarquardtEvaluatorWrapper::LevenbergMarquardtEvaluatorWrapper
@@ -68,22 +68,15 @@ namespace tfel::math::parser {
     g.resize(this->getNumberOfParameters());
     for (const auto& v : variables) {
       this->ev->setVariableValue(i, v);
-      for (const auto& d : this->dev) {
-        d->setVariableValue(i, v);
-      }
       ++i;
     }
     for (const auto& p : params) {
       this->ev->setVariableValue(i, p);
-      for (const auto& d : this->dev) {
-        d->setVariableValue(i, p);
-      }
       ++i;
     }
-    r = this->ev->getValue();
-    for (i = 0; i != dev.size(); ++i) {
-      g[i] = dev[i]->getValue();
-    }
+    // the value and the derivatives with respect to the parameters are
+    // computed at once
+    r = this->ev->getValueAndGradient(g.data(), this->parameters);
   }  // end of LevenbergMarquardtEvaluatorWrapper::operator()
 
   LevenbergMarquardtEvaluatorWrapper::~LevenbergMarquardtEvaluatorWrapper() =
@@ -14,6 +14,7 @@
 #include <cmath>
 #include <limits>
 #include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/LogicalExpr.hxx"
 
 namespace tfel::math::parser {
@@ -79,6 +80,10 @@ namespace tfel::math::parser {
     return '(' + a + ")||(" + b + ')';
   }  // end of OpOr::getCxxFormula
 
+  void LogicalExpr::compile(Bytecode& b) const {
+    b.addLogicalExpression(*this);
+  }  // end of compile
+
   LogicalExpr::~LogicalExpr() = default;
 
   NegLogicalExpression::NegLogicalExpression(
@@ -98,6 +103,11 @@ namespace tfel::math::parser {
     return !this->a->getValue();
   }  // end of getValue
 
+  void NegLogicalExpression::compile(Bytecode& b) const {
+    this->a->compile(b);
+    b.addLogicalNegation();
+  }  // end of compile
+
   std::string NegLogicalExpression::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "!(" + this->a->getCxxFormula(m) + ")";
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/Negation.hxx"
 
 namespace tfel::math::parser {
@@ -36,6 +37,11 @@ namespace tfel::math::parser {
     return -(this->expr->getValue());
   }  // end of getValue()
 
+  void Negation::compile(Bytecode& b) const {
+    this->expr->compile(b);
+    b.addNegation();
+  }  // end of compile
+
   void Negation::checkCyclicDependency(std::vector<std::string>& names) const {
     this->expr->checkCyclicDependency(names);
   }  // end of checkCyclicDependency
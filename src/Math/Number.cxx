@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
 
 namespace tfel::math::parser {
@@ -39,6 +40,10 @@ namespace tfel::math::parser {
 
   double Number::getValue() const { return this->value; }  // end of getValue
 
+  void Number::compile(Bytecode& b) const {
+    b.addNumber(this->value);
+  }  // end of compile
+
   void Number::getParametersNames(std::set<std::string>&) const {
   }  // end of getParametersNames
 
@@ -12,6 +12,7 @@
  */
 
 #include <cmath>
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/PowerFunction.hxx"
 
 namespace tfel::math::parser {
@@ -35,6 +36,11 @@ namespace tfel::math::parser {
     return res;
   }  // end of getValue
 
+  void GeneralPowerFunction::compile(Bytecode& b) const {
+    this->expr->compile(b);
+    b.addIntegerPower(this->n);
+  }  // end of compile
+
   std::string GeneralPowerFunction::getCxxFormula(
       const std::vector<std::string>& m) const {
     const auto a = this->expr->getCxxFormula(m);
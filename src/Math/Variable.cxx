@@ -16,6 +16,7 @@
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
 #include "TFEL/Math/Parser/Variable.hxx"
 
 namespace tfel::math::parser {
@@ -35,6 +36,14 @@ namespace tfel::math::parser {
     return this->v[this->pos];
   }  // end of Variable::getValue
 
+  void Variable::compile(Bytecode& b) const {
+    if (b.isVariablesVector(this->v)) {
+      b.addVariable(this->pos);
+    } else {
+      b.addExpression(*this);
+    }
+  }  // end of Variable::compile
+
   std::string Variable::getCxxFormula(const std::vector<std::string>& m) const {
     tfel::raise_if(this->pos >= m.size(),
                    "Variable::getCxxFormula: "
@@ -0,0 +1,204 @@
+/*!
+ * \file   src/System/ExternalLibraryIndex.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+#include <dlfcn.h>
+#endif /* !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)) */
+
+#include "TFEL/System/LibraryInformation.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalLibraryIndex.hxx"
+
+namespace tfel::system {
+
+  //! \return the description of the last failed lookup of the thread
+  static std::string& getLastLookupErrorReference() {
+    thread_local std::string e;
+    return e;
+  }  // end of getLastLookupErrorReference
+
+  /*!
+   * \return the cached array associated with the given symbol, decoding it
+   * if required
+   * \param[in] m: mutex protecting the cache
+   * \param[in] c: cache
+   * \param[in] s: symbol
+   * \param[in] nb: size of the array or -1 if not defined
+   * \param[in] a: array or a null pointer if not defined
+   */
+  template <typename ValueType, typename ArrayValueType>
+  static const std::vector<ValueType>* getCachedArray(
+      std::shared_mutex& m,
+      std::map<std::string, std::vector<ValueType>, std::less<>>& c,
+      const std::string& s,
+      const int nb,
+      const ArrayValueType* const a) {
+    if ((nb == -1) || (a == nullptr)) {
+      return nullptr;
+    }
+    auto values = std::vector<ValueType>(a, a + nb);
+    std::unique_lock<std::shared_mutex> lock(m);
+    return &(c.insert({s, std::move(values)}).first->second);
+  }  // end of getCachedArray
+
+  ExternalLibraryIndex::ExternalLibraryIndex(const LibraryHandle h,
+                                             const std::string& n)
+      : handle(h), name(n) {}  // end of ExternalLibraryIndex
+
+  ExternalLibraryIndex::LibraryHandle ExternalLibraryIndex::getLibraryHandle()
+      const noexcept {
+    return this->handle;
+  }  // end of getLibraryHandle
+
+  const std::string& ExternalLibraryIndex::getLibraryName() const noexcept {
+    return this->name;
+  }  // end of getLibraryName
+
+  std::string ExternalLibraryIndex::getLastLookupError() {
+    return getLastLookupErrorReference();
+  }  // end of getLastLookupError
+
+  void* ExternalLibraryIndex::getSymbol(const std::string& s) const {
+    // the error of a previous lookup is discarded
+    getLastLookupErrorReference().clear();
+    auto check = [this, &s](void* const a) {
+      if (a == nullptr) {
+        getLastLookupErrorReference() =
+            "undefined symbol '" + s + "' in library '" + this->name + "'";
+      }
+      return a;
+    };
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->addresses.find(s);
+      if (p != this->addresses.end()) {
+        return check(p->second);
+      }
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    auto* const a =
+        reinterpret_cast<void*>(::GetProcAddress(this->handle, s.c_str()));
+#else
+    auto* const a = ::dlsym(this->handle, s.c_str());
+    if (a == nullptr) {
+      // clear the error state
+      ::dlerror();
+    }
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    return check(this->addresses.insert({s, a}).first->second);
+  }  // end of getSymbol
+
+  bool ExternalLibraryIndex::contains(const std::string& s) const {
+    return this->getSymbol(s) != nullptr;
+  }  // end of contains
+
+  const char* ExternalLibraryIndex::getString(const std::string& s) const {
+    const auto* const p = static_cast<const char* const*>(this->getSymbol(s));
+    return p == nullptr ? nullptr : *p;
+  }  // end of getString
+
+  int ExternalLibraryIndex::getUnsignedShort(const std::string& s) const {
+    const auto* const p =
+        static_cast<const unsigned short*>(this->getSymbol(s));
+    return p == nullptr ? -1 : static_cast<int>(*p);
+  }  // end of getUnsignedShort
+
+  int ExternalLibraryIndex::getBool(const std::string& s) const {
+    return this->getUnsignedShort(s);
+  }  // end of getBool
+
+  int ExternalLibraryIndex::getInteger(const std::string& s) const {
+    const auto* const p = static_cast<const int*>(this->getSymbol(s));
+    return p == nullptr ? 0 : *p;
+  }  // end of getInteger
+
+  double ExternalLibraryIndex::getDouble(const std::string& s) const {
+    const auto* const p = static_cast<const double*>(this->getSymbol(s));
+    return p == nullptr ? 0. : *p;
+  }  // end of getDouble
+
+  long double ExternalLibraryIndex::getLongDouble(const std::string& s) const {
+    const auto* const p = static_cast<const long double*>(this->getSymbol(s));
+    return p == nullptr ? 0. : *p;
+  }  // end of getLongDouble
+
+  const char* const* ExternalLibraryIndex::getArrayOfStrings(
+      const std::string& s) const {
+    return static_cast<const char* const*>(this->getSymbol(s));
+  }  // end of getArrayOfStrings
+
+  const int* ExternalLibraryIndex::getArrayOfInts(const std::string& s) const {
+    return static_cast<const int*>(this->getSymbol(s));
+  }  // end of getArrayOfInts
+
+  const std::vector<std::string>* ExternalLibraryIndex::getStrings(
+      const std::string& n, const std::string& s) const {
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->strings.find(s);
+      if (p != this->strings.end()) {
+        return &(p->second);
+      }
+    }
+    const auto nb = this->getUnsignedShort(n);
+    const auto* const a = this->getArrayOfStrings(s);
+    return getCachedArray(this->mutex, this->strings, s, nb, a);
+  }  // end of getStrings
+
+  const std::vector<int>* ExternalLibraryIndex::getInts(
+      const std::string& n, const std::string& s) const {
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->ints.find(s);
+      if (p != this->ints.end()) {
+        return &(p->second);
+      }
+    }
+    const auto nb = this->getUnsignedShort(n);
+    const auto* const a = this->getArrayOfInts(s);
+    return getCachedArray(this->mutex, this->ints, s, nb, a);
+  }  // end of getInts
+
+  void ExternalLibraryIndex::readSymbolsTable() const {
+    std::call_once(this->symbols_flag, [this] {
+      auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+      const auto path = elm.getLibraryPath(this->name);
+      auto r = LibraryInformation(path).symbols();
+      auto e = std::vector<std::string>{};
+      for (const auto& s : r) {
+        constexpr auto suffix = "_mfront_ept";
+        constexpr auto n = std::string::size_type{11};
+        if ((s.size() >= n) && (s.compare(s.size() - n, n, suffix) == 0)) {
+          e.push_back(s.substr(0, s.size() - n));
+        }
+      }
+      this->symbols = std::move(r);
+      this->entry_points = std::move(e);
+    });
+  }  // end of readSymbolsTable
+
+  const std::vector<std::string>& ExternalLibraryIndex::getSymbols() const {
+    this->readSymbolsTable();
+    return this->symbols;
+  }  // end of getSymbols
+
+  const std::vector<std::string>& ExternalLibraryIndex::getEntryPoints()
+      const {
+    this->readSymbolsTable();
+    return this->entry_points;
+  }  // end of getEntryPoints
+
+  ExternalLibraryIndex::~ExternalLibraryIndex() = default;
+
+}  // end of namespace tfel::system
@@ -27,8 +27,8 @@
 #include <iterator>
 
 #include "TFEL/Raise.hxx"
-#include "TFEL/System/getFunction.h"
 #include "TFEL/System/LibraryInformation.hxx"
+#include "TFEL/System/ExternalLibraryIndex.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 
 namespace tfel::system {
@@ -68,6 +68,16 @@ namespace tfel::system {
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   }    // end of  getErrorMessage
 
+  /*!
+   * \return the description of the last failed lookup of a symbol. This
+   * function must be used rather than `getErrorMessage` after a lookup
+   * through an `ExternalLibraryIndex`, since the system is not called if
+   * the symbol is found in the cache of the index.
+   */
+  static std::string getLookupErrorMessage() {
+    return ExternalLibraryIndex::getLastLookupError();
+  }  // end of getLookupErrorMessage
+
   static void ExternalLibraryManagerCheckModellingHypothesisName(
       const std::string& h) {
     tfel::raise_if(!((h == "AxisymmetricalGeneralisedPlaneStrain") ||
@@ -257,49 +267,55 @@ namespace tfel::system {
   void*
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   ExternalLibraryManager::loadLibrary(const std::string& name, const bool b) {
-    auto p = this->librairies.find(name);
-    if (p == librairies.end()) {
-      // this library has not been
-      auto r = try_open(name);
-      auto lib = r.first;
-      raise_if((lib == nullptr) && (!b),
-               "ExternalLibraryManager::loadLibrary:"
-               " library '" +
-                   name +
-                   "' could not be loaded, "
-                   "(" +
-                   getErrorMessage() + ")");
-      if ((lib == nullptr) && (b)) {
-        return lib;
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->librairies.find(name);
+      if (p != this->librairies.end()) {
+        return p->second->getLibraryHandle();
       }
-      this->librairies.insert({name, lib});
-      return lib;
     }
-    return p->second;
-  }  // end of loadLibrary
-
-  std::vector<std::string> ExternalLibraryManager::getEntryPoints(
-      const std::string& l) {
-    auto ends_with = [](const std::string& s1, const std::string& s2) {
-      return ((s1.size() >= s2.size()) &&
-              (std::equal(s2.rbegin(), s2.rend(), s1.rbegin())));
-    };  // end of ends_with
-    auto r = std::vector<std::string>{};
-    auto lib = try_open(l);
-    raise_if(lib.first == nullptr,
-             "ExternalLibraryManager::getEntryPoints:"
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    // the library may have been loaded by another thread
+    const auto p = this->librairies.find(name);
+    if (p != this->librairies.end()) {
+      return p->second->getLibraryHandle();
+    }
+    auto r = try_open(name);
+    auto lib = r.first;
+    raise_if((lib == nullptr) && (!b),
+             "ExternalLibraryManager::loadLibrary:"
              " library '" +
-                 l +
+                 name +
                  "' could not be loaded, "
                  "(" +
                  getErrorMessage() + ")");
-    auto pl = this->getLibraryPath(lib.second);
-    for (const auto& s : LibraryInformation(pl).symbols()) {
-      if (ends_with(s, "_mfront_ept")) {
-        r.push_back(s.substr(0, s.size() - 11));
+    if ((lib == nullptr) && (b)) {
+      return lib;
+    }
+    this->librairies.insert(
+        {name, std::make_shared<ExternalLibraryIndex>(lib, name)});
+    return lib;
+  }  // end of loadLibrary
+
+  const ExternalLibraryIndex& ExternalLibraryManager::getLibraryIndex(
+      const std::string& l) {
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->librairies.find(l);
+      if (p != this->librairies.end()) {
+        return *(p->second);
       }
     }
-    return r;
+    this->loadLibrary(l);
+    // the entries of the map are never removed, so the returned reference
+    // stays valid
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    return *(this->librairies.at(l));
+  }  // end of getLibraryIndex
+
+  std::vector<std::string> ExternalLibraryManager::getEntryPoints(
+      const std::string& l) {
+    return this->getLibraryIndex(l).getEntryPoints();
   }  // end of getEntryPoints
 
   unsigned short ExternalLibraryManager::getMaterialKnowledgeType(
@@ -307,12 +323,12 @@ namespace tfel::system {
     auto throw_if = [l, f](const bool c, const std::string& m) {
       raise_if(c, "ExternalLibraryManager::getMaterialKnowledgeType: " + m);
     };
-    const auto lib = this->loadLibrary(l);
-    const int nb = ::tfel_getUnsignedShort(lib, (f + "_mfront_mkt").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const int nb = idx.getUnsignedShort(f + "_mfront_mkt");
     throw_if(nb == -1,
              "the material knowledge type could not be read "
              "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     if (nb == 0) {
       return 0u;
     } else if (nb == 1) {
@@ -324,44 +340,29 @@ namespace tfel::system {
 
   bool ExternalLibraryManager::contains(const std::string& l,
                                         const std::string& s) {
-    const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    int (*p)() = (int (*)())::GetProcAddress(lib, s.c_str());
-    return p != static_cast<int (*)()>(nullptr);
-#else
-    void* p = ::dlsym(lib, s.c_str());
-    return p != nullptr;
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of contains
+    return this->getLibraryIndex(l).contains(s);
+  }  // end of contains
 
   std::string ExternalLibraryManager::getString(const std::string& l,
                                                 const std::string& s) {
-    if (!this->contains(l, s)) {
+    const auto* const p = this->getLibraryIndex(l).getString(s);
+    if (p == nullptr) {
       tfel::raise(
           "ExternalLibraryManager::getString: "
           "no symbol named '" +
           s + "' in library '" + l + "'");
     }
-    return this->getStringIfDefined(l, s);
+    return p;
   }  // end of ExternalLibraryManager::getString
 
   std::string ExternalLibraryManager::getStringIfDefined(const std::string& l,
                                                          const std::string& s) {
-    const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    const auto p = (const char* const*)::GetProcAddress(lib, s.c_str());
-#else
-    const auto p = ::dlsym(lib, s.c_str());
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    const auto* const p = this->getLibraryIndex(l).getString(s);
     if (p == nullptr) {
       return "";
     }
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return *p;
-#else
-    return *(static_cast<const char* const*>(p));
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of ExternalLibraryManager::getStringIfDefined
+    return p;
+  }  // end of ExternalLibraryManager::getStringIfDefined
 
   std::string ExternalLibraryManager::getAuthor(const std::string& l,
                                                 const std::string& s) {
@@ -390,13 +391,8 @@ namespace tfel::system {
 
   std::string ExternalLibraryManager::getInterface(const std::string& l,
                                                    const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    const auto p = (const char* const*)::GetProcAddress(
-        lib, (f + "_mfront_interface").c_str());
-#else
-    const auto p = ::dlsym(lib, (f + "_mfront_interface").c_str());
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    const auto* const p =
+        this->getLibraryIndex(l).getString(f + "_mfront_interface");
     raise_if(p == nullptr,
              "ExternalLibraryManager::getInterface: "
              "no interface found for entry point '" +
@@ -404,12 +400,8 @@ namespace tfel::system {
                  "' "
                  "in library '" +
                  l + "'");
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return *p;
-#else
-    return *(static_cast<const char* const*>(p));
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of getInterface
+    return p;
+  }  // end of getInterface
 
   std::string ExternalLibraryManager::getLaw(const std::string& l,
                                              const std::string& f) {
@@ -434,41 +426,31 @@ namespace tfel::system {
   std::vector<std::string>
   ExternalLibraryManager::getSupportedModellingHypotheses(
       const std::string& l, const std::string& f) {
-    std::vector<std::string> h;
-    const auto lib = this->loadLibrary(l);
-    const auto nb =
-        ::tfel_getUnsignedShort(lib, (f + "_nModellingHypotheses").c_str());
-    char** res;
-    raise_if(nb == -1,
-             "ExternalLibraryManager::"
-             "getSupportedModellingHypotheses: "
-             "number of modelling hypotheses could not be read (" +
-                 getErrorMessage() + ")");
-    res = ::tfel_getArrayOfStrings(lib, (f + "_ModellingHypotheses").c_str());
-    raise_if(res == nullptr,
+    const auto& idx = this->getLibraryIndex(l);
+    const auto* const h =
+        idx.getStrings(f + "_nModellingHypotheses", f + "_ModellingHypotheses");
+    raise_if(h == nullptr,
              "ExternalLibraryManager::"
              "getSupportedModellingHypotheses: "
              "modelling hypotheses could not be read (" +
-                 getErrorMessage() + ")");
-    std::copy(res, res + nb, std::back_inserter(h));
-    return h;
+                 getLookupErrorMessage() + ")");
+    return *h;
   }  // end of getSupportedModellingHypotheses
 
   void ExternalLibraryManager::setOutOfBoundsPolicy(
       const std::string& l,
       const std::string& f,
       const tfel::material::OutOfBoundsPolicy p) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(int);
-    fct = ::tfel_getSetOutOfBoundsPolicyFunction(
-        lib, (f + "_setOutOfBoundsPolicy").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_setOutOfBoundsPolicy");
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setOutOfBoundsPolicy: "
              "can't get the '" +
                  f +
                  "_setOutOfBoundsPolicy' function "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     if (p == tfel::material::None) {
       fct(0);
     } else if (p == tfel::material::Warning) {
@@ -482,17 +464,87 @@ namespace tfel::system {
     }
   }  // end of setOutOfBoundsPolicy
 
+  bool ExternalLibraryManager::hasProfilingSupport(const std::string& l,
+                                                   const std::string& f) {
+    return this->contains(l, f + "_mfront_profiling_get_measures");
+  }  // end of hasProfilingSupport
+
+  std::vector<std::string> ExternalLibraryManager::getProfilingCodeBlocks(
+      const std::string& l, const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    unsigned short(TFEL_ADDCALL_PTR nfct)();
+    const char*(TFEL_ADDCALL_PTR fct)(const unsigned short);
+    nfct = idx.getFunction<decltype(nfct)>(
+        f + "_mfront_profiling_get_number_of_code_blocks");
+    fct = idx.getFunction<decltype(fct)>(
+        f + "_mfront_profiling_get_code_block_name");
+    raise_if((nfct == nullptr) || (fct == nullptr),
+             "ExternalLibraryManager::getProfilingCodeBlocks: "
+             "profiling is not supported by behaviour '" +
+                 f + "' (" + getLookupErrorMessage() + ")");
+    auto names = std::vector<std::string>{};
+    const auto n = nfct();
+    for (unsigned short c = 0; c != n; ++c) {
+      const auto* const name = fct(c);
+      raise_if(name == nullptr,
+               "ExternalLibraryManager::getProfilingCodeBlocks: "
+               "invalid code block");
+      names.emplace_back(name);
+    }
+    return names;
+  }  // end of getProfilingCodeBlocks
+
+  void ExternalLibraryManager::getProfilingMeasures(
+      std::vector<intmax_t>& calls,
+      std::vector<intmax_t>& times,
+      const std::string& l,
+      const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    unsigned short(TFEL_ADDCALL_PTR nfct)();
+    int(TFEL_ADDCALL_PTR fct)(intmax_t* const, intmax_t* const);
+    nfct = idx.getFunction<decltype(nfct)>(
+        f + "_mfront_profiling_get_number_of_code_blocks");
+    fct = idx.getFunction<decltype(fct)>(f + "_mfront_profiling_get_measures");
+    raise_if((nfct == nullptr) || (fct == nullptr),
+             "ExternalLibraryManager::getProfilingMeasures: "
+             "profiling is not supported by behaviour '" +
+                 f + "' (" + getLookupErrorMessage() + ")");
+    const auto n = nfct();
+    calls.resize(n);
+    times.resize(n);
+    raise_if(fct(calls.data(), times.data()) != 1,
+             "ExternalLibraryManager::getProfilingMeasures: "
+             "retrieving the measures of behaviour '" +
+                 f + "' failed");
+  }  // end of getProfilingMeasures
+
+  void ExternalLibraryManager::resetProfilingMeasures(const std::string& l,
+                                                      const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    int(TFEL_ADDCALL_PTR fct)();
+    fct = idx.getFunction<decltype(fct)>(f + "_mfront_profiling_reset");
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::resetProfilingMeasures: "
+             "profiling is not supported by behaviour '" +
+                 f + "' (" + getLookupErrorMessage() + ")");
+    raise_if(fct() != 1,
+             "ExternalLibraryManager::resetProfilingMeasures: "
+             "resetting the measures of behaviour '" +
+                 f + "' failed");
+  }  // end of resetProfilingMeasures
+
   void ExternalLibraryManager::setParameter(const std::string& l,
                                             const std::string& f,
                                             const std::string& p,
                                             const double v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const double);
-    fct = ::tfel_getSetParameterFunction(lib, (f + "_setParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_setParameter");
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -503,14 +555,14 @@ namespace tfel::system {
                                             const std::string& f,
                                             const std::string& p,
                                             const int v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const int);
-    fct = ::tfel_getSetIntegerParameterFunction(
-        lib, (f + "_setIntegerParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_setIntegerParameter");
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -521,14 +573,14 @@ namespace tfel::system {
                                             const std::string& f,
                                             const std::string& p,
                                             const unsigned short v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const unsigned short);
-    fct = ::tfel_getSetUnsignedShortParameterFunction(
-        lib, (f + "_setUnsignedShortParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_setUnsignedShortParameter");
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -540,17 +592,17 @@ namespace tfel::system {
                                             const std::string& h,
                                             const std::string& p,
                                             const double v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const double);
-    fct = ::tfel_getSetParameterFunction(
-        lib, (f + "_" + h + "_setParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_" + h + "_setParameter");
     if (fct == nullptr) {
-      fct = ::tfel_getSetParameterFunction(lib, (f + "_setParameter").c_str());
+      fct = idx.getFunction<decltype(fct)>(f + "_setParameter");
     }
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -562,18 +614,17 @@ namespace tfel::system {
                                             const std::string& h,
                                             const std::string& p,
                                             const int v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const int);
-    fct = ::tfel_getSetIntegerParameterFunction(
-        lib, (f + "_" + h + "_setIntegerParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_" + h + "_setIntegerParameter");
     if (fct == nullptr) {
-      fct = ::tfel_getSetIntegerParameterFunction(
-          lib, (f + "_setIntegerParameter").c_str());
+      fct = idx.getFunction<decltype(fct)>(f + "_setIntegerParameter");
     }
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -585,18 +636,18 @@ namespace tfel::system {
                                             const std::string& h,
                                             const std::string& p,
                                             const unsigned short v) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     int(TFEL_ADDCALL_PTR fct)(const char* const, const unsigned short);
-    fct = ::tfel_getSetUnsignedShortParameterFunction(
-        lib, (f + "_" + h + "_setUnsignedShortParameter").c_str());
+    fct = idx.getFunction<decltype(fct)>(f + "_" + h +
+                                         "_setUnsignedShortParameter");
     if (fct == nullptr) {
-      fct = ::tfel_getSetUnsignedShortParameterFunction(
-          lib, (f + "_setUnsignedShortParameter").c_str());
+      fct = idx.getFunction<decltype(fct)>(f + "_setUnsignedShortParameter");
     }
     raise_if(fct == nullptr,
              "ExternalLibraryManager::setParameter: "
              "can't get the '" +
-                 f + "_setParameter' function (" + getErrorMessage() + ")");
+                 f + "_setParameter' function (" + getLookupErrorMessage() +
+                 ")");
     raise_if(!fct(p.c_str(), v),
              "ExternalLibraryManager::setParameter: "
              "call to the '" +
@@ -608,18 +659,18 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
     if (this->contains(l, n1)) {
-      return tfel_getDouble(lib, n1.c_str());
+      return idx.getDouble(n1);
     }
     const auto n2 = f + "_" + pn + "_ParameterDefaultValue";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getRealParameterDefaultValue: "
              "can't get default value for parameter '" +
                  p + "'");
-    return tfel_getDouble(lib, n2.c_str());
+    return idx.getDouble(n2);
   }  // end of getRealParameterDefaultValue
 
   int ExternalLibraryManager::getIntegerParameterDefaultValue(
@@ -627,18 +678,18 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
     if (this->contains(l, n1)) {
-      return tfel_getInteger(lib, n1.c_str());
+      return idx.getInteger(n1);
     }
     const auto n2 = f + "_" + pn + "_ParameterDefaultValue";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getIntegerParameterDefaultValue: "
              "can't get default value for parameter '" +
                  p + "'");
-    return tfel_getInteger(lib, n2.c_str());
+    return idx.getInteger(n2);
   }  // end of getIntegerParameterDefaultValue
 
   unsigned short ExternalLibraryManager::getUnsignedShortParameterDefaultValue(
@@ -646,18 +697,17 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
-    auto res = ::tfel_getUnsignedShort(lib, n1.c_str());
+    auto res = idx.getUnsignedShort(n1);
     if (res < 0) {
-      res = ::tfel_getUnsignedShort(
-          lib, (f + "_" + pn + "_ParameterDefaultValue").c_str());
+      res = idx.getUnsignedShort(f + "_" + pn + "_ParameterDefaultValue");
       raise_if(res < 0,
                "ExternalLibraryManager::"
                "getUnsignedShortParameterDefaultValue: "
                "information could not be read (" +
-                   getErrorMessage() + ")");
+                   getLookupErrorMessage() + ")");
     }
     return static_cast<unsigned short>(res);
   }  // end of getUnsignedShortParameterDefaultValue
@@ -699,36 +749,36 @@ namespace tfel::system {
                                                     const std::string& f,
                                                     const std::string& h,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerBound";
     if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+      return idx.getLongDouble(n1);
     }
     const auto n2 = f + "_" + vn + "_LowerBound";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getLowerBound: "
              "no lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return idx.getLongDouble(n2);
   }  // end of getLowerBound
 
   long double ExternalLibraryManager::getUpperBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& h,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperBound";
     if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+      return idx.getLongDouble(n1);
     }
     const auto n2 = f + "_" + vn + "_UpperBound";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getUpperBound: "
              "no upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return idx.getLongDouble(n2);
   }  // end of getUpperBound
 
   bool ExternalLibraryManager::hasPhysicalBounds(const std::string& l,
@@ -769,18 +819,18 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerPhysicalBound";
     if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+      return idx.getLongDouble(n1);
     }
     const auto n2 = f + "_" + vn + "_LowerPhysicalBound";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getLowerPhysicalBound: "
              "no physical lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return idx.getLongDouble(n2);
   }  // end of getLowerPhysicalBound
 
   long double ExternalLibraryManager::getUpperPhysicalBound(
@@ -788,18 +838,18 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperPhysicalBound";
     if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+      return idx.getLongDouble(n1);
     }
     const auto n2 = f + "_" + vn + "_UpperPhysicalBound";
     raise_if(!this->contains(l, n2),
              "ExternalLibraryManager::getUpperPhysicalBound: "
              "no physical upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return idx.getLongDouble(n2);
   }  // end of getUpperPhysicalBound
 
   bool ExternalLibraryManager::hasBounds(const std::string& l,
@@ -830,27 +880,27 @@ namespace tfel::system {
   long double ExternalLibraryManager::getLowerBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerBound";
     raise_if(!this->contains(l, n1),
              "ExternalLibraryManager::getLowerBound: "
              "no lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return idx.getLongDouble(n1);
   }  // end of getLowerBound
 
   long double ExternalLibraryManager::getUpperBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperBound";
     raise_if(!this->contains(l, n1),
              "ExternalLibraryManager::getUpperBound: "
              "no upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return idx.getLongDouble(n1);
   }  // end of getUpperBound
 
   bool ExternalLibraryManager::hasPhysicalBounds(const std::string& l,
@@ -880,26 +930,26 @@ namespace tfel::system {
 
   long double ExternalLibraryManager::getLowerPhysicalBound(
       const std::string& l, const std::string& f, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerPhysicalBound";
     raise_if(!this->contains(l, n1),
              "ExternalLibraryManager::getLowerPhysicalBound: "
              "no physical lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return idx.getLongDouble(n1);
   }  // end of getLowerPhysicalBound
 
   long double ExternalLibraryManager::getUpperPhysicalBound(
       const std::string& l, const std::string& f, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperPhysicalBound";
     raise_if(!this->contains(l, n1),
              "ExternalLibraryManager::getUpperPhysicalBound: "
              "no physical upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return idx.getLongDouble(n1);
   }  // end of getUpperPhysicalBound
 
   unsigned short ExternalLibraryManager::getCastemFunctionNumberOfVariables(
@@ -911,15 +961,15 @@ namespace tfel::system {
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
     int res;
-    const auto lib = this->loadLibrary(l);
-    res = ::tfel_getUMATRequiresStiffnessTensor(lib, (f + "_" + h).c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    res = idx.getUnsignedShort(f + "_" + h + "_requiresStiffnessTensor");
     if (res < 0) {
-      res = ::tfel_getUMATRequiresStiffnessTensor(lib, f.c_str());
+      res = idx.getUnsignedShort(f + "_requiresStiffnessTensor");
     }
     raise_if(res < 0,
              "ExternalLibraryManager::getUMATRequiresStiffnessTensor: "
              "information could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     if (res == 1) {
       return true;
     }
@@ -932,18 +982,18 @@ namespace tfel::system {
   bool ExternalLibraryManager::getUMATRequiresThermalExpansionCoefficientTensor(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    auto lib = this->loadLibrary(l);
-    auto res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(
-        lib, (f + "_" + h).c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto res = idx.getUnsignedShort(
+        f + "_" + h + "_requiresThermalExpansionCoefficientTensor");
     if (res < 0) {
-      res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(lib,
-                                                                    f.c_str());
+      res = idx.getUnsignedShort(f +
+                                 "_requiresThermalExpansionCoefficientTensor");
     }
     raise_if(res < 0,
              "ExternalLibraryManager::"
              "getUMATRequiresThermalExpansionCoefficientTensor: "
              "information could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     if (res == 1) {
       return true;
     }
@@ -957,14 +1007,13 @@ namespace tfel::system {
 
   bool ExternalLibraryManager::checkIfAsterBehaviourSavesTangentOperator(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto res =
-        ::tfel_checkIfAsterBehaviourSavesTangentOperator(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto res = idx.getUnsignedShort(f + "_savesTangentOperator");
     raise_if(res < 0,
              "ExternalLibraryManager::"
              "checkIfAsterBehaviourSaveTangentOperator: "
              "information could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     if (res == 1) {
       return true;
     }
@@ -978,14 +1027,14 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getAsterFiniteStrainFormulation(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto s = f + "_FiniteStrainFormulation";
-    const auto res = ::tfel_getUnsignedShort(lib, s.c_str());
+    const auto res = idx.getUnsignedShort(s);
     raise_if(res < 0,
              "ExternalLibraryManager::"
              "getAsterFiniteStrainFormulation: "
              "information could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     raise_if((res != 1) && (res != 2),
              "ExternalLibraryManager::"
              "getAsterFiniteStrainFormulation: "
@@ -996,21 +1045,21 @@ namespace tfel::system {
   AsterIntegrationErrorMessageFctPtr
   ExternalLibraryManager::getAsterIntegrationErrorMessageFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto s = f + "_getIntegrationErrorMessage";
-    return ::tfel_getAsterIntegrationErrorMessage(lib, s.c_str());
+    return idx.getFunction<AsterIntegrationErrorMessageFctPtr>(s);
   }  // end of getAsterIntegrationErrorMessage
 
   unsigned short ExternalLibraryManager::getAbaqusOrthotropyManagementPolicy(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto s = f + "_OrthotropyManagementPolicy";
-    const auto res = ::tfel_getUnsignedShort(lib, s.c_str());
+    const auto res = idx.getUnsignedShort(s);
     raise_if(res < 0,
              "ExternalLibraryManager::"
              "getAbaqusOrthotropyManagementPolicy: "
              "information could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     raise_if((res != 0) && (res != 1) && (res != 2),
              "ExternalLibraryManager::"
              "getAbaqusOrthotropyManagementPolicy: "
@@ -1051,26 +1100,67 @@ namespace tfel::system {
 
   GenericMaterialPropertyPtr ExternalLibraryManager::getGenericMaterialProperty(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getGenericMaterialProperty(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<GenericMaterialPropertyPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getGenericMaterialProperty: "
              "could not load generic material property '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }
 
+  GenericArrayMaterialPropertyPtr
+  ExternalLibraryManager::getGenericArrayMaterialProperty(
+      const std::string& l, const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct =
+        idx.getFunction<GenericArrayMaterialPropertyPtr>(f + "_evaluateArray");
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericArrayMaterialProperty: "
+             "could not load the array evaluation function of the generic "
+             "material property '" +
+                 f + "' (" + getLookupErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericArrayMaterialProperty
+
   GenericBehaviourFctPtr ExternalLibraryManager::getGenericBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getGenericBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<GenericBehaviourFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getGenericBehaviourFunction: "
              "could not load generic behaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }
 
+  GenericBehaviourIntegrateArrayFctPtr
+  ExternalLibraryManager::getGenericBehaviourIntegrateArrayFunction(
+      const std::string& l, const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<GenericBehaviourIntegrateArrayFctPtr>(
+        f + "_integrateArray");
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourIntegrateArrayFunction: "
+             "could not load function '" +
+                 f + "_integrateArray' (" + getLookupErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourIntegrateArrayFunction
+
+  std::vector<int>
+  ExternalLibraryManager::getGenericBehaviourIntegrateArraySizes(
+      const std::string& l, const std::string& f) {
+    const auto& idx = this->getLibraryIndex(l);
+    const auto* const sizes = idx.getInts(f + "_integrateArray_nSizes",
+                                          f + "_integrateArray_Sizes");
+    raise_if(sizes == nullptr,
+             "ExternalLibraryManager::getGenericBehaviourIntegrateArraySizes: "
+             "could not read the sizes of the arrays of the function '" +
+                 f + "_integrateArray' (" + getLookupErrorMessage() + ")");
+    return *sizes;
+  }  // end of getGenericBehaviourIntegrateArraySizes
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -1107,21 +1197,21 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& i) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     if (!h.empty()) {
-      const auto fct = ::tfel_getGenericBehaviourInitializeFunction(
-          lib, (f + "_" + h + "_InitializeFunction_" + i).c_str());
+      const auto fct = idx.getFunction<GenericBehaviourInitializeFunctionPtr>(
+          f + "_" + h + "_InitializeFunction_" + i);
       if (fct != nullptr) {
         return fct;
       }
     }
-    const auto fct = ::tfel_getGenericBehaviourInitializeFunction(
-        lib, (f + "_InitializeFunction_" + i).c_str());
+    const auto fct = idx.getFunction<GenericBehaviourInitializeFunctionPtr>(
+        f + "_InitializeFunction_" + i);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getGenericBehaviourInitializeFunction: "
              "could not load post-processing function '" +
                  i + "' for generic behaviour function '" + f + "' (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }  // end of getGenericBehaviourInitializeFunction
 
@@ -1161,36 +1251,36 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& i) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     if (!h.empty()) {
-      const auto fct = ::tfel_getGenericBehaviourPostProcessingFunction(
-          lib, (f + "_" + h + "_PostProcessing_" + i).c_str());
+      const auto fct = idx.getFunction<GenericBehaviourPostProcessingFctPtr>(
+          f + "_" + h + "_PostProcessing_" + i);
       if (fct != nullptr) {
         return fct;
       }
     }
-    const auto fct = ::tfel_getGenericBehaviourPostProcessingFunction(
-        lib, (f + "_PostProcessing_" + i).c_str());
+    const auto fct = idx.getFunction<GenericBehaviourPostProcessingFctPtr>(
+        f + "_PostProcessing_" + i);
     raise_if(
         fct == nullptr,
         "ExternalLibraryManager::getGenericBehaviourPostProcessingFunction: "
         "could not load post-processing function '" +
             i + "' for generic behaviour function '" + f + "' (" +
-            getErrorMessage() + ")");
+            getLookupErrorMessage() + ")");
     return fct;
   }  // end of getGenericBehaviourPostProcessingFunction
 
   GenericBehaviourRotateGradientsFctPtr
   ExternalLibraryManager::getGenericBehaviourRotateGradientsFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto fct =
-        ::tfel_getGenericBehaviourRotateGradientsFunction(lib, f.c_str());
+        idx.getFunction<GenericBehaviourRotateGradientsFctPtr>(f);
     raise_if(
         fct == nullptr,
         "ExternalLibraryManager::getGenericBehaviourRotateGradientsFunction: "
         "could not load generic gehaviour function '" +
-            f + "' (" + getErrorMessage() + ")");
+            f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
      // ExternalLibraryManager::getGenericBehaviourRotateGradientsFunction
@@ -1198,14 +1288,14 @@ namespace tfel::system {
   GenericBehaviourRotateArrayOfGradientsFctPtr
   ExternalLibraryManager::getGenericBehaviourRotateArrayOfGradientsFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getGenericBehaviourRotateArrayOfGradientsFunction(
-        lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct =
+        idx.getFunction<GenericBehaviourRotateArrayOfGradientsFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getGenericBehaviourRotateArrayOfGradientsFunction: "
              "could not load generic gehaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
   // ExternalLibraryManager::getGenericBehaviourRotateArrayOfGradientsFunction
@@ -1213,15 +1303,14 @@ namespace tfel::system {
   GenericBehaviourRotateThermodynamicForcesFctPtr
   ExternalLibraryManager::getGenericBehaviourRotateThermodynamicForcesFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto fct =
-        ::tfel_getGenericBehaviourRotateThermodynamicForcesFunction(lib,
-                                                                    f.c_str());
+        idx.getFunction<GenericBehaviourRotateThermodynamicForcesFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getGenericBehaviourRotateThermodynamicForcesFunction: "
              "could not load generic gehaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
      // ExternalLibraryManager::getGenericBehaviourRotateThermodynamicForcesFunction
@@ -1230,15 +1319,14 @@ namespace tfel::system {
   ExternalLibraryManager::
       getGenericBehaviourRotateArrayOfThermodynamicForcesFunction(
           const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct =
-        ::tfel_getGenericBehaviourRotateArrayOfThermodynamicForcesFunction(
-            lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<
+        GenericBehaviourRotateArrayOfThermodynamicForcesFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getGenericBehaviourRotateArrayOfThermodynamicForcesFunction: "
              "could not load generic gehaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
      // ExternalLibraryManager::getGenericBehaviourRotateArrayOfThermodynamicForcesFunction
@@ -1246,15 +1334,14 @@ namespace tfel::system {
   GenericBehaviourRotateTangentOperatorBlocksFctPtr ExternalLibraryManager::
       getGenericBehaviourRotateTangentOperatorBlocksFunction(
           const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto fct =
-        ::tfel_getGenericBehaviourRotateTangentOperatorBlocksFunction(
-            lib, f.c_str());
+        idx.getFunction<GenericBehaviourRotateTangentOperatorBlocksFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getGenericBehaviourRotateTangentOperatorBlocksFunction: "
              "could not load generic gehaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
      // ExternalLibraryManager::getGenericBehaviourRotateTangentOperatorBlocksFunction
@@ -1263,15 +1350,14 @@ namespace tfel::system {
   ExternalLibraryManager::
       getGenericBehaviourRotateArrayOfTangentOperatorBlocksFunction(
           const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct =
-        ::tfel_getGenericBehaviourRotateArrayOfTangentOperatorBlocksFunction(
-            lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<
+        GenericBehaviourRotateArrayOfTangentOperatorBlocksFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getGenericBehaviourRotateArrayOfTangentOperatorBlocksFunction: "
              "could not load generic gehaviour function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }  // end of
      // ExternalLibraryManager::getGenericBehaviourRotateArrayOfTangentOperatorBlocksFunction
@@ -1279,11 +1365,10 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeInternalEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b =
-        ::tfel_getBool(lib, (f + "_" + h + "_ComputesInternalEnergy").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto b = idx.getBool(f + "_" + h + "_ComputesInternalEnergy");
     if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesInternalEnergy").c_str());
+      b = idx.getBool(f + "_ComputesInternalEnergy");
     }
     if (b == -1) {
       return false;
@@ -1294,11 +1379,10 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeDissipatedEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b = ::tfel_getBool(
-        lib, (f + "_" + h + "_ComputesDissipatedEnergy").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto b = idx.getBool(f + "_" + h + "_ComputesDissipatedEnergy");
     if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesDissipatedEnergy").c_str());
+      b = idx.getBool(f + "_ComputesDissipatedEnergy");
     }
     if (b == -1) {
       return false;
@@ -1308,13 +1392,12 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getMaterialPropertyNumberOfVariables(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto res =
-        ::tfel_getMaterialPropertyNumberOfVariables(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto res = idx.getUnsignedShort(f + "_nargs");
     raise_if(res < 0,
              "ExternalLibraryManager::getMaterialPropertyNumberOfVariables: "
              "number of variables could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return static_cast<unsigned short>(res);
   }
 
@@ -1377,76 +1460,76 @@ namespace tfel::system {
 
   CyranoMaterialPropertyPtr ExternalLibraryManager::getCyranoMaterialProperty(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCyranoMaterialProperty(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CyranoMaterialPropertyPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getCyranoMaterialProperty: "
              "could not load Cyrano function '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }
 
   CyranoBehaviourPtr ExternalLibraryManager::getCyranoFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCyranoFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CyranoBehaviourPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getCyranoFunction: "
              "could not load Cyrano function '" +
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   AbaqusFctPtr ExternalLibraryManager::getAbaqusExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getAbaqusExternalBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<AbaqusFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getAbaqusExternalBehaviourFunction: "
              "could not load Abaqus external behaviour '" +
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   AnsysFctPtr ExternalLibraryManager::getAnsysExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getAnsysExternalBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<AnsysFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getAnsysExternalBehaviourFunction: "
              "could not load Ansys external behaviour '" +
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   AbaqusExplicitFctPtr
   ExternalLibraryManager::getAbaqusExplicitExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto fct =
-        ::tfel_getAbaqusExplicitExternalBehaviourFunction(lib, f.c_str());
+        idx.getFunction<AbaqusExplicitFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getAbaqusExplicitExternalBehaviourFunction: "
              "could not load AbaqusExplicit external "
              "behaviour '" +
-                 f + "' (" + getErrorMessage() + ")");
+                 f + "' (" + getLookupErrorMessage() + ")");
     return fct;
   }
 
   CalculiXFctPtr ExternalLibraryManager::getCalculiXExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    auto fct = ::tfel_getCalculiXExternalBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto fct = idx.getFunction<CalculiXFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getCalculiXExternalBehaviourFunction: "
@@ -1454,14 +1537,14 @@ namespace tfel::system {
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   DianaFEAFctPtr ExternalLibraryManager::getDianaFEAExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    auto fct = ::tfel_getDianaFEAExternalBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto fct = idx.getFunction<DianaFEAFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getDianaFEAExternalBehaviourFunction: "
@@ -1469,14 +1552,14 @@ namespace tfel::system {
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }  // end of getDianaFEAExternalBehaviourFunction
 
   CastemFctPtr ExternalLibraryManager::getCastemExternalBehaviourFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCastemExternalBehaviourFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CastemFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::"
              "getCastemExternalBehaviourFunction: "
@@ -1484,55 +1567,48 @@ namespace tfel::system {
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   AsterFctPtr ExternalLibraryManager::getAsterFunction(const std::string& l,
                                                        const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getAsterFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<AsterFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getAsterFunction: "
              "could not load Aster function '" +
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   EuroplexusFctPtr ExternalLibraryManager::getEuroplexusFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getEuroplexusFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<EuroplexusFctPtr>(f);
     raise_if(fct == nullptr,
              "ExternalLibraryManager::getEuroplexusFunction: "
              " could not load Europlexus function '" +
                  f +
                  "' "
                  "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return fct;
   }
 
   std::vector<std::string> ExternalLibraryManager::getArrayOfStrings(
       const std::string& l, const std::string& e, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    nb = ::tfel_getUnsignedShort(lib, (e + "_n" + n).c_str());
-    raise_if(nb == -1,
-             "ExternalLibraryManager::getArrayOfStrings: "
-             "number of variables names could not be read "
-             "(" +
-                 getErrorMessage() + ")");
-    const auto res = ::tfel_getArrayOfStrings(lib, (e + '_' + n).c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto* const res = idx.getStrings(e + "_n" + n, e + '_' + n);
     raise_if(res == nullptr,
              "ExternalLibraryManager::getArrayOfStrings: "
              "variables names could not be read "
              "(" +
-                 getErrorMessage() + ")");
-    return std::vector<std::string>(res, res + nb);
+                 getLookupErrorMessage() + ")");
+    return *res;
   }  // end of getArrayOfStrings
 
   void ExternalLibraryManager::getUMATNames(std::vector<std::string>& vars,
@@ -1543,32 +1619,20 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
-    }
-    if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
-    }
-    raise_if(nb == -1,
-             "ExternalLibraryManager::getUMATNames: "
-             "number of variables names could not be read "
-             "(" +
-                 getErrorMessage() + ")");
-    char** res = nullptr;
+    const auto& idx = this->getLibraryIndex(l);
+    const std::vector<std::string>* res = nullptr;
     if (!h.empty()) {
-      res = ::tfel_getArrayOfStrings(lib, (f + "_" + h + '_' + n).c_str());
+      res = idx.getStrings(f + "_" + h + "_n" + n, f + "_" + h + '_' + n);
     }
     if (res == nullptr) {
-      res = ::tfel_getArrayOfStrings(lib, (f + '_' + n).c_str());
+      res = idx.getStrings(f + "_n" + n, f + '_' + n);
     }
     raise_if(res == nullptr,
              "ExternalLibraryManager::getUMATNames: "
              "variables names could not be read "
              "(" +
-                 getErrorMessage() + ")");
-    std::copy(res, res + nb, std::back_inserter(vars));
+                 getLookupErrorMessage() + ")");
+    vars.insert(vars.end(), res->begin(), res->end());
   }  // end of getUMATNames
 
   void ExternalLibraryManager::getUMATTypes(std::vector<int>& types,
@@ -1579,44 +1643,30 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
-    }
-    if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
-    }
-    raise_if(nb == -1,
-             "ExternalLibraryManager::getUMATTypes: "
-             "number of variables names could not be read "
-             "(" +
-                 getErrorMessage() + ")");
-    int* res = nullptr;
+    const auto& idx = this->getLibraryIndex(l);
+    const std::vector<int>* res = nullptr;
     if (!h.empty()) {
       res =
-          ::tfel_getArrayOfInts(lib, (f + "_" + h + '_' + n + "Types").c_str());
+          idx.getInts(f + "_" + h + "_n" + n, f + "_" + h + '_' + n + "Types");
     }
     if (res == nullptr) {
-      res = ::tfel_getArrayOfInts(lib, (f + '_' + n + "Types").c_str());
+      res = idx.getInts(f + "_n" + n, f + '_' + n + "Types");
     }
     raise_if(res == nullptr,
              "ExternalLibraryManager::getUMATTypes: "
-             "variables names could not be read "
+             "variables types could not be read "
              "(" +
-                 getErrorMessage() + ")");
-    std::copy(res, res + nb, std::back_inserter(types));
+                 getLookupErrorMessage() + ")");
+    types.insert(types.end(), res->begin(), res->end());
   }  // end of getUMATTypes
 
   bool ExternalLibraryManager::isUMATBehaviourUsableInPurelyImplicitResolution(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    int b = ::tfel_getBool(
-        lib, (f + "_" + h + "_UsableInPurelyImplicitResolution").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    int b = idx.getBool(f + "_" + h + "_UsableInPurelyImplicitResolution");
     if (b == -1) {
-      b = ::tfel_getBool(lib,
-                         (f + "_UsableInPurelyImplicitResolution").c_str());
+      b = idx.getBool(f + "_UsableInPurelyImplicitResolution");
     }
     if (b == -1) {
       return false;
@@ -1628,9 +1678,8 @@ namespace tfel::system {
   bool
   ExternalLibraryManager::checkIfUMATBehaviourUsesGenericPlaneStressAlgorithm(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto b =
-        ::tfel_getBool(lib, (f + "_UsesGenericPlaneStressAlgorithm").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto b = idx.getBool(f + "_UsesGenericPlaneStressAlgorithm");
     if (b == -1) {
       return false;
     }
@@ -1640,48 +1689,46 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATBehaviourType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_BehaviourType").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto u = idx.getUnsignedShort(f + "_BehaviourType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourType: "
              "behaviour type could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return static_cast<unsigned short>(u);
   }  // end of getUMATBehaviourType
 
   unsigned short ExternalLibraryManager::getUMATBehaviourKinematic(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_BehaviourKinematic").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto u = idx.getUnsignedShort(f + "_BehaviourKinematic");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourKinematic: "
              "behaviour type could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return static_cast<unsigned short>(u);
   }  // end of getUMATBehaviourKinematic
 
   unsigned short ExternalLibraryManager::getUMATSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_SymmetryType").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto u = idx.getUnsignedShort(f + "_SymmetryType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATSymmetryType: "
              "symmetry type could not be read (" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return static_cast<unsigned short>(u);
   }  // end of getUMATSymmetryType
 
   unsigned short ExternalLibraryManager::getUMATElasticSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_ElasticSymmetryType").c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto u = idx.getUnsignedShort(f + "_ElasticSymmetryType");
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATElasticSymmetryType: "
              "elastic symmetry type could not be read "
              "(" +
-                 getErrorMessage() + ")");
+                 getLookupErrorMessage() + ")");
     return static_cast<unsigned short>(u);
   }  // end of getUMATElasticSymmetryType
 
@@ -1792,9 +1839,9 @@ namespace tfel::system {
   bool
   ExternalLibraryManager::hasTemperatureBeenRemovedFromExternalStateVariables(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
+    const auto& idx = this->getLibraryIndex(l);
     const auto s = f + "_TemperatureRemovedFromExternalStateVariables";
-    const auto u = ::tfel_getUnsignedShort(lib, s.c_str());
+    const auto u = idx.getUnsignedShort(s);
     if (u == -1) {
       tfel::raise(
           "ExternalLibraryManager::"
@@ -1836,463 +1883,463 @@ namespace tfel::system {
 
   CastemFunctionPtr ExternalLibraryManager::getCastemFunction(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    auto fct = ::tfel_getCastemFunction(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    auto fct = idx.getFunction<CastemFunctionPtr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCastemFunction: "
                    "could not load castem function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction0Ptr ExternalLibraryManager::getCFunction0(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction0(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction0Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction0: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction1Ptr ExternalLibraryManager::getCFunction1(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction1(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction1Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction1: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction2Ptr ExternalLibraryManager::getCFunction2(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction2(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction2Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction2: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction3Ptr ExternalLibraryManager::getCFunction3(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction3(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction3Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction3: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction4Ptr ExternalLibraryManager::getCFunction4(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction4(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction4Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction4: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction5Ptr ExternalLibraryManager::getCFunction5(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction5(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction5Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction5: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction6Ptr ExternalLibraryManager::getCFunction6(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction6(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction6Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction6: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction7Ptr ExternalLibraryManager::getCFunction7(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction7(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction7Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction7: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction8Ptr ExternalLibraryManager::getCFunction8(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction8(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction8Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction8: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction9Ptr ExternalLibraryManager::getCFunction9(const std::string& l,
                                                       const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction9(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction9Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction9: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction10Ptr ExternalLibraryManager::getCFunction10(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction10(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction10Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction10: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction11Ptr ExternalLibraryManager::getCFunction11(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction11(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction11Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction11: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction12Ptr ExternalLibraryManager::getCFunction12(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction12(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction12Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction12: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction13Ptr ExternalLibraryManager::getCFunction13(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction13(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction13Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction13: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction14Ptr ExternalLibraryManager::getCFunction14(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction14(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction14Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction14: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   CFunction15Ptr ExternalLibraryManager::getCFunction15(const std::string& l,
                                                         const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getCFunction15(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<CFunction15Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getCFunction15: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction0Ptr ExternalLibraryManager::getFortranFunction0(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction0(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction0Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction0: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction1Ptr ExternalLibraryManager::getFortranFunction1(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction1(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction1Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction1: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction2Ptr ExternalLibraryManager::getFortranFunction2(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction2(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction2Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction2: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction3Ptr ExternalLibraryManager::getFortranFunction3(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction3(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction3Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction3: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction4Ptr ExternalLibraryManager::getFortranFunction4(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction4(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction4Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction4: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction5Ptr ExternalLibraryManager::getFortranFunction5(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction5(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction5Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction5: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction6Ptr ExternalLibraryManager::getFortranFunction6(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction6(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction6Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction6: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction7Ptr ExternalLibraryManager::getFortranFunction7(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction7(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction7Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction7: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction8Ptr ExternalLibraryManager::getFortranFunction8(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction8(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction8Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction8: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction9Ptr ExternalLibraryManager::getFortranFunction9(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction9(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction9Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction9: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction10Ptr ExternalLibraryManager::getFortranFunction10(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction10(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction10Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction10: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction11Ptr ExternalLibraryManager::getFortranFunction11(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction11(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction11Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction11: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction12Ptr ExternalLibraryManager::getFortranFunction12(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction12(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction12Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction12: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction13Ptr ExternalLibraryManager::getFortranFunction13(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction13(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction13Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction13: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction14Ptr ExternalLibraryManager::getFortranFunction14(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction14(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction14Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction14: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
   FortranFunction15Ptr ExternalLibraryManager::getFortranFunction15(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto fct = ::tfel_getFortranFunction15(lib, f.c_str());
+    const auto& idx = this->getLibraryIndex(l);
+    const auto fct = idx.getFunction<FortranFunction15Ptr>(f);
     tfel::raise_if(fct == nullptr,
                    "ExternalLibraryManager::getFortranFunction15: "
                    "could not load function '" +
                        f +
                        "' "
                        "(" +
-                       getErrorMessage() + ")");
+                       getLookupErrorMessage() + ")");
     return fct;
   }
 
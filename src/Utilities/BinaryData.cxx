@@ -0,0 +1,213 @@
+/*!
+ * \file   src/Utilities/BinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <algorithm>
+
+#if !(defined _WIN32 || defined _WIN64)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+
+namespace tfel::utilities {
+
+  //! \brief identifier written at the beginning of binary data files
+  static constexpr char binaryDataIdentifier[8] = {'T', 'F', 'E', 'L',
+                                                   'B', 'I', 'N', '\n'};
+  //! \brief version of the format
+  static constexpr std::uint32_t binaryDataVersion = 1;
+  //! \brief marker used to detect files written with another endianness
+  static constexpr std::uint32_t binaryDataEndiannessMarker = 0x01020304;
+
+  /*!
+   * \brief read a value in the header
+   * \param[out] v: value
+   * \param[in,out] p: current position
+   * \param[in] b: beginning of the file
+   * \param[in] s: size of the file
+   */
+  template <typename T>
+  static void readBinaryDataHeaderValue(T& v,
+                                        BinaryData::size_type& p,
+                                        const char* const b,
+                                        const BinaryData::size_type s) {
+    raise_if(s - p < sizeof(T), "BinaryData::BinaryData: truncated header");
+    std::memcpy(&v, b + p, sizeof(T));
+    p += sizeof(T);
+  }  // end of readBinaryDataHeaderValue
+
+  void BinaryData::writeHeader(std::ostream& os,
+                               const std::vector<std::string>& c) {
+    auto write = [&os](const auto& v) {
+      os.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    };
+    auto s = sizeof(binaryDataIdentifier);
+    os.write(binaryDataIdentifier, sizeof(binaryDataIdentifier));
+    write(binaryDataVersion);
+    write(binaryDataEndiannessMarker);
+    write(static_cast<std::uint64_t>(c.size()));
+    s += 2 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+    for (const auto& l : c) {
+      write(static_cast<std::uint64_t>(l.size()));
+      os.write(l.data(), static_cast<std::streamsize>(l.size()));
+      s += sizeof(std::uint64_t) + l.size();
+    }
+    // padding, so that the values are aligned
+    for (; s % sizeof(double) != 0; ++s) {
+      os.put('\0');
+    }
+  }  // end of writeHeader
+
+  bool BinaryData::isBinaryDataFile(const std::string& f) {
+    char id[sizeof(binaryDataIdentifier)];
+    std::ifstream file{f, std::ios::in | std::ios::binary};
+    if (!file.read(id, sizeof(id))) {
+      return false;
+    }
+    return std::equal(id, id + sizeof(id), binaryDataIdentifier);
+  }  // end of isBinaryDataFile
+
+  BinaryData::BinaryData(const std::string& f) {
+    const char* b = nullptr;
+    auto s = size_type{};
+#if !(defined _WIN32 || defined _WIN64)
+    const auto fd = ::open(f.c_str(), O_RDONLY);
+    raise_if(fd == -1, "BinaryData::BinaryData: can't open '" + f + "'");
+    struct stat st;
+    if ((::fstat(fd, &st) == -1) || (st.st_size <= 0)) {
+      ::close(fd);
+      raise("BinaryData::BinaryData: can't read '" + f + "'");
+    }
+    s = static_cast<size_type>(st.st_size);
+    auto* const m = ::mmap(nullptr, s, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    raise_if(m == MAP_FAILED, "BinaryData::BinaryData: can't map '" + f + "'");
+    this->mapping = m;
+    this->mapping_size = s;
+    b = static_cast<const char*>(m);
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    // reading the file in one block. The buffer is made of doubles so
+    // that the values are correctly aligned.
+    std::ifstream file{f, std::ios::in | std::ios::binary};
+    raise_if(!file, "BinaryData::BinaryData: can't open '" + f + "'");
+    file.seekg(0, std::ios::end);
+    const auto fsize = file.tellg();
+    raise_if(fsize <= 0, "BinaryData::BinaryData: can't read '" + f + "'");
+    file.seekg(0, std::ios::beg);
+    s = static_cast<size_type>(fsize);
+    this->buffer.resize((s + sizeof(double) - 1) / sizeof(double));
+    file.read(reinterpret_cast<char*>(this->buffer.data()), fsize);
+    raise_if(!file, "BinaryData::BinaryData: can't read '" + f + "'");
+    b = reinterpret_cast<const char*>(this->buffer.data());
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    try {
+      auto p = size_type{};
+      raise_if((s < sizeof(binaryDataIdentifier)) ||
+                   (!std::equal(b, b + sizeof(binaryDataIdentifier),
+                                binaryDataIdentifier)),
+               "BinaryData::BinaryData: '" + f +
+                   "' is not a binary data file");
+      p += sizeof(binaryDataIdentifier);
+      auto version = std::uint32_t{};
+      auto marker = std::uint32_t{};
+      auto nc = std::uint64_t{};
+      readBinaryDataHeaderValue(version, p, b, s);
+      readBinaryDataHeaderValue(marker, p, b, s);
+      raise_if(version != binaryDataVersion,
+               "BinaryData::BinaryData: unsupported version of the format");
+      raise_if(marker != binaryDataEndiannessMarker,
+               "BinaryData::BinaryData: the file '" + f +
+                   "' has been written on a system with a different "
+                   "endianness");
+      readBinaryDataHeaderValue(nc, p, b, s);
+      raise_if(nc > s, "BinaryData::BinaryData: invalid number of columns");
+      this->legends.reserve(static_cast<size_type>(nc));
+      for (std::uint64_t i = 0; i != nc; ++i) {
+        auto l = std::uint64_t{};
+        readBinaryDataHeaderValue(l, p, b, s);
+        raise_if(l > s - p, "BinaryData::BinaryData: truncated header");
+        this->legends.emplace_back(b + p, static_cast<size_type>(l));
+        p += static_cast<size_type>(l);
+      }
+      p += (sizeof(double) - p % sizeof(double)) % sizeof(double);
+      raise_if(p > s, "BinaryData::BinaryData: truncated header");
+      this->values = reinterpret_cast<const double*>(b + p);
+      if (nc != 0) {
+        this->nrows = (s - p) / (sizeof(double) * this->legends.size());
+      }
+    } catch (...) {
+#if !(defined _WIN32 || defined _WIN64)
+      ::munmap(this->mapping, this->mapping_size);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+      throw;
+    }
+  }  // end of BinaryData
+
+  BinaryData::size_type BinaryData::getNumberOfColumns() const noexcept {
+    return this->legends.size();
+  }  // end of getNumberOfColumns
+
+  BinaryData::size_type BinaryData::getNumberOfRows() const noexcept {
+    return this->nrows;
+  }  // end of getNumberOfRows
+
+  const std::vector<std::string>& BinaryData::getLegends() const noexcept {
+    return this->legends;
+  }  // end of getLegends
+
+  const std::string& BinaryData::getLegend(const size_type c) const {
+    raise_if((c == 0) || (c > this->legends.size()),
+             "BinaryData::getLegend: invalid column number");
+    return this->legends[c - 1];
+  }  // end of getLegend
+
+  BinaryData::size_type BinaryData::findColumn(const std::string& n) const {
+    const auto p = std::find(this->legends.begin(), this->legends.end(), n);
+    raise_if(p == this->legends.end(),
+             "BinaryData::findColumn: no column named '" + n + "'");
+    return static_cast<size_type>(p - this->legends.begin()) + 1;
+  }  // end of findColumn
+
+  BinaryData::ColumnView BinaryData::getColumnView(const size_type c) const {
+    raise_if((c == 0) || (c > this->legends.size()),
+             "BinaryData::getColumnView: invalid column number");
+    return {this->values + (c - 1), this->nrows, this->legends.size()};
+  }  // end of getColumnView
+
+  std::vector<double> BinaryData::getColumn(const size_type c) const {
+    const auto v = this->getColumnView(c);
+    auto r = std::vector<double>(v.size());
+    for (size_type i = 0; i != v.size(); ++i) {
+      r[i] = v[i];
+    }
+    return r;
+  }  // end of getColumn
+
+  const double* BinaryData::data() const noexcept {
+    return this->values;
+  }  // end of data
+
+  BinaryData::~BinaryData() {
+#if !(defined _WIN32 || defined _WIN64)
+    ::munmap(this->mapping, this->mapping_size);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  }  // end of ~BinaryData
+
+}  // end of namespace tfel::utilities
@@ -0,0 +1,114 @@
+/*!
+ * \file   src/Utilities/BinaryDataWriter.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+namespace tfel::utilities {
+
+  BinaryDataWriter::BinaryDataWriter(const std::string& f,
+                                     const std::vector<std::string>& c,
+                                     const size_type n)
+      : file(f, std::ios::out | std::ios::binary),
+        ncolumns(c.size()),
+        capacity(std::max(c.size(), size_type(1)) *
+                 std::max(n, size_type(1))) {
+    raise_if(!this->file,
+             "BinaryDataWriter::BinaryDataWriter: "
+             "can't open file '" +
+                 f + "'");
+    this->file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    BinaryData::writeHeader(this->file, c);
+    this->current.reserve(this->capacity);
+    this->pending.reserve(this->capacity);
+    this->writer = std::thread([this] { this->writeBuffers(); });
+  }  // end of BinaryDataWriter
+
+  BinaryDataWriter::size_type BinaryDataWriter::getNumberOfColumns()
+      const noexcept {
+    return this->ncolumns;
+  }  // end of getNumberOfColumns
+
+  void BinaryDataWriter::checkError() const {
+    if (this->error) {
+      std::rethrow_exception(this->error);
+    }
+  }  // end of checkError
+
+  void BinaryDataWriter::exchangeBuffers() {
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    this->cv.wait(lock, [this] { return !this->has_pending; });
+    this->checkError();
+    std::swap(this->current, this->pending);
+    this->current.clear();
+    this->has_pending = true;
+    lock.unlock();
+    this->cv.notify_all();
+  }  // end of exchangeBuffers
+
+  void BinaryDataWriter::writeBuffers() {
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    while (true) {
+      this->cv.wait(lock, [this] { return this->has_pending || this->stop; });
+      if (this->has_pending) {
+        // the pending buffer is only accessed by this thread until the
+        // `has_pending` flag is reset
+        lock.unlock();
+        auto e = std::exception_ptr{};
+        try {
+          this->file.write(
+              reinterpret_cast<const char*>(this->pending.data()),
+              static_cast<std::streamsize>(this->pending.size() *
+                                           sizeof(double)));
+        } catch (...) {
+          e = std::current_exception();
+        }
+        lock.lock();
+        if ((e) && (!this->error)) {
+          this->error = e;
+        }
+        this->pending.clear();
+        this->has_pending = false;
+        this->cv.notify_all();
+      } else {
+        return;
+      }
+    }
+  }  // end of writeBuffers
+
+  void BinaryDataWriter::flush() {
+    if (!this->current.empty()) {
+      this->exchangeBuffers();
+    }
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    this->cv.wait(lock, [this] { return !this->has_pending; });
+    this->checkError();
+    // the background thread does not access the file at this stage
+    this->file.flush();
+  }  // end of flush
+
+  BinaryDataWriter::~BinaryDataWriter() {
+    try {
+      this->flush();
+    } catch (...) {
+    }
+    {
+      auto lock = std::lock_guard<std::mutex>(this->m);
+      this->stop = true;
+    }
+    this->cv.notify_all();
+    this->writer.join();
+  }  // end of ~BinaryDataWriter
+
+}  // end of namespace tfel::utilities
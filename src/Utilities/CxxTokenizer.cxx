@@ -41,15 +41,32 @@ namespace std {
 
 namespace tfel::utilities {
 
-  static std::pair<std::string::const_iterator, std::string> findSeparator(
-      const std::string::const_iterator p,
-      const std::string::const_iterator pe,
-      const std::vector<std::string> &separators) {
-    const auto w = std::string{p, pe};
-    std::pair<std::string::const_iterator, std::string> r = {pe, ""};
+  /*!
+   * \return a view of the given range
+   * \param[in] b: beginning of the range
+   * \param[in] e: end of the range
+   */
+  static std::string_view makeView(const std::string_view::const_iterator b,
+                                   const std::string_view::const_iterator e) {
+    if (b == e) {
+      return {};
+    }
+    return {&*b, static_cast<std::string_view::size_type>(e - b)};
+  }  // end of makeView
+
+  static std::pair<std::string_view::const_iterator, std::string_view>
+  findSeparator(const std::string_view::const_iterator p,
+                const std::string_view::const_iterator pe,
+                const std::vector<std::string> &separators) {
+    std::pair<std::string_view::const_iterator, std::string_view> r = {pe,
+                                                                       ""};
+    if (separators.empty()) {
+      return r;
+    }
+    const auto w = makeView(p, pe);
     for (const auto &s : separators) {
       const auto pos = w.find(s);
-      if (pos != std::string::npos) {
+      if (pos != std::string_view::npos) {
         if (p + pos < r.first) {
           r = {p + pos, s};
         }
@@ -102,8 +119,31 @@ namespace tfel::utilities {
              "CxxTokenizer::openFile: "
              "unable to open file '" +
                  f + "'");
+    // reading the file in one block
+    file.seekg(0, std::ios::end);
+    const auto fsize = file.tellg();
+    raise_if(fsize < 0,
+             "CxxTokenizer::openFile: "
+             "unable to read file '" +
+                 f + "'");
+    file.seekg(0, std::ios::beg);
+    auto b = std::string(static_cast<std::string::size_type>(fsize), '\0');
+    file.read(b.data(), fsize);
+    raise_if(file.bad(),
+             "CxxTokenizer::openFile: "
+             "unable to read file '" +
+                 f + "'");
+    // in text mode, the number of characters read may be lower than the
+    // size of the file
+    b.resize(static_cast<std::string::size_type>(file.gcount()));
     auto n = Token::size_type{};
-    this->parseStream(file, n, " of file '" + f + "'");
+    if (this->tokenViews) {
+      this->buffers.push_back(
+          std::make_shared<const std::string>(std::move(b)));
+      this->parseBuffer(*(this->buffers.back()), n, "file", f);
+    } else {
+      this->parseBuffer(b, n, "file", f);
+    }
   }
 
   void CxxTokenizer::addSeparator(const std::string &s) {
@@ -115,45 +155,75 @@ namespace tfel::utilities {
   }  // end of CxxTokenizer::addSeparator
 
   void CxxTokenizer::parseString(const std::string &s) {
-    std::istringstream iss(s);
     auto n = Token::size_type{};
-    this->parseStream(iss, n, " of string '" + s + "'");
+    if (this->tokenViews) {
+      this->buffers.push_back(std::make_shared<const std::string>(s));
+      this->parseBuffer(*(this->buffers.back()), n, "string", s);
+    } else {
+      this->parseBuffer(s, n, "string", s);
+    }
+  }  // end of CxxTokenizer::parseOneString
+
+  void CxxTokenizer::parseString(std::string &&s) {
+    if (!this->tokenViews) {
+      this->parseString(s);
+      return;
+    }
+    auto n = Token::size_type{};
+    this->buffers.push_back(std::make_shared<const std::string>(std::move(s)));
+    const auto &b = *(this->buffers.back());
+    this->parseBuffer(b, n, "string", b);
   }  // end of CxxTokenizer::parseOneString
 
-  void CxxTokenizer::parseStream(std::istream &in,
+  void CxxTokenizer::parseStringView(std::string_view s) {
+    auto n = Token::size_type{};
+    this->parseBuffer(s, n, "string", s);
+  }  // end of CxxTokenizer::parseStringView
+
+  template <typename TokenType>
+  static void insertCurlyBraces(std::vector<TokenType> &tokens) {
+    tokens.insert(tokens.begin(), TokenType("{", 0, 0));
+    const auto l = tokens.back().line + 1u;
+    tokens.insert(tokens.end(), TokenType("}", l, 0u));
+  }  // end of insertCurlyBraces
+
+  void CxxTokenizer::parseBuffer(std::string_view b,
                                  Token::size_type &n,
-                                 const std::string &from) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseStream: " + m);
-    };
+                                 const char *const k,
+                                 std::string_view from) {
     try {
-      while (!in.eof()) {
-        throw_if(!in.good(), "error while parsing stream");
-        throw_if(!in.good(), "error while parsing stream");
-        auto line = std::string{};
-        std::getline(in, line);
+      // as with `std::getline`, the end of the buffer terminates the last
+      // line, even if this line is empty
+      auto pos = std::string_view::size_type{};
+      auto last = false;
+      while (!last) {
+        auto pe = b.find('\n', pos);
+        last = pe == std::string_view::npos;
+        if (last) {
+          pe = b.size();
+        }
         ++n;
         try {
-          this->splitLine(line, n);
+          this->splitLine(b.substr(pos, pe - pos), n);
         } catch (std::runtime_error &e) {
           raise(std::string(e.what()) + ".\n" +
-                "Error at line: " + std::to_string(n) + from);
+                "Error at line: " + std::to_string(n) + " of " + k + " '" +
+                std::string{from} + "'");
         }
+        pos = pe + 1;
       }
     } catch (...) {
       this->clear();
       throw;
     }
     if (this->addCurlyBraces) {
-      this->tokens.insert(this->tokens.begin(), Token("{", 0, 0));
-      if (!this->tokens.empty()) {
-        const auto &b = this->tokens.back();
-        this->tokens.insert(this->tokens.end(), Token("}", b.line + 1u, 0u));
+      if (this->tokenViews) {
+        insertCurlyBraces(this->views);
       } else {
-        this->tokens.insert(this->tokens.end(), Token("}", 0u, 0u));
+        insertCurlyBraces(this->tokens);
       }
     }
-  }  // end of parseString
+  }  // end of parseBuffer
 
   struct is_separator {
     //! constructor
@@ -193,33 +263,35 @@ namespace tfel::utilities {
   };  // end of struct is_separator_or_space
 
   static void advance(Token::size_type &o,
-                      std::string::const_iterator &p,
+                      std::string_view::const_iterator &p,
                       Token::size_type n) {
     o += n;
     std::advance(p, n);
   }
 
   static void advance(Token::size_type &o,
-                      std::string::const_iterator &p,
-                      const std::string::const_iterator np) {
+                      std::string_view::const_iterator &p,
+                      const std::string_view::const_iterator np) {
     o += Token::size_type(np - p);
     p = np;
   }
 
   static void ignore_space(Token::size_type &o,
-                           std::string::const_iterator &p,
-                           const std::string::const_iterator pe) {
+                           std::string_view::const_iterator &p,
+                           const std::string_view::const_iterator pe) {
     auto np = std::find_if_not(
         p, pe, [](const std::string::value_type c) { return std::isspace(c); });
     advance(o, p, np);
   }
 
   void CxxTokenizer::parseChar(Token::size_type &o,
-                               std::string::const_iterator &p,
-                               const std::string::const_iterator pe,
+                               std::string_view::const_iterator &p,
+                               const std::string_view::const_iterator pe,
                                const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCChar: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::parseCChar: " + std::string{m});
+      }
     };
     if (this->charAsString) {
       this->parseString(o, p, pe, n, '\'');
@@ -231,33 +303,37 @@ namespace tfel::utilities {
       if (*pn == '\\') {
         const auto pn4 = std::next(p, 4);
         throw_if((pn2 == pe) || (pn3 == pe), "unterminated char");
-        throw_if(*pn3 != '\'',
-                 "unexpected token '" + std::string(1u, *pn3) + "'");
-        this->tokens.emplace_back(std::string(p, pn4), n, o, Token::Char);
+        if (*pn3 != '\'') {
+          throw_if(true, "unexpected token '" + std::string(1u, *pn3) + "'");
+        }
+        this->addToken(makeView(p, pn4), n, o, Token::Char);
         advance(o, p, pn4);
       } else {
-        throw_if(*pn2 != '\'',
-                 "unexpected token '" + std::string(1u, *pn2) + "'");
-        this->tokens.emplace_back(std::string(p, pn3), n, o, Token::Char);
+        if (*pn2 != '\'') {
+          throw_if(true, "unexpected token '" + std::string(1u, *pn2) + "'");
+        }
+        this->addToken(makeView(p, pn3), n, o, Token::Char);
         advance(o, p, pn3);
       }
     }
   }
 
   void CxxTokenizer::parseString(Token::size_type &o,
-                                 std::string::const_iterator &p,
-                                 const std::string::const_iterator pe,
+                                 std::string_view::const_iterator &p,
+                                 const std::string_view::const_iterator pe,
                                  const Token::size_type n,
                                  const char e) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseString: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::parseString: " + std::string{m});
+      }
     };
     auto ps = std::next(p, 1);
     auto found = false;
     for (; (ps != pe) && (!found); ++ps) {
       if (*ps == e) {
-        std::string::const_reverse_iterator ps2(ps);
-        const std::string::const_reverse_iterator pse(p);
+        std::string_view::const_reverse_iterator ps2(ps);
+        const std::string_view::const_reverse_iterator pse(p);
         found = true;
         while ((ps2 != pse) && (*ps2 == '\\')) {
           found = !found;
@@ -265,67 +341,76 @@ namespace tfel::utilities {
         }
       }
     }
-    throw_if(!found, "found no matching '" + std::string(1u, e) +
+    if (!found) {
+      throw_if(true, "found no matching '" + std::string(1u, e) +
                          "' to close string\n");
-    if (((!this->tokens.empty()) &&
-         (this->tokens.back().flag == Token::String)) &&
+    }
+    if (((this->hasTokens()) && (this->getLastTokenFlag() == Token::String)) &&
         (*p == '\"') && (this->shallMergeStrings)) {
-      auto &value = this->tokens.back().value;
-      this->tokens.back().value =
-          value.substr(0, value.size() - 1) + std::string(p + 1, ps);
+      const auto value = this->getLastTokenValue();
+      auto v = std::string{value.substr(0, value.size() - 1)};
+      v.append(makeView(std::next(p), ps));
+      this->setLastTokenValue(std::move(v));
     } else {
-      this->tokens.emplace_back(std::string(p, ps), n, o, Token::String);
+      this->addToken(makeView(p, ps), n, o, Token::String);
     }
     advance(o, p, ps);
   }
 
   void CxxTokenizer::try_join(Token::size_type &o,
-                              std::string::const_iterator &p,
-                              const std::string::const_iterator pe,
+                              std::string_view::const_iterator &p,
+                              const std::string_view::const_iterator pe,
                               const Token::size_type n,
                               const char c) {
     if (this->joinCxxTwoCharactersSeparators) {
       const auto pn = std::next(p, 1);
       if ((pn != pe) && (*pn == c)) {
-        this->tokens.emplace_back(std::string{*p, *pn}, n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
         advance(o, p, 2u);
       } else {
-        this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
         advance(o, p, 1u);
       }
     } else {
-      this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+      this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
       advance(o, p, 1u);
     }
   }  // end of CxxTokenizer::try_join
 
   void CxxTokenizer::try_join(Token::size_type &o,
-                              std::string::const_iterator &p,
-                              const std::string::const_iterator pe,
+                              std::string_view::const_iterator &p,
+                              const std::string_view::const_iterator pe,
                               const Token::size_type n,
                               const char c1,
                               const char c2) {
     if (this->joinCxxTwoCharactersSeparators) {
       const auto pn = std::next(p, 1);
       if ((pn != pe) && ((*pn == c1) || (*pn == c2))) {
-        this->tokens.emplace_back(std::string{*p, *pn}, n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
         advance(o, p, 2u);
       } else {
-        this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+        this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
         advance(o, p, 1u);
       }
     } else {
-      this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+      this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
       advance(o, p, 1u);
     }
   }  // end of CxxTokenizer::try_join
 
   void CxxTokenizer::parseNumber(Token::size_type &o,
-                                 std::string::const_iterator &p,
-                                 const std::string::const_iterator pe,
+                                 std::string_view::const_iterator &p,
+                                 const std::string_view::const_iterator pe,
                                  const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseNumber: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::parseNumber: " + std::string{m});
+      }
+    };
+    auto check_digit = [&throw_if](const char c) {
+      if (!std::isdigit(c)) {
+        throw_if(true, std::string("expected digit, read '") + c + '\'');
+      }
     };
     auto is_binary = [](const char c) { return (c == '0') || (c == '1'); };
     auto is_hex = [](const char c) {
@@ -349,13 +434,13 @@ namespace tfel::utilities {
       // reading decimal part
       throw_if(++p == pe, "invalid number");
     }
-    throw_if((!(std::isdigit(*p))) && (*p != '.'),
-             std::string("expected digit, read '") + *p + '\'');
+    if (*p != '.') {
+      check_digit(*p);
+    }
     if (*p == '.') {
       is_float = true;
       throw_if(++p == pe, "invalid number");
-      throw_if(!std::isdigit(*p),
-               std::string("expected digit, read '") + *p + '\'');
+      check_digit(*p);
     } else if (*p == '0') {
       starts_with_zero = true;
       if (++p != pe) {
@@ -385,8 +470,7 @@ namespace tfel::utilities {
     while ((p != pe) && ((std::isdigit(*p)) || (*p == '\''))) {
       if (*p == '\'') {
         throw_if(++p == pe, "invalid number");
-        throw_if(!std::isdigit(*p),
-                 std::string("expected digit, read '") + *p + '\'');
+        check_digit(*p);
       }
       ++p;
     }
@@ -401,8 +485,7 @@ namespace tfel::utilities {
         if (*p == '\'') {
           // C++14 digit separator
           throw_if(++p == pe, "invalid number");
-          throw_if(!std::isdigit(*p),
-                   std::string("expected digit, read '") + *p + '\'');
+          check_digit(*p);
         }
         ++p;
       }
@@ -425,8 +508,7 @@ namespace tfel::utilities {
         while ((p != pe) && ((std::isdigit(*p)) || (*p == '\''))) {
           if (*p == '\'') {
             throw_if(++p == pe, "invalid number");
-            throw_if(!std::isdigit(*p),
-                     std::string("expected digit, read '") + *p + '\'');
+            check_digit(*p);
           }
           ++p;
         }
@@ -506,21 +588,23 @@ namespace tfel::utilities {
       }
     }
     throw_if((p != pe) && (*p == '.'), "invalid number");
-    this->tokens.emplace_back(std::string{b, p}, n, o, Token::Number);
+    this->addToken(makeView(b, p), n, o, Token::Number);
     const auto d = p - b;
     p = b;
     advance(o, p, d);
   }  // end of CxxTokenizer::parseNumber
 
   void CxxTokenizer::parseCComment(Token::size_type &o,
-                                   std::string::const_iterator &p,
-                                   const std::string::const_iterator pe,
+                                   std::string_view::const_iterator &p,
+                                   const std::string_view::const_iterator pe,
                                    const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCComment: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::parseCComment: " + std::string{m});
+      }
     };
-    auto get_end = [&pe](const std::string::const_iterator cp)
-        -> std::string::const_iterator {
+    auto get_end = [&pe](const std::string_view::const_iterator cp)
+        -> std::string_view::const_iterator {
       auto c = cp;
       while (c != pe) {
         if (*c == '*') {
@@ -551,11 +635,11 @@ namespace tfel::utilities {
     if ((p != pe) && (*p == '!')) {
       next_token();
       if ((p != pe) && (*p == '<')) {
-        flag = this->tokens.empty() ? Token::Comment
+        flag = !this->hasTokens() ? Token::Comment
                                     : Token::DoxygenBackwardComment;
         next_token();
       } else {
-        flag = this->tokens.empty() ? Token::Comment : Token::DoxygenComment;
+        flag = !this->hasTokens() ? Token::Comment : Token::DoxygenComment;
       }
     }
     if (!this->bKeepCommentBoundaries) {
@@ -564,9 +648,9 @@ namespace tfel::utilities {
     auto e = get_end(p);
     if (this->bKeepCommentBoundaries) {
       if (e == pe) {
-        this->tokens.emplace_back(std::string{b, e}, n, o, flag);
+        this->addToken(makeView(b, e), n, o, flag);
       } else {
-        this->tokens.emplace_back(std::string{b, e + 2}, n, o, flag);
+        this->addToken(makeView(b, e + 2), n, o, flag);
       }
     } else {
       if (p != e) {
@@ -575,9 +659,9 @@ namespace tfel::utilities {
           --ps;
         }
         ++ps;
-        this->tokens.emplace_back(std::string{p, ps}, n, o, flag);
+        this->addToken(makeView(p, ps), n, o, flag);
       } else {
-        this->tokens.emplace_back(std::string{p, e}, n, o, flag);
+        this->addToken(makeView(p, e), n, o, flag);
       }
     }
     advance(o, p, e - p);
@@ -589,11 +673,13 @@ namespace tfel::utilities {
   }
 
   void CxxTokenizer::parseCxxComment(Token::size_type &o,
-                                     std::string::const_iterator &p,
-                                     const std::string::const_iterator pe,
+                                     std::string_view::const_iterator &p,
+                                     const std::string_view::const_iterator pe,
                                      const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCxxComment: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::parseCxxComment: " + std::string{m});
+      }
     };
     auto next_token = [this, &p, &o] {
       if (this->bKeepCommentBoundaries) {
@@ -611,27 +697,27 @@ namespace tfel::utilities {
     if ((p != pe) && (*p == '!')) {
       next_token();
       if ((p != pe) && (*p == '<')) {
-        flag = this->tokens.empty() ? Token::Comment
+        flag = !this->hasTokens() ? Token::Comment
                                     : Token::DoxygenBackwardComment;
         next_token();
       } else {
-        flag = this->tokens.empty() ? Token::Comment : Token::DoxygenComment;
+        flag = !this->hasTokens() ? Token::Comment : Token::DoxygenComment;
       }
     }
     if (this->bKeepCommentBoundaries) {
-      this->tokens.emplace_back(std::string{b, pe}, n, o, flag);
+      this->addToken(makeView(b, pe), n, o, flag);
     } else {
       ignore_space(o, p, pe);
-      this->tokens.emplace_back(std::string{p, pe}, n, o, flag);
+      this->addToken(makeView(p, pe), n, o, flag);
     }
     advance(o, p, pe - p);
   }
 
   void CxxTokenizer::parseRawString(Token::size_type &o,
-                                    std::string::const_iterator &p,
-                                    const std::string::const_iterator pe,
+                                    std::string_view::const_iterator &p,
+                                    const std::string_view::const_iterator pe,
                                     const Token::size_type n) {
-    auto findDelimiter = [this, pe](std::string::const_iterator c) {
+    auto findDelimiter = [this, pe](std::string_view::const_iterator c) {
       if (*c != ')') {
         return false;
       }
@@ -651,26 +737,26 @@ namespace tfel::utilities {
       }
       return *c == '\"';
     };
-    this->tokens.emplace_back("", n, o, Token::String);
-    auto &value = this->tokens.back().value;
+    const auto b = p;
+    const auto ob = o;
     while (p != pe) {
       if (findDelimiter(p)) {
+        this->addToken(makeView(b, p), n, ob, Token::String);
         advance(o, p, this->currentRawStringDelimiter.size() + 2);
         this->rawStringOpened = false;
         this->currentRawStringDelimiter.clear();
         return;
-      } else {
-        value += *p;
-        advance(o, p, 1u);
       }
+      advance(o, p, 1u);
     }
+    this->addToken(makeView(b, p), n, ob, Token::String);
   }  // end of parseRawString
 
   void CxxTokenizer::parsePreprocessorDirective(
       Token::size_type &o,
-      std::string::const_iterator &p,
-      const std::string::const_iterator,
-      const std::string::const_iterator pe,
+      std::string_view::const_iterator &p,
+      const std::string_view::const_iterator,
+      const std::string_view::const_iterator pe,
       const Token::size_type n) {
     auto is_preprocessor_keyword = [](const std::string &k) {
       const std::array<const char *, 13> keys = {
@@ -678,12 +764,14 @@ namespace tfel::utilities {
            "#ifndef", "#elif", "#else", "#endif", "#pragma", "#warning"}};
       return std::find(keys.begin(), keys.end(), k) != keys.end();
     };
-    auto throw_if = [](const bool c, const std::string &m) {
-      raise_if(c, "CxxTokenizer::parsePreprocessorDirective: " + m);
+    auto throw_if = [](const bool c, const std::string_view m) {
+      if (c) {
+        raise("CxxTokenizer::parsePreprocessorDirective: " + std::string{m});
+      }
     };
     // preprocessor
     throw_if((p == pe) || (*p != '#'), "invalid call");
-    this->tokens.emplace_back(std::string(1u, '#'), n, o, Token::Preprocessor);
+    this->addToken(makeView(p, std::next(p)), n, o, Token::Preprocessor);
     advance(o, p, 1);
     ignore_space(o, p, pe);
     throw_if(p == pe, "lonely ‘#’");
@@ -691,22 +779,28 @@ namespace tfel::utilities {
         p, pe,
         is_separator_or_space(this->dotAsSeparator, this->minusAsSeparator,
                               this->graveAccentAsSeparator));
-    throw_if(p == pn, "unexpected token '" + std::string(1u, *p) + "'");
+    if (p == pn) {
+      throw_if(true, "unexpected token '" + std::string(1u, *p) + "'");
+    }
     const auto key = std::string{p, pn};
-    throw_if(!is_preprocessor_keyword('#' + key),
-             "invalid preprocessor keyword '" + key + "'");
-    this->tokens.emplace_back(std::string{p, pn}, n, o, Token::Preprocessor);
+    if (!is_preprocessor_keyword('#' + key)) {
+      throw_if(true, "invalid preprocessor keyword '" + key + "'");
+    }
+    this->addToken(makeView(p, pn), n, o, Token::Preprocessor);
     advance(o, p, pn);
     this->parseStandardLine(o, p, p, pe, n);
   }  // end of CxxTokenizer::parsePreprocessorDirective
 
-  void CxxTokenizer::parseStandardLine(Token::size_type &o,
-                                       std::string::const_iterator &p,
-                                       const std::string::const_iterator b,
-                                       const std::string::const_iterator pe,
-                                       const Token::size_type n) {
-    auto throw_if = [](const bool c, const std::string &m) {
-      raise_if(c, "CxxTokenizer::parseStandardLine: " + m);
+  void CxxTokenizer::parseStandardLine(
+      Token::size_type &o,
+      std::string_view::const_iterator &p,
+      const std::string_view::const_iterator b,
+      const std::string_view::const_iterator pe,
+      const Token::size_type n) {
+    auto throw_if = [](const bool c, const std::string_view m) {
+      if (c) {
+        raise("CxxTokenizer::parseStandardLine: " + std::string{m});
+      }
     };
     ignore_space(o, p, pe);
     while (p != pe) {
@@ -714,14 +808,13 @@ namespace tfel::utilities {
         if ((this->treatHashCharacterAsCommentDelimiter) &&
             (this->allowStrayHashCharacter)) {
           if (this->bKeepCommentBoundaries) {
-            this->tokens.emplace_back(std::string{p, pe}, n, o, Token::Comment);
+            this->addToken(makeView(p, pe), n, o, Token::Comment);
             p = pe;
           } else {
             ++p;
             ignore_space(o, p, pe);
             if (p != pe) {
-              this->tokens.emplace_back(std::string{p, pe}, n, o,
-                                        Token::Comment);
+              this->addToken(makeView(p, pe), n, o, Token::Comment);
               p = pe;
             }
           }
@@ -735,19 +828,19 @@ namespace tfel::utilities {
                 (!this->allowStrayHashCharacter) && (std::isalpha(*pn) == 0),
                 "stray ‘#’");
           }
-          this->tokens.emplace_back("#", n, o, Token::Standard);
+          this->addToken("#", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '\\') {
         throw_if((!this->allowStrayBackSlash) && (p != std::prev(pe)),
                  "stray ‘\\’");
-        this->tokens.emplace_back("\\", n, o, Token::Standard);
+        this->addToken("\\", n, o, Token::Standard);
         advance(o, p, 1u);
       } else if (std::isdigit(*p)) {
         if (this->treatNumbers) {
           this->parseNumber(o, p, pe, n);
         } else {
-          this->tokens.emplace_back(std::string(1u, *p), n, o, Token::Standard);
+          this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if ((*p == 'R') &&
@@ -773,7 +866,7 @@ namespace tfel::utilities {
         if (this->treatStrings) {
           this->parseString(o, p, pe, n, '\"');
         } else {
-          this->tokens.emplace_back("\"", n, o, Token::Standard);
+          this->addToken("\"", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '\'') {
@@ -781,7 +874,7 @@ namespace tfel::utilities {
         if (this->treatStrings) {
           this->parseChar(o, p, pe, n);
         } else {
-          this->tokens.emplace_back("\'", n, o, Token::Standard);
+          this->addToken("\'", n, o, Token::Standard);
           advance(o, p, 1u);
         }
       } else if (*p == '<') {
@@ -793,16 +886,15 @@ namespace tfel::utilities {
       } else if ((*p == '+') || (*p == '-')) {
         auto pn = std::next(p);
         if ((pn != pe) && (*pn == *p)) {
-          this->tokens.emplace_back(std::string{p, std::next(pn)}, n, o,
-                                    Token::Standard);
+          this->addToken(makeView(p, std::next(pn)), n, o, Token::Standard);
           advance(o, p, 2u);
         } else if ((*p == '-') && ((pn != pe) && (*pn == '>'))) {
           auto pn2 = std::next(p);
           if ((pn2 != pe) && (*pn == '*')) {
-            this->tokens.emplace_back("->*", n, o, Token::Standard);
+            this->addToken("->*", n, o, Token::Standard);
             advance(o, p, 3u);
           } else {
-            this->tokens.emplace_back("->", n, o, Token::Standard);
+            this->addToken("->", n, o, Token::Standard);
             advance(o, p, 2u);
           }
         } else if (((p == b) ||
@@ -813,8 +905,7 @@ namespace tfel::utilities {
           if (this->treatNumbers) {
             this->parseNumber(o, p, pe, n);
           } else {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           }
         } else {
@@ -839,8 +930,7 @@ namespace tfel::utilities {
           if (this->treatNumbers) {
             this->parseNumber(o, p, pe, n);
           } else {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           }
         } else {
@@ -856,21 +946,20 @@ namespace tfel::utilities {
                                   this->graveAccentAsSeparator));
         if (as.first < pw) {
           if (as.first == p) {
-            this->tokens.emplace_back(as.second, n, o, Token::Standard);
+            const auto se =
+                std::next(p, static_cast<std::ptrdiff_t>(as.second.size()));
+            this->addToken(makeView(p, se), n, o, Token::Standard);
             advance(o, p, as.second.size());
           } else {
-            this->tokens.emplace_back(std::string{p, as.first}, n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, as.first), n, o, Token::Standard);
             advance(o, p, as.first);
           }
         } else {
           if (p == pw) {
-            this->tokens.emplace_back(std::string(1u, *p), n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, std::next(p)), n, o, Token::Standard);
             advance(o, p, 1u);
           } else {
-            this->tokens.emplace_back(std::string{p, pw}, n, o,
-                                      Token::Standard);
+            this->addToken(makeView(p, pw), n, o, Token::Standard);
             advance(o, p, pw);
           }
         }
@@ -879,10 +968,12 @@ namespace tfel::utilities {
     }
   }
 
-  void CxxTokenizer::splitLine(const std::string &line,
+  void CxxTokenizer::splitLine(std::string_view line,
                                const Token::size_type n) {
-    auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::splitLine: " + m);
+    auto throw_if = [](const bool b, const std::string_view m) {
+      if (b) {
+        raise("CxxTokenizer::splitLine: " + std::string{m});
+      }
     };
     auto b = line.begin();
     auto p = b;
@@ -891,25 +982,25 @@ namespace tfel::utilities {
     auto o = Token::size_type{};
     if (this->cStyleCommentOpened) {
       const auto pos3 = line.find("*/");
-      if (tokens.empty()) {
-        this->tokens.emplace_back("", n, o, Token::Comment);
+      if (!this->hasTokens()) {
+        this->addToken("", n, o, Token::Comment);
       }
-      throw_if(((this->tokens.back().flag != Token::Comment) &&
-                (this->tokens.back().flag != Token::DoxygenComment) &&
-                (this->tokens.back().flag != Token::DoxygenBackwardComment)),
+      const auto flag = this->getLastTokenFlag();
+      throw_if(((flag != Token::Comment) && (flag != Token::DoxygenComment) &&
+                (flag != Token::DoxygenBackwardComment)),
                "internal error (previous token is not a comment)");
-      if (!this->tokens.back().value.empty()) {
-        this->tokens.back().value += '\n';
+      if (!this->getLastTokenValue().empty()) {
+        this->appendToLastToken("\n");
       }
-      if (pos3 == std::string::npos) {
-        this->tokens.back().value += line;
+      if (pos3 == std::string_view::npos) {
+        this->appendToLastToken(line);
         advance(o, p, line.size());
         return;
       }
       if (this->bKeepCommentBoundaries) {
-        this->tokens.back().value += std::string{p, p + pos3 + 2};
+        this->appendToLastToken(line.substr(0, pos3 + 2));
       } else {
-        this->tokens.back().value += std::string{p, p + pos3};
+        this->appendToLastToken(line.substr(0, pos3));
       }
       advance(o, p, pos3 + 2);
       this->cStyleCommentOpened = false;
@@ -917,22 +1008,20 @@ namespace tfel::utilities {
     if (this->rawStringOpened) {
       const auto delimiter = ")" + this->currentRawStringDelimiter + '\"';
       const auto pos3 = line.find(delimiter);
-      if (pos3 == std::string::npos) {
+      if (!this->hasTokens()) {
+        this->addToken("", n, o, Token::String);
       }
-      if (tokens.empty()) {
-        this->tokens.emplace_back("", n, o, Token::String);
-      }
-      throw_if((this->tokens.back().flag != Token::String),
+      throw_if((this->getLastTokenFlag() != Token::String),
                "internal error (previous token is not a string)");
-      if (!this->tokens.back().value.empty()) {
-        this->tokens.back().value += '\n';
+      if (!this->getLastTokenValue().empty()) {
+        this->appendToLastToken("\n");
       }
-      if (pos3 == std::string::npos) {
-        this->tokens.back().value += line;
+      if (pos3 == std::string_view::npos) {
+        this->appendToLastToken(line);
         advance(o, p, line.size());
         return;
       }
-      this->tokens.back().value += std::string{p, p + pos3};
+      this->appendToLastToken(line.substr(0, pos3));
       advance(o, p, pos3 + delimiter.size());
       this->rawStringOpened = false;
       this->currentRawStringDelimiter.clear();
@@ -949,55 +1038,106 @@ namespace tfel::utilities {
     }
   }  // end of CxxTokenizer::splitLine
 
-  void CxxTokenizer::stripComments() {
-    for (auto p = this->tokens.begin(); p != this->tokens.end();) {
-      if (p->flag == Token::Comment) {
-        if (this->comments.find(p->line) != this->comments.end()) {
-          this->comments[p->line] += ' ';
-        }
-        this->comments[p->line] = p->value;
-        p = this->tokens.erase(p);
-      } else if (p->flag == Token::DoxygenComment) {
-        auto p2 = p;
-        ++p2;
-        if (p2 != this->tokens.end()) {
-          if (p2->flag == Token::Standard) {
-            if (!p2->comment.empty()) {
-              p2->comment += '\n';
+  static std::string_view getTokenValue(const Token &t) {
+    return t.value;
+  }  // end of getTokenValue
+
+  static std::string_view getTokenValue(const TokenView &t) {
+    return t.value();
+  }  // end of getTokenValue
+
+  static void setTokenValue(Token &t, std::string v) {
+    t.value = std::move(v);
+  }  // end of setTokenValue
+
+  static void setTokenValue(TokenView &t, std::string v) {
+    t.setValue(std::move(v));
+  }  // end of setTokenValue
+
+  /*!
+   * \brief remove the comments from the given tokens. The remaining
+   * tokens are compacted in a single pass.
+   * \param[in,out] tokens: tokens
+   * \param[out] comments: comments, sorted by line
+   */
+  template <typename TokenType>
+  static void stripCommentTokens(
+      std::vector<TokenType> &tokens,
+      std::map<Token::size_type, std::string> &comments) {
+    using size_type = typename std::vector<TokenType>::size_type;
+    // number of tokens kept
+    auto w = size_type{};
+    for (size_type r = 0; r != tokens.size(); ++r) {
+      auto &t = tokens[r];
+      if (t.flag == Token::Comment) {
+        comments[t.line] = std::string{getTokenValue(t)};
+      } else if (t.flag == Token::DoxygenComment) {
+        if (r + 1 != tokens.size()) {
+          auto &t2 = tokens[r + 1];
+          if (t2.flag == Token::Standard) {
+            if (!t2.comment.empty()) {
+              t2.comment += '\n';
             }
-            p2->comment += p->value;
+            t2.comment += getTokenValue(t);
           }
-          if (p2->flag == Token::DoxygenComment) {
-            p2->value = p->value + "\n" + p2->value;
+          if (t2.flag == Token::DoxygenComment) {
+            auto v = std::string{getTokenValue(t)};
+            v += '\n';
+            v += getTokenValue(t2);
+            setTokenValue(t2, std::move(v));
           }
         }
-        p = this->tokens.erase(p);
-      } else if (p->flag == Token::DoxygenBackwardComment) {
-        auto p2 = p;
-        --p2;
-        if (p2 != this->tokens.begin()) {
-          if (p2->flag == Token::Standard) {
-            p2->comment += p->value;
+      } else if (t.flag == Token::DoxygenBackwardComment) {
+        // the first token is not documented by a backward comment
+        if (w > 1) {
+          auto &t2 = tokens[w - 1];
+          if (t2.flag == Token::Standard) {
+            t2.comment += getTokenValue(t);
           }
         }
-        p = this->tokens.erase(p);
       } else {
-        ++p;
+        if (w != r) {
+          tokens[w] = std::move(t);
+        }
+        ++w;
       }
     }
+    tokens.erase(tokens.begin() + static_cast<std::ptrdiff_t>(w),
+                 tokens.end());
+  }  // end of stripCommentTokens
+
+  void CxxTokenizer::stripComments() {
+    if (this->tokenViews) {
+      stripCommentTokens(this->views, this->comments);
+    } else {
+      stripCommentTokens(this->tokens, this->comments);
+    }
   }  // end of CxxTokenizer::stripComments
 
-  void CxxTokenizer::printFileTokens(std::ostream &out) const {
-    auto p = this->tokens.begin();
-    auto line = p->line;
-    for (const auto &t : this->tokens) {
+  template <typename TokenType>
+  static void printTokens(std::ostream &out,
+                          const std::vector<TokenType> &tokens) {
+    if (tokens.empty()) {
+      out << '\n';
+      return;
+    }
+    auto line = tokens.front().line;
+    for (const auto &t : tokens) {
       if (t.line != line) {
         out << '\n';
         line = t.line;
       }
-      out << t.value << " ";
+      out << getTokenValue(t) << " ";
     }
     out << '\n';
+  }  // end of printTokens
+
+  void CxxTokenizer::printFileTokens(std::ostream &out) const {
+    if (this->tokenViews) {
+      printTokens(out, this->views);
+    } else {
+      printTokens(out, this->tokens);
+    }
   }
 
   bool CxxTokenizer::isValidIdentifier(std::string_view s, const bool b) {
@@ -1117,9 +1257,63 @@ namespace tfel::utilities {
     this->rawStringOpened = false;
     this->currentRawStringDelimiter.clear();
     this->tokens.clear();
+    this->views.clear();
+    this->buffers.clear();
     this->comments.clear();
   }  // end of CxxTokenizer::clear
 
+  void CxxTokenizer::produceTokenViews(const bool b) {
+    this->tokenViews = b;
+  }  // end of CxxTokenizer::produceTokenViews
+
+  const CxxTokenizer::TokenViewsContainer &CxxTokenizer::getTokenViews()
+      const {
+    return this->views;
+  }  // end of CxxTokenizer::getTokenViews
+
+  void CxxTokenizer::addToken(const std::string_view v,
+                              const Token::size_type n,
+                              const Token::size_type o,
+                              const Token::TokenFlag f) {
+    if (this->tokenViews) {
+      this->views.emplace_back(v, n, o, f);
+    } else {
+      this->tokens.emplace_back(std::string{v}, n, o, f);
+    }
+  }  // end of CxxTokenizer::addToken
+
+  bool CxxTokenizer::hasTokens() const {
+    return this->tokenViews ? !this->views.empty() : !this->tokens.empty();
+  }  // end of CxxTokenizer::hasTokens
+
+  Token::TokenFlag CxxTokenizer::getLastTokenFlag() const {
+    return this->tokenViews ? this->views.back().flag
+                            : this->tokens.back().flag;
+  }  // end of CxxTokenizer::getLastTokenFlag
+
+  std::string_view CxxTokenizer::getLastTokenValue() const {
+    if (this->tokenViews) {
+      return this->views.back().value();
+    }
+    return this->tokens.back().value;
+  }  // end of CxxTokenizer::getLastTokenValue
+
+  void CxxTokenizer::setLastTokenValue(std::string v) {
+    if (this->tokenViews) {
+      this->views.back().setValue(std::move(v));
+    } else {
+      this->tokens.back().value = std::move(v);
+    }
+  }  // end of CxxTokenizer::setLastTokenValue
+
+  void CxxTokenizer::appendToLastToken(const std::string_view s) {
+    if (this->tokenViews) {
+      this->views.back().append(s);
+    } else {
+      this->tokens.back().value.append(s);
+    }
+  }  // end of CxxTokenizer::appendToLastToken
+
   void CxxTokenizer::checkNotEndOfLine(const std::string &method,
                                        const_iterator &p,
                                        const const_iterator pe) {
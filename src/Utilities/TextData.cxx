@@ -11,12 +11,16 @@
  * project under specific licensing conditions.
  */
 
+#include <cctype>
 #include <cassert>
+#include <cstdlib>
+#include <charconv>
 #include <stdexcept>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <iterator>
+#include <string_view>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "TFEL/Utilities/TextData.hxx"
@@ -24,12 +28,56 @@
 
 namespace tfel::utilities {
 
+  /*!
+   * \return if the given character separates two columns
+   * \param[in] c: character
+   */
+  static bool isColumnSeparator(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+           (c == '\f');
+  }  // end of isColumnSeparator
+
+  /*!
+   * \brief parse a floating-point number.
+   *
+   * Only numbers starting by a digit or a dot, optionally preceded by a
+   * sign, are handled, so that the given range is known to be treated as
+   * exactly one token by the `CxxTokenizer` class.
+   *
+   * \return true if the whole range was parsed successfully
+   * \param[out] v: value
+   * \param[in] b: beginning of the range
+   * \param[in] e: end of the range
+   */
+  static bool parseNumber(double& v, const char* b, const char* const e) {
+    auto p = b;
+    if ((*p == '+') || (*p == '-')) {
+      ++p;
+    }
+    if ((p == e) || (!((std::isdigit(*p)) || (*p == '.')))) {
+      return false;
+    }
+    if (*b == '+') {
+      b = p;
+    }
+#if defined(__cpp_lib_to_chars)
+    const auto r = std::from_chars(b, e, v);
+    return (r.ec == std::errc()) && (r.ptr == e);
+#else  /* defined(__cpp_lib_to_chars) */
+    // the number is followed by a column separator or by the end of the
+    // buffer, which is null-terminated
+    char* pe;
+    v = std::strtod(b, &pe);
+    return pe == e;
+#endif /* defined(__cpp_lib_to_chars) */
+  }  // end of parseNumber
+
   TextData::TextData(const std::string& file, const std::string& format) {
-    auto get_legends = [](const std::string& l) {
+    auto get_legends = [](const std::string_view l) {
       std::vector<std::string> r;
       CxxTokenizer t;
       t.treatCharAsString(true);
-      t.parseString(l);
+      t.parseStringView(l);
       t.stripComments();
       std::for_each(t.begin(), t.end(), [&r](const Token& w) {
         if (w.flag == Token::String) {
@@ -40,43 +88,48 @@ namespace tfel::utilities {
       });
       return r;
     };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
-        nl.tokens.push_back(w);
-        nl.tokens.back().line = n;
-      });
-      this->lines.push_back(std::move(nl));
-    };
+    // reading the file in one block
+    std::ifstream f{file, std::ios::in | std::ios::binary};
+    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
+    f.seekg(0, std::ios::end);
+    const auto fsize = f.tellg();
+    raise_if(fsize < 0, "TextData::TextData: can't read '" + file + '\'');
+    f.seekg(0, std::ios::beg);
+    this->buffer.resize(static_cast<std::string::size_type>(fsize));
+    f.read(this->buffer.data(), fsize);
+    raise_if(!f, "TextData::TextData: can't read '" + file + '\'');
+    // splitting the file in lines
     auto firstLine = true;
     auto firstComments = true;
     auto nbr = size_type{1};
-    std::ifstream f{file};
-    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
-    while (!f.eof()) {
-      auto line = std::string{};
-      getline(f, line);
-      if (line.empty()) {
+    auto pos = std::string::size_type{};
+    const auto bsize = this->buffer.size();
+    while (pos < bsize) {
+      auto le = this->buffer.find('\n', pos);
+      if (le == std::string::npos) {
+        le = bsize;
+      }
+      const auto lb = pos;
+      pos = le + 1;
+      if (le == lb) {
         continue;
       }
-      if (line[0] == '#') {
+      if (this->buffer[lb] == '#') {
         if (!firstComments) {
           continue;
         }
         if (format.empty()) {
-          line.erase(line.begin());
+          const auto line =
+              std::string_view{this->buffer}.substr(lb + 1, le - lb - 1);
           if (firstLine) {
             this->legends = get_legends(line);
           }
-          this->preamble.push_back(line);
+          this->preamble.emplace_back(line);
         }
       } else {
         if (((format == "gnuplot") || (format == "alcyone")) && (firstLine)) {
-          this->legends = get_legends(line);
+          this->legends =
+              get_legends(std::string_view{this->buffer}.substr(lb, le - lb));
           bool all_numbers = true;
           for (const auto& l : this->legends) {
             try {
@@ -90,10 +143,10 @@ namespace tfel::utilities {
           }
           if (all_numbers) {
             this->legends.clear();
-            add_line(line, nbr);
+            this->rows.push_back(Row{nbr, lb, le});
           }
         } else {
-          add_line(line, nbr);
+          this->rows.push_back(Row{nbr, lb, le});
           firstComments = false;
         }
       }
@@ -102,6 +155,67 @@ namespace tfel::utilities {
     }
   }  // end of TextData::TextData
 
+  void TextData::tokenizeRows() const {
+    std::call_once(this->lines_flag, [this] {
+      const auto b = std::string_view{this->buffer};
+      // the same tokenizer is used for all the rows, which are parsed
+      // directly from the buffer
+      CxxTokenizer t;
+      t.treatCharAsString(true);
+      this->lines.reserve(this->rows.size());
+      for (const auto& r : this->rows) {
+        t.clear();
+        t.parseStringView(b.substr(r.first, r.last - r.first));
+        t.stripComments();
+        auto& nl = this->lines.emplace_back();
+        nl.tokens.reserve(t.size());
+        for (const auto& w : t) {
+          nl.tokens.push_back(w);
+          nl.tokens.back().line = r.line;
+        }
+      }
+    });
+  }  // end of TextData::tokenizeRows
+
+  void TextData::parseRows() const {
+    std::call_once(this->values_flag, [this] {
+      const auto* const data = this->buffer.data();
+      const auto nr = this->rows.size();
+      this->offsets.resize(nr + 1);
+      this->numeric.resize(nr);
+      this->offsets[0] = 0;
+      for (decltype(this->rows.size()) r = 0; r != nr; ++r) {
+        const auto o = this->values.size();
+        const auto* p = data + this->rows[r].first;
+        const auto* const pe = data + this->rows[r].last;
+        auto v = double{};
+        auto b = true;
+        while (b) {
+          while ((p != pe) && (isColumnSeparator(*p))) {
+            ++p;
+          }
+          if (p == pe) {
+            break;
+          }
+          const auto pb = p;
+          while ((p != pe) && (!isColumnSeparator(*p))) {
+            ++p;
+          }
+          b = parseNumber(v, pb, p);
+          if (b) {
+            this->values.push_back(v);
+          }
+        }
+        if (!b) {
+          // this row will be treated by the tokenizer
+          this->values.resize(o);
+        }
+        this->numeric[r] = b;
+        this->offsets[r + 1] = this->values.size();
+      }
+    });
+  }  // end of TextData::parseRows
+
   const std::vector<std::string>& TextData::getLegends() const {
     return this->legends;
   }  // end of TextData::getLegends
@@ -138,43 +252,69 @@ namespace tfel::utilities {
     auto throw_if = [](const bool b, const std::string& msg) {
       raise_if(b, "TextData::getColumn: " + msg);
     };
+    auto throw_if_too_short = [&throw_if, i](const bool b, const size_type n) {
+      if (b) {
+        throw_if(true, "line '" + std::to_string(n) +
+                           "' "
+                           "does not have '" +
+                           std::to_string(i) + "' columns.");
+      }
+    };
     tab.clear();
-    tab.reserve(this->lines.size());
+    tab.reserve(this->rows.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
     // treatment
-    for (const auto& l : this->lines) {
-      auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
-      throw_if(l.tokens.size() < i, "line '" + std::to_string(n) +
-                                        "' "
-                                        "does not have '" +
-                                        std::to_string(i) + "' columns.");
-      tab.push_back(convert<double>(l.tokens.at(i - 1u).value));
+    this->parseRows();
+    // the tokens of the non numeric rows are only used to extract one
+    // value, so they are produced as views in the buffer
+    const auto b = std::string_view{this->buffer};
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.produceTokenViews(true);
+    for (decltype(this->rows.size()) r = 0; r != this->rows.size(); ++r) {
+      if (this->numeric[r]) {
+        const auto nv = this->offsets[r + 1] - this->offsets[r];
+        throw_if_too_short(nv < i, this->rows[r].line);
+        tab.push_back(this->values[this->offsets[r] + i - 1]);
+      } else {
+        const auto& row = this->rows[r];
+        t.clear();
+        t.parseStringView(b.substr(row.first, row.last - row.first));
+        t.stripComments();
+        const auto& tokens = t.getTokenViews();
+        throw_if_too_short(tokens.size() < i, row.line);
+        tab.push_back(convert<double>(std::string{tokens[i - 1u].value()}));
+      }
     }
   }  // end of TextData::getColumn
 
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    this->tokenizeRows();
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    this->tokenizeRows();
     return this->lines.end();
   }  // end of TextData::end()
 
   void TextData::skipLines(const Token::size_type n) {
-    auto get_line = [](const Line& l) -> Token::size_type {
-      return l.tokens.empty() ? 0 : l.tokens[0].line;
-    };
-    if (this->lines.empty()) {
-      return;
-    }
-    auto p = this->lines.begin();
-    while ((get_line(*p) <= n + 1) && (p != this->lines.end())) {
+    auto p = this->rows.begin();
+    while ((p != this->rows.end()) && (p->line <= n + 1)) {
       ++p;
     }
-    lines.erase(lines.begin(), p);
-  }
+    const auto nr = p - this->rows.begin();
+    this->rows.erase(this->rows.begin(), p);
+    if (!this->lines.empty()) {
+      this->lines.erase(this->lines.begin(), this->lines.begin() + nr);
+    }
+    if (!this->offsets.empty()) {
+      this->offsets.erase(this->offsets.begin(), this->offsets.begin() + nr);
+      this->numeric.erase(this->numeric.begin(), this->numeric.begin() + nr);
+    }
+  }  // end of TextData::skipLines
 
 }  // end of namespace tfel::utilities
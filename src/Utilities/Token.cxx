@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <utility>
 #include "TFEL/Utilities/Token.hxx"
 
 namespace tfel::utilities {
@@ -22,11 +23,11 @@ namespace tfel::utilities {
   Token& Token::operator=(Token&&) = default;
   Token& Token::operator=(const Token&) = default;
 
-  Token::Token(const std::string& v,
+  Token::Token(std::string v,
                const size_type l,
                const size_type o,
                const TokenFlag f)
-      : value(v), line(l), offset(o), flag(f) {}
+      : value(std::move(v)), line(l), offset(o), flag(f) {}
 
   Token::~Token() noexcept = default;
 
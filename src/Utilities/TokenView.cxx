@@ -0,0 +1,76 @@
+/*!
+ * \file   src/Utilities/TokenView.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <utility>
+#include "TFEL/Utilities/TokenView.hxx"
+
+namespace tfel::utilities {
+
+  TokenView::TokenView() = default;
+  TokenView::TokenView(TokenView&&) = default;
+  TokenView& TokenView::operator=(TokenView&&) = default;
+
+  TokenView::TokenView(const TokenView& t)
+      : line(t.line),
+        offset(t.offset),
+        comment(t.comment),
+        flag(t.flag),
+        view(t.view) {
+    if (t.storage != nullptr) {
+      this->storage = std::make_unique<std::string>(*(t.storage));
+      this->view = *(this->storage);
+    }
+  }  // end of TokenView
+
+  TokenView& TokenView::operator=(const TokenView& t) {
+    if (this != &t) {
+      *this = TokenView(t);
+    }
+    return *this;
+  }  // end of operator=
+
+  TokenView::TokenView(const std::string_view v,
+                       const size_type l,
+                       const size_type o,
+                       const TokenFlag f)
+      : line(l), offset(o), flag(f), view(v) {}
+
+  void TokenView::setValue(std::string v) {
+    if (this->storage == nullptr) {
+      this->storage = std::make_unique<std::string>(std::move(v));
+    } else {
+      *(this->storage) = std::move(v);
+    }
+    this->view = *(this->storage);
+  }  // end of setValue
+
+  void TokenView::append(const std::string_view s) {
+    if (this->storage == nullptr) {
+      this->storage = std::make_unique<std::string>(this->view);
+    }
+    this->storage->append(s);
+    this->view = *(this->storage);
+  }  // end of append
+
+  bool TokenView::ownsValue() const noexcept {
+    return this->storage != nullptr;
+  }  // end of ownsValue
+
+  TokenView::~TokenView() noexcept = default;
+
+  bool isComment(const TokenView& t) {
+    return ((t.flag == Token::Comment) || (t.flag == Token::DoxygenComment) ||
+            (t.flag == Token::DoxygenBackwardComment));
+  }  // end of isComment
+
+}  // end of namespace tfel::utilities
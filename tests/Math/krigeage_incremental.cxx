@@ -0,0 +1,126 @@
+/*!
+ * \file   tests/Math/krigeage_incremental.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/Kriging.hxx"
+
+struct KrigingIncrementalTest final : public tfel::tests::TestCase {
+  KrigingIncrementalTest()
+      : tfel::tests::TestCase("TFEL/Math", "KrigingIncrementalTest") {
+    auto g = std::mt19937{};
+    auto d = std::uniform_real_distribution<double>(0, 1);
+    for (int i = 0; i != 300; ++i) {
+      auto p = tfel::math::tvector<2u, double>{};
+      p(0) = d(g);
+      p(1) = d(g);
+      this->samples.push_back(p);
+      this->values.push_back(std::exp(std::cos(p(0) * p(1))) + p(1));
+    }
+    for (int i = 0; i != 4000; ++i) {
+      auto p = tfel::math::tvector<2u, double>{};
+      p(0) = d(g);
+      p(1) = d(g);
+      this->points.push_back(p);
+    }
+  }  // end of KrigingIncrementalTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  using Kriging = tfel::math::Kriging<2u, double>;
+  //! \brief add the samples of indices in range [b, e[
+  void addSamples(Kriging& k,
+                  const std::vector<double>::size_type b,
+                  const std::vector<double>::size_type e) const {
+    for (auto i = b; i != e; ++i) {
+      k.addValue(this->samples[i], this->values[i]);
+    }
+  }
+  // the interpolation goes through the samples. The decomposition
+  // treats several blocks of columns, using threads.
+  void test1() {
+    auto k = Kriging{};
+    k.setNumberOfThreads(4);
+    this->addSamples(k, 0, this->samples.size());
+    k.buildInterpolation();
+    for (decltype(this->samples.size()) i = 0; i != this->samples.size();
+         ++i) {
+      TFEL_TESTS_ASSERT(std::abs(k(this->samples[i]) - this->values[i]) <
+                        1e-8);
+    }
+  }
+  // the decomposition extended with new samples gives the same
+  // interpolation as a decomposition of the whole system
+  void test2() {
+    auto k1 = Kriging{};
+    k1.setNumberOfThreads(1);
+    this->addSamples(k1, 0, this->samples.size());
+    k1.buildInterpolation();
+    auto k2 = Kriging{};
+    k2.setNumberOfThreads(1);
+    this->addSamples(k2, 0, 200);
+    k2.buildInterpolation();
+    this->addSamples(k2, 200, this->samples.size());
+    k2.updateInterpolation();
+    for (const auto& p : this->points) {
+      TFEL_TESTS_ASSERT(std::abs(k1(p) - k2(p)) < 1e-8);
+    }
+  }
+  // batched evaluation
+  void test3() {
+    auto k1 = Kriging{};
+    k1.setNumberOfThreads(1);
+    this->addSamples(k1, 0, this->samples.size());
+    k1.buildInterpolation();
+    auto k2 = Kriging{};
+    k2.setNumberOfThreads(4);
+    this->addSamples(k2, 0, this->samples.size());
+    k2.buildInterpolation();
+    auto r = std::vector<double>(this->points.size());
+    k2.evaluate(r.data(), this->points.data(), this->points.size());
+    for (decltype(this->points.size()) i = 0; i != this->points.size(); ++i) {
+      // the decompositions are identical whatever the number of threads
+      TFEL_TESTS_ASSERT(std::abs(k1(this->points[i]) - r[i]) < 1e-12);
+    }
+  }
+  //! \brief samples
+  std::vector<tfel::math::tvector<2u, double>> samples;
+  //! \brief values at samples
+  std::vector<double> values;
+  //! \brief evaluation points
+  std::vector<tfel::math::tvector<2u, double>> points;
+};
+
+TFEL_TESTS_GENERATE_PROXY(KrigingIncrementalTest, "KrigingIncrementalTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("KrigingIncremental.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,154 @@
+/*!
+ * \file   tests/Math/newton_raphson_jacobian_reuse.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/General/MathConstants.hxx"
+#include "TFEL/Math/TinyNewtonRaphsonJacobianReuseSolver.hxx"
+
+struct NewtonRaphsonJacobianReuseSolver
+    : public tfel::math::TinyNewtonRaphsonJacobianReuseSolver<
+          2u,
+          double,
+          NewtonRaphsonJacobianReuseSolver> {
+  NewtonRaphsonJacobianReuseSolver() {
+    this->zeros = {0., 0.};
+    this->epsilon = 1.e-14;
+    this->iterMax = 50;
+  }
+
+  bool solve() { return this->solveNonLinearSystem(); }
+
+  auto getCurrentEstimate() const noexcept { return this->zeros; }
+
+  auto getNumberOfJacobianDecompositions() const noexcept {
+    return this->number_of_jacobian_decompositions;
+  }
+
+  auto getNumberOfJacobianReuses() const noexcept {
+    return this->number_of_jacobian_reuses;
+  }
+
+  bool computeResidual() noexcept {
+    constexpr double a = 1.;
+    constexpr double b = 10.;
+    auto& f = this->fzeros;
+    auto& x = this->zeros;
+    auto& J = this->jacobian;
+    f(0) = a * (1 - x(0));
+    f(1) = b * (x(1) - x(0) * x(0));
+    J(0, 0) = -a;
+    J(0, 1) = 0.;
+    J(1, 0) = -2 * b * x(0);
+    J(1, 1) = b;
+    return true;
+  }  // end of computeResidual
+
+};  // end of struct NewtonRaphsonJacobianReuseSolver
+
+struct NewtonRaphsonJacobianReuseSolver2
+    : public tfel::math::TinyNewtonRaphsonJacobianReuseSolver<
+          1u,
+          double,
+          NewtonRaphsonJacobianReuseSolver2> {
+  NewtonRaphsonJacobianReuseSolver2(const double t) {
+    this->zeros = {1.5};
+    this->epsilon = 1.e-14;
+    this->iterMax = 50;
+    this->jacobian_reuse_threshold = t;
+  }
+
+  bool solve() { return this->solveNonLinearSystem(); }
+
+  auto getCurrentEstimate() const noexcept { return this->zeros(0); }
+
+  auto getNumberOfJacobianDecompositions() const noexcept {
+    return this->number_of_jacobian_decompositions;
+  }
+
+  auto getNumberOfJacobianReuses() const noexcept {
+    return this->number_of_jacobian_reuses;
+  }
+
+  bool computeResidual() noexcept {
+    auto& f = this->fzeros(0);
+    auto& x = this->zeros(0);
+    auto& J = this->jacobian(0, 0);
+    f = x * x - 2.;
+    J = 2 * x;
+    return true;
+  }  // end of computeResidual
+};   // end of struct NewtonRaphsonJacobianReuseSolver2
+
+struct TinyNewtonRaphsonJacobianReuseSolverTest final
+    : public tfel::tests::TestCase {
+  TinyNewtonRaphsonJacobianReuseSolverTest()
+      : tfel::tests::TestCase("TFEL/Math",
+                              "TinyNewtonRaphsonJacobianReuseSolverTest") {
+  }  // end of TinyNewtonRaphsonJacobianReuseSolverTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    auto nr = NewtonRaphsonJacobianReuseSolver{};
+    TFEL_TESTS_ASSERT(nr.solve());
+    const auto x = nr.getCurrentEstimate();
+    TFEL_TESTS_ASSERT(std::abs(x(0) - 1) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(x(1) - 1) < 1e-14);
+    TFEL_TESTS_ASSERT(nr.getNumberOfJacobianDecompositions() >= 1);
+  }
+  // the decomposition of the jacobian is reused as long as the
+  // convergence is fast enough
+  void test2() {
+    using namespace tfel::math;
+    auto nr = NewtonRaphsonJacobianReuseSolver2{0.25};
+    TFEL_TESTS_ASSERT(nr.solve());
+    const auto x = nr.getCurrentEstimate();
+    TFEL_TESTS_ASSERT(std::abs(x - Cste<double>::sqrt2) < 1e-14);
+    TFEL_TESTS_ASSERT(nr.getNumberOfJacobianDecompositions() >= 1);
+    TFEL_TESTS_ASSERT(nr.getNumberOfJacobianReuses() >= 1);
+  }
+  // a null threshold is equivalent to the standard Newton-Raphson
+  // algorithm
+  void test3() {
+    using namespace tfel::math;
+    auto nr = NewtonRaphsonJacobianReuseSolver2{0};
+    TFEL_TESTS_ASSERT(nr.solve());
+    const auto x = nr.getCurrentEstimate();
+    TFEL_TESTS_ASSERT(std::abs(x - Cste<double>::sqrt2) < 1e-14);
+    TFEL_TESTS_ASSERT(nr.getNumberOfJacobianReuses() == 0);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TinyNewtonRaphsonJacobianReuseSolverTest,
+                          "TinyNewtonRaphsonJacobianReuseSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TinyNewtonRaphsonJacobianReuseSolver.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
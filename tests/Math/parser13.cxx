@@ -0,0 +1,141 @@
+/*!
+ * \file   tests/Math/parser13.cxx
+ * \brief  This file tests the compilation of the expressions handled by
+ * the `Evaluator` class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest13 final : public tfel::tests::TestCase {
+  ParserTest13()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest13") {
+  }  // end of ParserTest13
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief compare the compiled expressions to the expression trees
+  void test1() {
+    constexpr auto eps = double{1e-14};
+    const auto formulae = std::vector<std::string>{
+        "2*x+y",
+        "-x*(y-3)/2",
+        "x**y",
+        "x**3-2*y**-2",
+        "power<3>(x)+power<-2>(y)+power<0>(x)",
+        "exp(x)*sin(y)+cos(x)*tan(y)+log(y)+sqrt(x)",
+        "cosh(x)-sinh(y)+tanh(x)+abs(-y)+log10(x)",
+        "min(x,y)+max(x,2*y)+atan2(x,y)",
+        "x>y ? x : y",
+        "x<y ? (y>2 ? x+y : x-y) : 2*x",
+        "(x<y)&&(y<3) ? 1 : 2",
+        "(x>y)||(y>=3) ? 1 : 2",
+        "!(x==y) ? x : -y",
+        "1<2 ? x : y",
+        "1>2 ? x : y",
+        "H(x-1)*x+H(y-0.5)*y",
+        "2*3+x",
+        "(1+2)*(x-y*(4-2))"};
+    const auto values = std::vector<std::pair<double, double>>{
+        {0.5, 1.2}, {1.2, 0.5}, {1.1, 1.1}, {2.3, 4.5}};
+    const auto vars = std::vector<std::string>{"x", "y"};
+    for (const auto& f : formulae) {
+      auto e = tfel::math::Evaluator(vars, f);
+      auto ce = tfel::math::Evaluator(vars, f);
+      ce.compile();
+      TFEL_TESTS_ASSERT(!e.isCompiled());
+      TFEL_TESTS_ASSERT(ce.isCompiled());
+      for (const auto& [x, y] : values) {
+        e.setVariableValue("x", x);
+        e.setVariableValue("y", y);
+        ce.setVariableValue("x", x);
+        ce.setVariableValue("y", y);
+        TFEL_TESTS_ASSERT(std::abs(e.getValue() - ce.getValue()) < eps);
+      }
+    }
+  }  // end of test1
+  //! \brief errors are reported at runtime
+  void test2() {
+    auto e = tfel::math::Evaluator("x/(2-2)");
+    e.compile();
+    TFEL_TESTS_ASSERT(e.isCompiled());
+    e.setVariableValue("x", 1);
+    TFEL_TESTS_CHECK_THROW(e.getValue(), std::runtime_error);
+    auto e2 = tfel::math::Evaluator("log(x)");
+    e2.compile();
+    e2.setVariableValue("x", -1);
+    TFEL_TESTS_CHECK_THROW(e2.getValue(), std::runtime_error);
+    e2.setVariableValue("x", 1);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue()) < 1e-14);
+  }  // end of test2
+  //! \brief copies of a compiled evaluator are compiled
+  void test3() {
+    auto e = tfel::math::Evaluator("2*x+1");
+    e.compile();
+    auto e2 = e;
+    TFEL_TESTS_ASSERT(e2.isCompiled());
+    e2.setVariableValue("x", 2);
+    e.setVariableValue("x", 3);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 5) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - 7) < 1e-14);
+    auto e3 = tfel::math::Evaluator("x");
+    TFEL_TESTS_ASSERT(!e3.isCompiled());
+    e3 = e;
+    TFEL_TESTS_ASSERT(e3.isCompiled());
+    TFEL_TESTS_ASSERT(std::abs(e3.getValue() - 7) < 1e-14);
+    // the derivative is computed from the expression tree
+    const auto de = std::dynamic_pointer_cast<tfel::math::Evaluator>(
+        e.differentiate("x"));
+    TFEL_TESTS_ASSERT(std::abs(de->getValue() - 2) < 1e-14);
+  }  // end of test3
+  //! \brief external functions
+  void test4() {
+    using namespace tfel::math;
+    using namespace tfel::math::parser;
+    auto m = std::make_shared<ExternalFunctionManager>();
+    m->operator[]("f") =
+        std::make_shared<Evaluator>(std::vector<std::string>(1, "x"), "2*x", m);
+    auto e = Evaluator("f(y)+y", m);
+    e.compile();
+    TFEL_TESTS_ASSERT(e.isCompiled());
+    e.setVariableValue("y", 2);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - 6) < 1e-14);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest13, "ParserTest13");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser13.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,149 @@
+/*!
+ * \file   tests/Math/parser14.cxx
+ * \brief  This file tests the evaluation of formulae on a set of points
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest14 final : public tfel::tests::TestCase {
+  ParserTest14()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest14") {
+  }  // end of ParserTest14
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief compare the batch evaluation to the evaluation point by point
+  void test1() {
+    using size_type = std::vector<double>::size_type;
+    constexpr auto eps = double{1e-14};
+    constexpr auto n = size_type{100};
+    const auto formulae = std::vector<std::string>{
+        "2*x+y",
+        "-x*(y-3)/2",
+        "x**y+power<3>(x)-2*y**-2",
+        "exp(x)*sin(y)+cos(x)*tan(y)+log(y)+sqrt(x)",
+        "min(x,y)+max(x,2*y)+atan2(x,y)",
+        "H(x-1)*x+H(y-0.5)*y",
+        "x>y ? x : y",
+        "(x<y)&&(y<3) ? 1 : 2"};
+    const auto vars = std::vector<std::string>{"x", "y"};
+    auto x = std::vector<double>(n);
+    auto y = std::vector<double>(n);
+    for (size_type i = 0; i != n; ++i) {
+      x[i] = 0.1 + 0.02 * i;
+      y[i] = 2.1 - 0.015 * i;
+    }
+    for (const auto& f : formulae) {
+      for (const auto b : {false, true}) {
+        auto e = tfel::math::Evaluator(vars, f);
+        auto e2 = tfel::math::Evaluator(vars, f);
+        if (b) {
+          e2.compile();
+        }
+        auto r = std::vector<double>(n);
+        e2.getValues(r.data(), std::vector<const double*>{x.data(), y.data()},
+                     n);
+        for (size_type i = 0; i != n; ++i) {
+          e.setVariableValue("x", x[i]);
+          e.setVariableValue("y", y[i]);
+          TFEL_TESTS_ASSERT(std::abs(e.getValue() - r[i]) < eps);
+        }
+        // the value of y is given by the evaluator
+        e2.setVariableValue("y", 1.2);
+        e2.getValues(r.data(),
+                     std::map<std::string, const double*>{{"x", x.data()}}, n);
+        e.setVariableValue("y", 1.2);
+        for (size_type i = 0; i != n; ++i) {
+          e.setVariableValue("x", x[i]);
+          TFEL_TESTS_ASSERT(std::abs(e.getValue() - r[i]) < eps);
+        }
+        // the values of the variables stored in the evaluator are left
+        // unchanged
+        e2.setVariableValue("x", 0.7);
+        e2.getValues(r.data(), std::vector<const double*>{x.data(), y.data()},
+                     n);
+        e.setVariableValue("x", 0.7);
+        TFEL_TESTS_ASSERT(std::abs(e.getValue() - e2.getValue()) < eps);
+      }
+    }
+  }  // end of test1
+  //! \brief errors are reported
+  void test2() {
+    using args = std::vector<const double*>;
+    const auto x = std::vector<double>{1, 2, -1, 4};
+    const auto y = std::vector<double>{1, 2, 0, 4};
+    auto r = std::vector<double>(x.size());
+    auto e = tfel::math::Evaluator("log(x)");
+    TFEL_TESTS_CHECK_THROW(e.getValues(r.data(), args{x.data()}, x.size()),
+                           std::runtime_error);
+    auto e2 = tfel::math::Evaluator("1/x");
+    TFEL_TESTS_CHECK_THROW(e2.getValues(r.data(), args{y.data()}, y.size()),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(e2.getValues(r.data(), args{}, x.size()),
+                           std::runtime_error);
+    auto e3 = tfel::math::Evaluator("sqrt(x)");
+    e3.compile();
+    TFEL_TESTS_CHECK_THROW(e3.getValues(r.data(), args{x.data()}, x.size()),
+                           std::runtime_error);
+  }  // end of test2
+  //! \brief external functions
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::parser;
+    auto m = std::make_shared<ExternalFunctionManager>();
+    m->operator[]("f") =
+        std::make_shared<Evaluator>(std::vector<std::string>(1, "x"), "2*x", m);
+    auto e = Evaluator("f(y)+y", m);
+    const auto y = std::vector<double>{1, 2, 3};
+    auto r = std::vector<double>(y.size());
+    const auto args = std::vector<const double*>{y.data()};
+    e.getValues(r.data(), args, y.size());
+    for (std::vector<double>::size_type i = 0; i != y.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - 3 * y[i]) < 1e-14);
+    }
+    // default implementation of the ExternalFunction class
+    auto& f = static_cast<ExternalFunction&>(*(m->operator[]("f")));
+    f.ExternalFunction::getValues(r.data(), args, y.size());
+    for (std::vector<double>::size_type i = 0; i != y.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - 2 * y[i]) < 1e-14);
+    }
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest14, "ParserTest14");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser14.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
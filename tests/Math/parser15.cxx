@@ -0,0 +1,126 @@
+/*!
+ * \file   tests/Math/parser15.cxx
+ * \brief  This file tests the concurrent evaluation of formulae using
+ * evaluation contexts
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest15 final : public tfel::tests::TestCase {
+  ParserTest15()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest15") {
+  }  // end of ParserTest15
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief number of threads
+  static constexpr int nthreads = 8;
+  //! \brief number of evaluations per thread
+  static constexpr int nevaluations = 10000;
+  //! \brief evaluations using a context do not modify the evaluator
+  void test1() {
+    auto e = tfel::math::Evaluator("2*x+y");
+    e.setVariableValue("x", 1);
+    e.setVariableValue("y", 2);
+    auto c = e.makeEvaluationContext();
+    e.setVariableValue(c, "x", 3);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue(c) - 8) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - 4) < 1e-14);
+    TFEL_TESTS_ASSERT(!e.isReentrant());
+    e.compile();
+    TFEL_TESTS_ASSERT(e.isReentrant());
+    TFEL_TESTS_ASSERT(std::abs(e.getValue(c) - 8) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() - 4) < 1e-14);
+    TFEL_TESTS_CHECK_THROW(e.setVariableValue(c, "z", 3), std::runtime_error);
+    const auto empty = tfel::math::Evaluator::EvaluationContext{};
+    TFEL_TESTS_CHECK_THROW(e.getValue(empty), std::runtime_error);
+  }  // end of test1
+  //! \brief concurrent evaluations of a reentrant evaluator
+  void test2() {
+    auto e = tfel::math::Evaluator("x>0.5 ? exp(x)*y : sin(x)-y");
+    e.compile();
+    TFEL_TESTS_ASSERT(e.isReentrant());
+    this->check(e);
+  }  // end of test2
+  //! \brief concurrent evaluations of an evaluator calling external
+  //! functions
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::parser;
+    auto m = std::make_shared<ExternalFunctionManager>();
+    const auto vars = std::vector<std::string>(1, "x");
+    m->operator[]("f") = std::make_shared<Evaluator>(vars, "exp(x)", m);
+    auto e = Evaluator("x>0.5 ? f(x)*y : sin(x)-y", m);
+    e.compile();
+    TFEL_TESTS_ASSERT(!e.isReentrant());
+    this->check(e);
+  }  // end of test3
+  /*!
+   * \brief evaluate the given evaluator concurrently and compare the
+   * results to the expected ones
+   * \param[in] e: evaluator
+   */
+  void check(const tfel::math::Evaluator& e) {
+    auto success = std::vector<int>(nthreads, 1);
+    auto threads = std::vector<std::thread>{};
+    for (int t = 0; t != nthreads; ++t) {
+      threads.emplace_back([&e, &success, t] {
+        auto c = e.makeEvaluationContext();
+        for (int i = 0; i != nevaluations; ++i) {
+          const auto x = (t + 1) * 0.1 + i * 1e-5;
+          const auto y = double(i);
+          e.setVariableValue(c, "x", x);
+          e.setVariableValue(c, "y", y);
+          const auto r = x > 0.5 ? std::exp(x) * y : std::sin(x) - y;
+          if (std::abs(e.getValue(c) - r) > 1e-12 * (1 + std::abs(r))) {
+            success[t] = 0;
+          }
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (const auto s : success) {
+      TFEL_TESTS_ASSERT(s == 1);
+    }
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest15, "ParserTest15");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser15.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
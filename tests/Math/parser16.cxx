@@ -0,0 +1,156 @@
+/*!
+ * \file   tests/Math/parser16.cxx
+ * \brief  This file tests the simplification of compiled expressions and
+ * the evaluation of the gradient of formulae
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+#include "TFEL/Math/Parser/Bytecode.hxx"
+
+struct ParserTest16 final : public tfel::tests::TestCase {
+  ParserTest16()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest16") {
+  }  // end of ParserTest16
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief removal of neutral elements
+  void test1() {
+    using tfel::math::parser::Bytecode;
+    const auto v = std::vector<double>{2, 3};
+    // 1*(x*1+0)/1
+    auto b = Bytecode(v);
+    b.addNumber(1);
+    b.addVariable(0);
+    b.addNumber(1);
+    b.addMultiplication();
+    b.addNumber(0);
+    b.addAddition();
+    b.addMultiplication();
+    b.addNumber(1);
+    b.addDivision();
+    TFEL_TESTS_ASSERT(b.size() == 1);
+    TFEL_TESTS_ASSERT(std::abs(b.execute(v.data()) - 2) < 1e-14);
+    // 0-(-(-y))*(-1)
+    auto b2 = Bytecode(v);
+    b2.addNumber(0);
+    b2.addVariable(1);
+    b2.addNegation();
+    b2.addNegation();
+    b2.addNumber(-1);
+    b2.addMultiplication();
+    b2.addSubtraction();
+    TFEL_TESTS_ASSERT(b2.size() == 1);
+    TFEL_TESTS_ASSERT(std::abs(b2.execute(v.data()) - 3) < 1e-14);
+  }  // end of test1
+  //! \brief sharing of identical sub-programs
+  void test2() {
+    using tfel::math::parser::Bytecode;
+    const auto v = std::vector<double>{2, 3};
+    // exp(x*y)*exp(x*y)
+    auto b = Bytecode(v);
+    for (int i = 0; i != 2; ++i) {
+      b.addVariable(0);
+      b.addVariable(1);
+      b.addMultiplication();
+      b.addStandardFunction(std::exp);
+    }
+    b.addMultiplication();
+    // x*y, exp, save, load, multiplication
+    TFEL_TESTS_ASSERT(b.size() == 7);
+    TFEL_TESTS_ASSERT(
+        std::abs(b.execute(v.data()) - std::exp(12)) < 1e-14 * std::exp(12));
+    // sub-programs can be shared between several results
+    auto b2 = Bytecode(v);
+    for (int i = 0; i != 2; ++i) {
+      b2.addVariable(0);
+      b2.addVariable(1);
+      b2.addMultiplication();
+      b2.addStandardFunction(std::sin);
+    }
+    TFEL_TESTS_ASSERT(b2.getNumberOfResults() == 2);
+    TFEL_TESTS_ASSERT(b2.size() == 6);
+    double r[2];
+    b2.execute(r, v.data());
+    TFEL_TESTS_ASSERT(std::abs(r[0] - std::sin(6)) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(r[1] - std::sin(6)) < 1e-14);
+  }  // end of test2
+  //! \brief sub-programs in conditional expressions are not shared
+  void test3() {
+    const auto vars = std::vector<std::string>{"x", "y"};
+    const auto f = "x>0 ? exp(x*y)*exp(x*y) : log(-x*y)*exp(x*y)+exp(x*y)";
+    auto e = tfel::math::Evaluator(vars, f);
+    auto ce = tfel::math::Evaluator(vars, f);
+    ce.compile();
+    for (const auto x : {-1.5, 0.5, 2.}) {
+      e.setVariableValue("x", x);
+      e.setVariableValue("y", 0.5);
+      ce.setVariableValue("x", x);
+      ce.setVariableValue("y", 0.5);
+      TFEL_TESTS_ASSERT(std::abs(e.getValue() - ce.getValue()) < 1e-12);
+    }
+  }  // end of test3
+  //! \brief evaluation of the value and the gradient of a formula
+  void test4() {
+    using size_type = std::vector<double>::size_type;
+    const auto vars = std::vector<std::string>{"x", "a", "b"};
+    const auto f = "a*exp(-b*x)*sin(a*exp(-b*x))+power<2>(a*exp(-b*x))";
+    auto e = tfel::math::Evaluator(vars, f);
+    const auto dea = e.differentiate("a");
+    const auto deb = e.differentiate("b");
+    const auto values = std::vector<std::vector<double>>{
+        {0.5, 1.2, 0.3}, {1.5, -0.2, 1.3}, {0, 2, 4}};
+    for (const auto& v : values) {
+      for (size_type i = 0; i != v.size(); ++i) {
+        e.setVariableValue(i, v[i]);
+        dea->setVariableValue(i, v[i]);
+        deb->setVariableValue(i, v[i]);
+      }
+      double g[2];
+      const auto r = e.getValueAndGradient(g, {1, 2});
+      TFEL_TESTS_ASSERT(std::abs(r - e.getValue()) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(g[0] - dea->getValue()) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(g[1] - deb->getValue()) < 1e-12);
+    }
+    TFEL_TESTS_CHECK_THROW(e.getValueAndGradient(nullptr, {3}),
+                           std::runtime_error);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest16, "ParserTest16");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser16.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,115 @@
+/*!
+ * \file   tests/System/ExternalLibraryManagerTest.cxx
+ * \brief  This test queries the external library manager concurrently
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryIndex.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the test library
+static std::string library =
+    ".libs/libExternalLibraryManagerTestLibrary.so";
+
+struct ExternalLibraryManagerTest final : public tfel::tests::TestCase {
+  ExternalLibraryManagerTest()
+      : tfel::tests::TestCase("TFEL/System", "ExternalLibraryManagerTest") {
+  }  // end of ExternalLibraryManagerTest
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryIndex;
+    constexpr auto nthreads = std::size_t{16};
+    constexpr auto niterations = std::size_t{500};
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    std::atomic<std::size_t> failures(0);
+    std::vector<tfel::system::CFunction1Ptr> square(nthreads, nullptr);
+    std::vector<tfel::system::CFunction1Ptr> cube(nthreads, nullptr);
+    auto check = [&failures](const bool b) {
+      if (!b) {
+        ++failures;
+      }
+    };
+    auto task = [&](const std::size_t t) {
+      try {
+        for (std::size_t i = 0; i != niterations; ++i) {
+          // the library is loaded concurrently by the first iterations
+          auto e = elm.getEntryPoints(library);
+          std::sort(e.begin(), e.end());
+          check(e == std::vector<std::string>{"Cube", "Square"});
+          for (const auto& f : e) {
+            check(elm.getMaterialKnowledgeType(library, f) == 0u);
+            check(elm.getInterface(library, f) == "C");
+            check(elm.getAuthor(library, f) == "Thomas Helfer");
+            check(elm.getMaterialPropertyVariables(library, f) ==
+                  std::vector<std::string>{"x"});
+          }
+          // undefined symbols are also cached
+          check(!elm.contains(library, "Square_" + std::to_string(i % 50)));
+          check(ExternalLibraryIndex::getLastLookupError().find(
+                    "'Square_" + std::to_string(i % 50) + "'") !=
+                std::string::npos);
+          const auto fs = elm.getCFunction1(library, "Square");
+          const auto fc = elm.getCFunction1(library, "Cube");
+          // the error of the previous lookup is cleared
+          check(ExternalLibraryIndex::getLastLookupError().empty());
+          if (i == 0) {
+            square[t] = fs;
+            cube[t] = fc;
+          }
+          check((fs == square[t]) && (fc == cube[t]));
+          check(std::abs(fs(2.) - 4.) < 1.e-14);
+          check(std::abs(fc(2.) - 8.) < 1.e-14);
+        }
+      } catch (...) {
+        ++failures;
+      }
+    };
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t t = 0; t != nthreads; ++t) {
+      threads.emplace_back(task, t);
+    }
+    for (auto& th : threads) {
+      th.join();
+    }
+    TFEL_TESTS_ASSERT(failures == 0);
+    // all the threads shall have retrieved the same function pointers
+    TFEL_TESTS_ASSERT(std::count(square.begin(), square.end(), square[0]) ==
+                      static_cast<std::ptrdiff_t>(nthreads));
+    TFEL_TESTS_ASSERT(std::count(cube.begin(), cube.end(), cube[0]) ==
+                      static_cast<std::ptrdiff_t>(nthreads));
+    TFEL_TESTS_ASSERT(square[0] != nullptr);
+    TFEL_TESTS_ASSERT(cube[0] != nullptr);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(ExternalLibraryManagerTest,
+                          "ExternalLibraryManagerTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc == 2) {
+    library = argv[1];
+  }
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ExternalLibraryManagerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
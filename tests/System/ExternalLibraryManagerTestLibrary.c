@@ -0,0 +1,31 @@
+/*!
+ * \file   tests/System/ExternalLibraryManagerTestLibrary.c
+ * \brief  a library mimicking the symbols generated by MFront for two
+ * material properties.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+const char* Square_mfront_ept = "Square";
+unsigned short Square_mfront_mkt = 0u;
+const char* Square_mfront_interface = "C";
+const char* Square_author = "Thomas Helfer";
+unsigned short Square_nargs = 1u;
+const char* Square_args[1u] = {"x"};
+
+double Square(const double x) { return x * x; }
+
+const char* Cube_mfront_ept = "Cube";
+unsigned short Cube_mfront_mkt = 0u;
+const char* Cube_mfront_interface = "C";
+const char* Cube_author = "Thomas Helfer";
+unsigned short Cube_nargs = 1u;
+const char* Cube_args[1u] = {"x"};
+
+double Cube(const double x) { return x * x * x; }
@@ -0,0 +1,119 @@
+/*!
+ * \file  tests/Utilities/BinaryDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+#include "TFEL/Utilities/BinaryDataWriter.hxx"
+
+struct BinaryDataTest final : public tfel::tests::TestCase {
+  BinaryDataTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "BinaryDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  // values are written and read without conversion
+  static bool check(const double v, const double e) {
+    return std::abs(v - e) <= 0;
+  }  // end of check
+  void test1() {
+    // the buffers are smaller than the number of rows, so that they are
+    // exchanged many times
+    constexpr auto n = std::size_t{1000};
+    {
+      auto w = tfel::utilities::BinaryDataWriter("BinaryDataTest-1.bin",
+                                                 {"time", "x", "y (mm)"}, 7);
+      TFEL_TESTS_ASSERT(w.getNumberOfColumns() == 3);
+      for (std::size_t i = 0; i != n; ++i) {
+        const double v[2] = {2 * static_cast<double>(i),
+                             -static_cast<double>(i) / 3};
+        w.write(static_cast<double>(i));
+        w.write(v, v + 2);
+      }
+      w.flush();
+      // the file is complete after flushing
+      const auto d = tfel::utilities::BinaryData("BinaryDataTest-1.bin");
+      TFEL_TESTS_ASSERT(d.getNumberOfRows() == n);
+    }
+    TFEL_TESTS_ASSERT(
+        tfel::utilities::BinaryData::isBinaryDataFile("BinaryDataTest-1.bin"));
+    const auto d = tfel::utilities::BinaryData("BinaryDataTest-1.bin");
+    TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 3);
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == n);
+    TFEL_TESTS_ASSERT(d.getLegend(3) == "y (mm)");
+    TFEL_TESTS_ASSERT(d.findColumn("x") == 2);
+    TFEL_TESTS_CHECK_THROW(d.findColumn("z"), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumnView(0), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumnView(4), std::runtime_error);
+    const auto t = d.getColumnView(1);
+    const auto x = d.getColumnView(2);
+    const auto y = d.getColumn(3);
+    TFEL_TESTS_ASSERT(x.stride == 3);
+    TFEL_TESTS_ASSERT(x.values == d.data() + 1);
+    TFEL_TESTS_ASSERT((t.size() == n) && (y.size() == n));
+    auto ok = true;
+    for (std::size_t i = 0; i != n; ++i) {
+      ok = ok && check(t[i], static_cast<double>(i));
+      ok = ok && check(x[i], 2 * static_cast<double>(i));
+      ok = ok && check(y[i], -static_cast<double>(i) / 3);
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of test1
+  void test2() {
+    // an incomplete last row is ignored
+    {
+      auto w = tfel::utilities::BinaryDataWriter("BinaryDataTest-2.bin",
+                                                 {"a", "b"});
+      const double v[5] = {1, 2, 3, 4, 5};
+      w.write(v, v + 5);
+    }
+    const auto d = tfel::utilities::BinaryData("BinaryDataTest-2.bin");
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == 2);
+    const auto b = d.getColumn(2);
+    TFEL_TESTS_ASSERT((b.size() == 2) && check(b[0], 2) && check(b[1], 4));
+  }  // end of test2
+  void test3() {
+    // text files are rejected
+    {
+      std::ofstream f("BinaryDataTest-3.txt");
+      f << "# time x\n0 1\n";
+    }
+    TFEL_TESTS_ASSERT(
+        !tfel::utilities::BinaryData::isBinaryDataFile("BinaryDataTest-3.txt"));
+    TFEL_TESTS_CHECK_THROW(tfel::utilities::BinaryData("BinaryDataTest-3.txt"),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(tfel::utilities::BinaryData("BinaryDataTest-4.bin"),
+                           std::runtime_error);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(BinaryDataTest, "BinaryDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BinaryDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
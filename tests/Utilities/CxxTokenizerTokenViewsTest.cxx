@@ -0,0 +1,175 @@
+/*!
+ * \file   CxxTokenizerTokenViewsTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <string>
+#include <string_view>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+
+struct CxxTokenizerTokenViewsTest final : public tfel::tests::TestCase {
+  CxxTokenizerTokenViewsTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "CxxTokenizerTokenViewsTest") {
+  }  // end of CxxTokenizerTokenViewsTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief a sample of C++-like code
+  static std::string getSample() {
+    return "/*!\n"
+           " * a multi-line comment\n"
+           " */\n"
+           "@Parameter real a = 1.e-3; //!< a parameter\n"
+           "@Evolution<function> \"T\" {0 : 293.15, 1 : 1293.15};\n"
+           "std::cout << \"a\" \"b\" << '\\n';\n"
+           "auto s = R\"(a raw string)\";\n";
+  }  // end of getSample
+  //! \brief compare the tokens produced in both modes
+  void test1() {
+    using tfel::utilities::CxxTokenizer;
+    auto check = [this](const bool b) {
+      CxxTokenizer t1;
+      CxxTokenizer t2;
+      t2.produceTokenViews(true);
+      for (auto* const t : {&t1, &t2}) {
+        t->mergeStrings(b);
+        t->parseString(getSample());
+        t->stripComments();
+      }
+      const auto& views = t2.getTokenViews();
+      TFEL_TESTS_ASSERT(t2.empty());
+      TFEL_TESTS_ASSERT(t1.size() == views.size());
+      if (t1.size() != views.size()) {
+        return;
+      }
+      for (CxxTokenizer::size_type i = 0; i != t1.size(); ++i) {
+        TFEL_TESTS_ASSERT(t1[i].value == views[i].value());
+        TFEL_TESTS_ASSERT(t1[i].line == views[i].line);
+        TFEL_TESTS_ASSERT(t1[i].offset == views[i].offset);
+        TFEL_TESTS_ASSERT(t1[i].flag == views[i].flag);
+        TFEL_TESTS_ASSERT(t1[i].comment == views[i].comment);
+      }
+    };
+    check(false);
+    check(true);
+  }  // end of test1
+  //! \brief only modified tokens own their values
+  void test2() {
+    using tfel::utilities::CxxTokenizer;
+    CxxTokenizer t;
+    t.produceTokenViews(true);
+    t.mergeStrings(true);
+    t.parseString("a = \"b\" \"c\"; /* a\nb*/");
+    const auto& views = t.getTokenViews();
+    TFEL_TESTS_ASSERT(views.size() == 5u);
+    if (views.size() != 5u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(views[0].value() == "a");
+    TFEL_TESTS_ASSERT(!views[0].ownsValue());
+    TFEL_TESTS_ASSERT(views[1].value() == "=");
+    TFEL_TESTS_ASSERT(!views[1].ownsValue());
+    TFEL_TESTS_ASSERT(views[2].value() == "\"bc\"");
+    TFEL_TESTS_ASSERT(views[2].ownsValue());
+    TFEL_TESTS_ASSERT(views[3].value() == ";");
+    TFEL_TESTS_ASSERT(!views[3].ownsValue());
+    TFEL_TESTS_ASSERT(views[4].value() == "a\nb");
+    TFEL_TESTS_ASSERT(views[4].ownsValue());
+  }  // end of test2
+  //! \brief the views remain valid in a copy of the tokenizer
+  void test3() {
+    using tfel::utilities::CxxTokenizer;
+    {
+      std::ofstream f("CxxTokenizerTokenViewsTest.txt");
+      if (!f) {
+        tfel::raise(
+            "CxxTokenizerTokenViewsTest::test3: "
+            "can't open file 'CxxTokenizerTokenViewsTest.txt'");
+      }
+      f << getSample();
+    }
+    auto t2 = [] {
+      CxxTokenizer t;
+      t.produceTokenViews(true);
+      t.openFile("CxxTokenizerTokenViewsTest.txt");
+      auto r = t;
+      t.clear();
+      return r;
+    }();
+    CxxTokenizer t1;
+    t1.openFile("CxxTokenizerTokenViewsTest.txt");
+    const auto& views = t2.getTokenViews();
+    TFEL_TESTS_ASSERT(t1.size() == views.size());
+    if (t1.size() != views.size()) {
+      return;
+    }
+    for (CxxTokenizer::size_type i = 0; i != t1.size(); ++i) {
+      TFEL_TESTS_ASSERT(t1[i].value == views[i].value());
+    }
+  }  // end of test3
+  //! \brief the views refer directly to the string given to
+  //! `parseStringView`
+  void test4() {
+    using tfel::utilities::CxxTokenizer;
+    const auto s = std::string{"1 'a b' 2 /* c */\n3 4"};
+    const auto b = std::string_view{s};
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.produceTokenViews(true);
+    t.parseStringView(b.substr(0, 17));
+    t.stripComments();
+    const auto& views = t.getTokenViews();
+    TFEL_TESTS_ASSERT(views.size() == 3u);
+    if (views.size() != 3u) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(views[1].value() == "'a b'");
+    TFEL_TESTS_ASSERT(views[1].value().data() == s.data() + 2);
+    // the tokenizer can be reused for another part of the string
+    t.clear();
+    t.parseStringView(b.substr(18));
+    TFEL_TESTS_ASSERT(t.getTokenViews().size() == 2u);
+    if (t.getTokenViews().size() == 2u) {
+      TFEL_TESTS_ASSERT(t.getTokenViews()[1].value().data() ==
+                        s.data() + 20);
+    }
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(CxxTokenizerTokenViewsTest,
+                          "CxxTokenizerTokenViewsTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("CxxTokenizerTokenViewsTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,115 @@
+/*!
+ * \file  tests/Utilities/TextDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest() : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  static bool check(const std::vector<double>& values,
+                    const std::vector<double>& expected) {
+    if (values.size() != expected.size()) {
+      return false;
+    }
+    for (std::vector<double>::size_type i = 0; i != values.size(); ++i) {
+      if (std::abs(values[i] - expected[i]) > 1e-14 * std::abs(expected[i])) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of check
+  void test1() {
+    // purely numerical file, with legends and a preamble
+    {
+      std::ofstream f("TextDataTest-1.txt");
+      f << "# time 'x' y\n"
+        << "# preamble\n"
+        << "0 1.5 -2\n"
+        << "\n"
+        << "1\t-.5e-3 +3\r\n"
+        << "2  1.e2 4";
+    }
+    const auto d = tfel::utilities::TextData("TextDataTest-1.txt");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3);
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2);
+    TFEL_TESTS_ASSERT(d.findColumn("x") == 2);
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1, 2}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {1.5, -0.5e-3, 1.e2}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(3), {-2, 3, 4}));
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    TFEL_TESTS_ASSERT(d.end() - d.begin() == 3);
+    TFEL_TESTS_ASSERT(d.begin()->tokens.size() == 3);
+  }  // end of test1
+  void test2() {
+    // lines which are not purely numerical are handled by the tokenizer
+    {
+      std::ofstream f("TextDataTest-2.txt");
+      f << "1 'a b' 2\n"
+        << "3 /* comment */ 4 5 // comment\n"
+        << "inf 6 7\n";
+    }
+    const auto d = tfel::utilities::TextData("TextDataTest-2.txt");
+    const auto c1 = d.getColumn(1);
+    TFEL_TESTS_ASSERT(c1.size() == 3);
+    if (c1.size() == 3) {
+      TFEL_TESTS_ASSERT(std::abs(c1[0] - 1) < 1e-14);
+      TFEL_TESTS_ASSERT(std::abs(c1[1] - 3) < 1e-14);
+      TFEL_TESTS_ASSERT(std::isinf(c1[2]));
+    }
+    // the second column of the first line is a string
+    TFEL_TESTS_CHECK_THROW(d.getColumn(2), std::exception);
+    TFEL_TESTS_ASSERT(d.begin()->tokens.size() == 3);
+    auto d2 = tfel::utilities::TextData("TextDataTest-2.txt");
+    d2.skipLines(1);
+    TFEL_TESTS_ASSERT(check(d2.getColumn(2), {6}));
+    TFEL_TESTS_ASSERT(check(d2.getColumn(3), {7}));
+  }  // end of test2
+  void test3() {
+    // gnuplot format
+    {
+      std::ofstream f("TextDataTest-3.txt");
+      f << "t v\n"
+        << "0 1\n"
+        << "1 2\n";
+    }
+    const auto d = tfel::utilities::TextData("TextDataTest-3.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.findColumn("v") == 2);
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {1, 2}));
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TextDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
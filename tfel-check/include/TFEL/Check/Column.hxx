@@ -56,10 +56,24 @@ namespace tfel::check {
      * \brief set the value at position i in the values vector
      */
     void setValue(unsigned pos, double value);
+    /*!
+     * \brief set all the values
+     * \param[in] v: values
+     */
+    void setValues(std::vector<double>);
     /*!
      * \brief returns the filename
      */
     void setFilename(std::string);
+    /*!
+     * \brief set the filename and the data read from this file. This
+     * method allows sharing the data between columns extracted from the
+     * same file, so that the file is read only once.
+     * \param[in] f: file name
+     * \param[in] d: data read from the file
+     */
+    void setData(std::string,
+                 const std::shared_ptr<tfel::utilities::TextData>&);
     /*!
      * \brief returns the filename
      */
@@ -18,6 +18,8 @@
 
 #include <cmath>
 #include <string>
+#include <vector>
+#include <cstddef>
 
 #include "TFEL/Check/TFELCheckConfig.hxx"
 #include "TFEL/Check/Column.hxx"
@@ -67,6 +69,77 @@ namespace tfel::check {
     virtual ~Comparison();
 
    protected:
+    //! \brief statistics on the errors computed by a comparison
+    struct ErrorStatistics {
+      //! \brief maximum error
+      double maximum;
+      /*!
+       * \brief position of the first occurence of the maximum error, or
+       * the number of errors if no error is greater than the initial value
+       * of the maximum error.
+       */
+      std::size_t position;
+      //! \brief number of errors greater than the threshold
+      std::size_t failures;
+    };
+    /*!
+     * \return statistics on the errors between two arrays of values
+     * \param[in] a: first array of values
+     * \param[in] b: second array of values
+     * \param[in] n: number of values
+     * \param[in] m0: initial value of the maximum error
+     * \param[in] t: threshold
+     * \param[in] f: function returning the error between two values
+     *
+     * The errors are recomputed by each pass rather than stored in a
+     * temporary array. The number of failures and the maximum error are
+     * computed by two separate passes, the maximum being accumulated over
+     * four independent lanes, so that both passes can be vectorized without
+     * relaxing the floating-point semantics. The position of the maximum is
+     * only searched if the maximum is greater than `m0`.
+     *
+     * \note NaN errors are neither counted as failures nor taken into
+     * account by the maximum, as in the original element-wise comparisons.
+     */
+    template <typename ErrorFunction>
+    static ErrorStatistics analyseErrors(const double* const a,
+                                         const double* const b,
+                                         const std::size_t n,
+                                         const double m0,
+                                         const double t,
+                                         const ErrorFunction& f) {
+      auto c = std::size_t{};
+      for (std::size_t i = 0; i != n; ++i) {
+        c += (f(a[i], b[i]) > t) ? 1 : 0;
+      }
+      // comparisons with NaN are false, so NaN errors are discarded
+      constexpr auto N = std::size_t{4};
+      double lanes[N] = {m0, m0, m0, m0};
+      auto i = std::size_t{};
+      for (; i + N <= n; i += N) {
+        for (std::size_t k = 0; k != N; ++k) {
+          const auto e = f(a[i + k], b[i + k]);
+          lanes[k] = (lanes[k] < e) ? e : lanes[k];
+        }
+      }
+      auto m = m0;
+      for (std::size_t k = 0; k != N; ++k) {
+        m = (m < lanes[k]) ? lanes[k] : m;
+      }
+      for (; i != n; ++i) {
+        const auto e = f(a[i], b[i]);
+        m = (m < e) ? e : m;
+      }
+      auto p = n;
+      if (m0 < m) {
+        for (p = 0; p != n; ++p) {
+          if (f(a[p], b[p]) == m) {
+            break;
+          }
+        }
+      }
+      return {m, p, c};
+    }  // end of analyseErrors
     bool success; /**!< current Comparison success indicator */
     std::string msgLog;
     std::shared_ptr<Column>
@@ -48,6 +48,17 @@ namespace tfel::check {
      * \return value at time in parameter
      */
     virtual double getValue(const double) const = 0;
+    /*!
+     * \brief returns the values at the given times
+     *
+     * \param[in] x: times
+     * \return the values at the given times
+     *
+     * \note the default implementation calls the `getValue` method for
+     * each time. Derived classes may take advantage of sorted times to
+     * compute the values in a single sweep.
+     */
+    virtual std::vector<double> getValues(const std::vector<double>&) const;
 
     /*!
      * \brief returns the type of interpolation
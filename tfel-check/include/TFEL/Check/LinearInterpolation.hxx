@@ -35,6 +35,7 @@ namespace tfel::check {
     void interpolate(const std::vector<double>&,
                      const std::vector<double>&) override;
     double getValue(const double) const override;
+    std::vector<double> getValues(const std::vector<double>&) const override;
     std::string getType() const override;
     bool isConform() const override;
     std::shared_ptr<Interpolation> clone() const override;
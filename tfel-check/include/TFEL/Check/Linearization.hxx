@@ -18,7 +18,6 @@
 #ifndef LIB_TFELCHECK_LINEARIZATION_HXX
 #define LIB_TFELCHECK_LINEARIZATION_HXX
 
-#include <map>
 #include <vector>
 #include "TFEL/Check/TFELCheckConfig.hxx"
 
@@ -46,6 +45,14 @@ namespace tfel::check {
      * \return the value at time in parameter
      */
     double operator()(const double x) const;
+    /*!
+     * \return the values at the given times
+     * \param[in] x: times
+     *
+     * \note if the times are sorted, the values are computed in a single
+     * sweep over the times of the linearization.
+     */
+    std::vector<double> operator()(const std::vector<double>&) const;
 
     /*!
      * \return true if the evolution
@@ -54,7 +61,10 @@ namespace tfel::check {
     bool isConstant() const;
 
    private:
-    std::map<double, double> values; /*< the times and values */
+    //! \brief the times, sorted in increasing order
+    std::vector<double> times;
+    //! \brief the values associated with the times
+    std::vector<double> values;
   };
 
 }  // end of namespace tfel::check
@@ -0,0 +1,61 @@
+/*!
+ * \file   tfel-check/include/TFEL/Check/PCRecordDriver.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFELCHECK_PCRECORDDRIVER_HXX
+#define LIB_TFELCHECK_PCRECORDDRIVER_HXX
+
+#include <string>
+#include "TFEL/Check/TFELCheckConfig.hxx"
+#include "TFEL/Check/PCILogDriver.hxx"
+
+namespace tfel::check {
+
+  // forward declaration
+  struct PCLogger;
+
+  /*!
+   * \brief a driver which records the events in a file, so that they can
+   * be replayed later by another logger, possibly in another process.
+   *
+   * Each event is flushed immediately, so that the events recorded
+   * before an abnormal termination of the process can still be replayed.
+   */
+  struct TFELCHECK_VISIBILITY_EXPORT PCRecordDriver : public PCILogDriver {
+    /*!
+     * \brief replay the events stored in a file
+     * \param[out] l: logger
+     * \param[in] f: file name
+     * \return true if the end of the file has been reached without
+     * encountering an incomplete or invalid event.
+     */
+    static bool replay(PCLogger&, const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file in which the events are recorded
+     */
+    PCRecordDriver(const std::string&);
+    void addMessage(const std::string&) override;
+    void reportSkippedTest(const std::string&) override;
+    void addTestResult(const std::string&,
+                       const std::string&,
+                       const std::string&,
+                       const float,
+                       bool,
+                       const std::string& = "") override;
+    //! destructor
+    ~PCRecordDriver() override;
+  };  // end of struct PCRecordDriver
+
+}  // end of namespace tfel::check
+
+#endif /* LIB_TFELCHECK_PCRECORDDRIVER_HXX */
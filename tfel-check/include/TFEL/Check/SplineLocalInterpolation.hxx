@@ -22,7 +22,7 @@
 #ifndef LIB_TFELCHECK_SPLINELOCALINTERPOLATION_HXX
 #define LIB_TFELCHECK_SPLINELOCALINTERPOLATION_HXX
 
-#include <map>
+#include <vector>
 #include "TFEL/Check/TFELCheckConfig.hxx"
 #include "TFEL/Math/CubicSpline.hxx"
 #include "TFEL/Check/Interpolation.hxx"
@@ -44,6 +44,7 @@ namespace tfel::check {
     void interpolate(const std::vector<double>&,
                      const std::vector<double>&) override;
     double getValue(const double) const override;
+    std::vector<double> getValues(const std::vector<double>&) const override;
     std::string getType() const override;
     bool isConform() const override;
     std::shared_ptr<Interpolation> clone() const override;
@@ -51,7 +52,8 @@ namespace tfel::check {
     ~SplineLocalInterpolation() override;
 
    private:
-    std::map<double, tfel::math::CubicSpline<double>> splines;
+    //! \brief splines associated with the first times of each group
+    std::vector<tfel::math::CubicSpline<double>> splines;
     std::vector<double> timesBefore; /**< vector containing the first times of
                                         each group of 3 times **/
   };
@@ -14,6 +14,7 @@
 #include <cmath>
 #include <vector>
 #include <cstdlib>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Check/AbsoluteComparison.hxx"
 
 namespace tfel::check {
@@ -24,29 +25,25 @@ namespace tfel::check {
 
   void AbsoluteComparison::compare() {
     using namespace std;
-    unsigned int errorLineNumber = 0;
-    unsigned int errorLinesCount = 0;
     float errorLinesPercent = 0.;
-    double absoluteError;
-    double maxAbsoluteError = 0.;
     unsigned int lineOffset =
         (!this->c2->getData()->getLegends().empty()) ? 2u : 1u;
     this->msgLog += '\n';
-
-    bool s = true;
-    for (vector<double>::size_type idx = 0; idx != this->c1->getValues().size();
-         ++idx) {
-      absoluteError =
-          std::abs(this->c1->getValues()[idx] - this->c2->getValues()[idx]);
-      if (maxAbsoluteError < absoluteError) {
-        maxAbsoluteError = absoluteError;
-        errorLineNumber = idx + lineOffset;
-      }
-      if (absoluteError > this->prec) {
-        s = false;
-        errorLinesCount++;
-      }
-    }
+    const auto& va = this->c1->getValues();
+    const auto& vb = this->c2->getValues();
+    raise_if(vb.size() < va.size(),
+             "AbsoluteComparison::compare: "
+             "the columns don't have the same size");
+    const auto* const a = va.data();
+    const auto* const b = vb.data();
+    const auto stats = Comparison::analyseErrors(
+        a, b, va.size(), 0, this->prec,
+        [](const double x, const double y) { return std::abs(x - y); });
+    const auto maxAbsoluteError = stats.maximum;
+    const auto errorLinesCount = stats.failures;
+    const auto errorLineNumber =
+        (stats.position != va.size()) ? stats.position + lineOffset : 0;
+    const auto s = errorLinesCount == 0;
 
     if (!s) {
       this->msgLog += "*** ";
@@ -21,12 +21,11 @@ namespace tfel::check {
 
   static double trapezoidalIntegration(const std::vector<double>& abscissas,
                                        const std::vector<double>& ordinates) {
+    const auto* const x = abscissas.data();
+    const auto* const y = ordinates.data();
     double result = 0;
-    for (std::vector<double>::size_type i = 0; i < (abscissas.size() - 1);
-         ++i) {
-      double absInter = abscissas.at(i + 1) - abscissas.at(i);
-      double ordInter = ordinates.at(i + 1) + ordinates.at(i);
-      result += ((absInter * ordInter) / 2);
+    for (std::vector<double>::size_type i = 1; i < abscissas.size(); ++i) {
+      result += (x[i] - x[i - 1]) * (y[i] + y[i - 1]) / 2;
     }
     return result;
   }
@@ -37,98 +36,85 @@ namespace tfel::check {
 
   void AreaComparison::compare() {
     using size_type = std::vector<double>::size_type;
-    // interpolation before integration
-    auto colInterpolatedTmpA =
+    // abscissa columns, sharing the data of the compared columns
+    auto colInterpolatedA =
         std::make_shared<Column>(*(this->colIntegralInterpolated));
-    auto colInterpolatedA(
-        colInterpolatedTmpA); /**!< abscissa column for .ref */
-
-    auto colInterpolatedTmpB =
+    auto colInterpolatedB =
         std::make_shared<Column>(*(this->colIntegralInterpolated));
-    std::shared_ptr<Column> colInterpolatedB(
-        colInterpolatedTmpB); /**!< abscissa column for .res */
-
-    colInterpolatedA->setFilename(this->c1->getFilename());
-    colInterpolatedB->setFilename(this->c2->getFilename());
-
-    std::vector<double> valA(this->c1->getValues());
-    std::vector<double> valB(this->c2->getValues());
-    std::vector<double> timesA(colInterpolatedA->getValues());
-    std::vector<double> timesB(colInterpolatedB->getValues());
-
-    this->integralInterpolation->interpolate(timesB, valB);
-
-    // interpolation of the column B
-    for (size_type i = 0; i < timesA.size(); ++i) {
-      for (size_type j = 0;
-           (j < timesB.size()) && (timesA.at(i) != timesB.at(j)); ++j) {
-        if (timesA.at(i) < timesB.at(j)) {  // if time from c1 not found in c2
-          timesB.insert(timesB.begin() + j,
-                        timesA.at(i));  // insert this time in times of c2
-          valB.insert(
-              valB.begin() + j,
-              this->integralInterpolation->getValue(timesB.at(
-                  j)));  // and insert the interpolated value at this time
-          break;
-        } else if ((j == (timesB.size() - 1)) &&
-                   (timesA.at(i) >
-                    timesB.at(
-                        j))) {  // if value needs to be inserted at the end
-          timesB.insert(timesB.end(),
-                        timesA.at(i));  // insert this time in times of c2
-          valB.insert(
-              valB.end(),
-              this->integralInterpolation->getValue(timesB.at(
-                  j)));  // and insert the interpolated value at this time
-          break;
-        }
+    colInterpolatedA->setData(this->c1->getFilename(), this->c1->getData());
+    colInterpolatedB->setData(this->c2->getFilename(), this->c2->getData());
+    const auto& a = this->c1->getValues();
+    const auto& b = this->c2->getValues();
+    const auto& ta = colInterpolatedA->getValues();
+    const auto& tb = colInterpolatedB->getValues();
+    // merging the abscissas of both columns in a single sweep. The values
+    // at abscissas missing in one of the columns are interpolated.
+    std::vector<double> times;
+    std::vector<double> valA;
+    std::vector<double> valB;
+    std::vector<size_type> missingA;
+    std::vector<size_type> missingB;
+    times.reserve(ta.size() + tb.size());
+    valA.reserve(ta.size() + tb.size());
+    valB.reserve(ta.size() + tb.size());
+    auto i = size_type{};
+    auto j = size_type{};
+    while ((i != ta.size()) || (j != tb.size())) {
+      if ((j == tb.size()) || ((i != ta.size()) && (ta[i] < tb[j]))) {
+        missingB.push_back(times.size());
+        times.push_back(ta[i]);
+        valA.push_back(a.at(i));
+        valB.push_back(0);
+        ++i;
+      } else if ((i == ta.size()) || (tb[j] < ta[i])) {
+        missingA.push_back(times.size());
+        times.push_back(tb[j]);
+        valA.push_back(0);
+        valB.push_back(b.at(j));
+        ++j;
+      } else {
+        times.push_back(ta[i]);
+        valA.push_back(a.at(i));
+        valB.push_back(b.at(j));
+        ++i;
+        ++j;
       }
     }
-
-    this->integralInterpolation->interpolate(timesA, valA);
-
-    // interpolation of the column A
-    for (size_type i = 0; i < timesB.size(); ++i) {
-      for (size_type j = 0;
-           (j < timesA.size()) && (timesB.at(i) != timesA.at(j)); ++j) {
-        if (timesB.at(i) < timesA.at(j)) {  // if time from c1 not found in c2
-          timesA.insert(timesA.begin() + j,
-                        timesB.at(i));  // insert this time in times of c2
-          valA.insert(
-              valA.begin() + j,
-              this->integralInterpolation->getValue(timesA.at(
-                  j)));  // and insert the interpolated value at this time
-          break;
-        } else if ((j == (timesA.size() - 1)) &&
-                   (timesB.at(i) >
-                    timesA.at(
-                        j))) {  // if value needs to be inserted at the end
-          timesA.insert(timesA.end(),
-                        timesB.at(i));  // insert this time in times of c2
-          valA.insert(
-              valA.end(),
-              this->integralInterpolation->getValue(timesA.at(
-                  j)));  // and insert the interpolated value at this time
-          break;
-        }
+    auto interpolate = [this, &times](std::vector<double>& v,
+                                      const std::vector<size_type>& missing,
+                                      const std::vector<double>& t,
+                                      const std::vector<double>& values) {
+      if (missing.empty()) {
+        return;
       }
-    }
-    std::vector<double> valuesDifference;
+      auto x = std::vector<double>(missing.size());
+      for (size_type k = 0; k != missing.size(); ++k) {
+        x[k] = times[missing[k]];
+      }
+      this->integralInterpolation->interpolate(t, values);
+      const auto y = this->integralInterpolation->getValues(x);
+      for (size_type k = 0; k != missing.size(); ++k) {
+        v[missing[k]] = y[k];
+      }
+    };
+    interpolate(valB, missingB, tb, b);
+    interpolate(valA, missingA, ta, a);
+    std::vector<double> valuesDifference(valA.size());
     this->msgLog += '\n';
     bool s = true;
-    for (size_type i = 0; i != valA.size(); ++i) {
+    const auto* const pa = valA.data();
+    const auto* const pb = valB.data();
+    auto* const pd = valuesDifference.data();
+    for (size_type k = 0; k != valuesDifference.size(); ++k) {
       // make the difference between ref and res values
-      valuesDifference.push_back(std::abs(valA.at(i) - valB.at(i)));
+      pd[k] = std::abs(pa[k] - pb[k]);
     }
     // getting the value of the integral
-    double areaValue = trapezoidalIntegration(timesA, valuesDifference);
-    double maxValueA = this->c1->getValues().at(0);
-
-    for (size_type i = 0; i < this->c1->getValues().size(); ++i) {
-      // fetching the max value of the ref column
-      if (maxValueA < this->c1->getValues().at(i)) {
-        maxValueA = this->c1->getValues().at(i);
-      }
+    double areaValue = trapezoidalIntegration(times, valuesDifference);
+    // fetching the max value of the ref column
+    double maxValueA = a.at(0);
+    for (const auto v : a) {
+      maxValueA = (maxValueA < v) ? v : maxValueA;
     }
     areaValue /= maxValueA;  // divide by the max value of ref, in order to
                              // normalize the area
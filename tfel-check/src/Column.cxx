@@ -105,9 +105,21 @@ namespace tfel::check {
     this->values.at(pos) = value;
   }
 
+  void Column::setValues(std::vector<double> v) {
+    this->values = std::move(v);
+  }
+
   void Column::setFilename(std::string file) {
-    this->f = file;
-    this->data = std::make_shared<tfel::utilities::TextData>(file, "alcyone");
+    auto d = std::make_shared<tfel::utilities::TextData>(file, "alcyone");
+    this->setData(std::move(file), d);
+  }
+
+  void Column::setData(
+      std::string file,
+      const std::shared_ptr<tfel::utilities::TextData>& d) {
+    raise_if(d == nullptr, "Column::setData: invalid data");
+    this->f = std::move(file);
+    this->data = d;
     if (this->byName) {
       const auto& l = data->getLegends();
       if (std::find(l.begin(), l.end(), this->name) != l.end()) {
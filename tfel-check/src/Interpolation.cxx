@@ -20,6 +20,15 @@ namespace tfel::check {
   Interpolation::Interpolation(const Interpolation&) = default;
   Interpolation& Interpolation::operator=(Interpolation&&) = default;
   Interpolation& Interpolation::operator=(const Interpolation&) = default;
+  std::vector<double> Interpolation::getValues(
+      const std::vector<double>& x) const {
+    auto r = std::vector<double>(x.size());
+    for (std::vector<double>::size_type i = 0; i != x.size(); ++i) {
+      r[i] = this->getValue(x[i]);
+    }
+    return r;
+  }  // end of getValues
+
   Interpolation::~Interpolation() = default;
 
 }  // end of namespace tfel::check
@@ -34,6 +34,11 @@ namespace tfel::check {
     return this->linear(x);
   }
 
+  std::vector<double> LinearInterpolation::getValues(
+      const std::vector<double>& x) const {
+    return this->linear(x);
+  }
+
   std::string LinearInterpolation::getType() const { return "linear"; }
 
   bool LinearInterpolation::isConform() const { return true; }
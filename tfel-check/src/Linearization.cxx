@@ -12,7 +12,10 @@
  */
 
 #include <string>
+#include <numeric>
+#include <algorithm>
 #include <stdexcept>
+#include <functional>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Check/Linearization.hxx"
@@ -27,8 +30,28 @@ namespace tfel::check {
 
   Linearization::~Linearization() = default;
 
+  /*!
+   * \return the value at the given time
+   * \param[in] t: times
+   * \param[in] v: values
+   * \param[in] p: position of the first time greater or equal to x
+   * \param[in] x: time
+   */
+  static double interpolate(const std::vector<double>& t,
+                            const std::vector<double>& v,
+                            const std::vector<double>::size_type p,
+                            const double x) {
+    if (p == 0) {
+      return v.front();
+    } else if (p == t.size()) {
+      return v.back();
+    }
+    return (v[p] - v[p - 1]) / (t[p] - t[p - 1]) * (x - t[p - 1]) + v[p - 1];
+  }  // end of interpolate
+
   Linearization::Linearization(const std::vector<double>& t,
                                const std::vector<double>& v) {
+    using size_type = std::vector<double>::size_type;
     auto throw_if = [](const bool b, const std::string& m) {
       raise_if(b, "Linearization::Linearization: " + m);
     };
@@ -37,42 +60,67 @@ namespace tfel::check {
              "the number of values of the evolution");
     throw_if(t.empty(), "wrong number of values for the times");
     throw_if(v.empty(), "wrong number of values for the ordinates");
-    auto pX = t.begin();
-    auto pY = v.begin();
-    while (pX != t.end()) {
-      this->values.insert({*pX, *pY});
-      ++pX;
-      ++pY;
+    if (std::adjacent_find(t.begin(), t.end(), std::greater_equal<double>()) ==
+        t.end()) {
+      // times are strictly increasing, which is the usual case
+      this->times = t;
+      this->values = v;
+      return;
+    }
+    // sorting the times. For duplicated times, the first value is kept.
+    auto indexes = std::vector<size_type>(t.size());
+    std::iota(indexes.begin(), indexes.end(), size_type{});
+    std::stable_sort(indexes.begin(), indexes.end(),
+                     [&t](const size_type i, const size_type j) {
+                       return t[i] < t[j];
+                     });
+    for (const auto i : indexes) {
+      if ((this->times.empty()) || (this->times.back() < t[i])) {
+        this->times.push_back(t[i]);
+        this->values.push_back(v[i]);
+      }
     }
   }  // constructor
 
   double Linearization::operator()(const double x) const {
-    raise_if(this->values.empty(),
+    raise_if(this->times.empty(),
              "Linearization::operator(): "
              "no values specified");
-    auto p = this->values.lower_bound(x);
-    double x0;
-    double x1;
-    double y0;
-    double y1;
-    if (this->values.size() == 1u) {
-      return this->values.begin()->second;
-    }
-    if (p == this->values.begin()) {
-      return p->second;
-    } else if (p == this->values.end()) {
-      --p;
-      return p->second;
-    } else {
-      x1 = p->first;
-      y1 = p->second;
-      --p;
-      x0 = p->first;
-      y0 = p->second;
+    if (this->times.size() == 1u) {
+      return this->values.front();
     }
-    return (y1 - y0) / (x1 - x0) * (x - x0) + y0;
+    const auto p =
+        std::lower_bound(this->times.begin(), this->times.end(), x) -
+        this->times.begin();
+    return interpolate(this->times, this->values,
+                       static_cast<std::vector<double>::size_type>(p), x);
   }  // operator()(const double x)
 
+  std::vector<double> Linearization::operator()(
+      const std::vector<double>& x) const {
+    using size_type = std::vector<double>::size_type;
+    raise_if(this->times.empty(),
+             "Linearization::operator(): "
+             "no values specified");
+    auto r = std::vector<double>(x.size());
+    const auto n = this->times.size();
+    auto p = size_type{};
+    for (size_type i = 0; i != x.size(); ++i) {
+      if ((i != 0) && (!(x[i] >= x[i - 1]))) {
+        // the times are not sorted, the search is restarted
+        p = static_cast<size_type>(
+            std::lower_bound(this->times.begin(), this->times.end(), x[i]) -
+            this->times.begin());
+      } else {
+        while ((p != n) && (this->times[p] < x[i])) {
+          ++p;
+        }
+      }
+      r[i] = interpolate(this->times, this->values, p, x[i]);
+    }
+    return r;
+  }  // operator()(const std::vector<double>&)
+
   bool Linearization::isConstant() const {
     return (this->values.size() == 1);
   }  // isConstant
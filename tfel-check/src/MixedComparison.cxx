@@ -18,6 +18,7 @@
 #include <limits>
 #include <cstdlib>
 
+#include "TFEL/Raise.hxx"
 #include "TFEL/Check/MixedComparison.hxx"
 
 namespace tfel::check {
@@ -28,32 +29,32 @@ namespace tfel::check {
 
   void MixedComparison::compare() {
     using namespace std;
-    double mixedError;
-    double maxMixedError =
-        -std::numeric_limits<double>::max();  // smallest possible value
-    unsigned int errorLinesCount = 0;
     float errorLinesPercent = 0.;
-    unsigned int errorLineNumber = 0;
     unsigned int lineOffset =
         (!this->c2->getData()->getLegends().empty()) ? 2u : 1u;
 
     this->msgLog += '\n';
 
-    bool s = true;
-    for (vector<double>::size_type index = 0;
-         index != this->c1->getValues().size(); ++index) {
-      const auto va = this->c1->getValues().at(index);
-      const auto vb = this->c2->getValues().at(index);
-      mixedError = std::abs(va - vb) - (this->prec * vb) - this->precision2;
-      if (maxMixedError < mixedError) {
-        maxMixedError = mixedError;
-        errorLineNumber = index + lineOffset;
-      }
-      if (mixedError > 0) {
-        s = false;
-        errorLinesCount++;
-      }
-    }
+    const auto& va = this->c1->getValues();
+    const auto& vb = this->c2->getValues();
+    raise_if(vb.size() < va.size(),
+             "MixedComparison::compare: "
+             "the columns don't have the same size");
+    const auto* const a = va.data();
+    const auto* const b = vb.data();
+    const auto rp = this->prec;
+    const auto ap = this->precision2;
+    // the maximum error is initialized to the smallest possible value
+    const auto stats = Comparison::analyseErrors(
+        a, b, va.size(), -std::numeric_limits<double>::max(), 0,
+        [rp, ap](const double x, const double y) {
+          return std::abs(x - y) - (rp * y) - ap;
+        });
+    const auto maxMixedError = stats.maximum;
+    const auto errorLinesCount = stats.failures;
+    const auto errorLineNumber =
+        (stats.position != va.size()) ? stats.position + lineOffset : 0;
+    const auto s = errorLinesCount == 0;
     if (!s) {
       this->msgLog += "*** ";
     }
@@ -0,0 +1,122 @@
+/*!
+ * \file   tfel-check/src/PCRecordDriver.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <limits>
+#include <fstream>
+#include <ostream>
+#include "TFEL/Check/PCLogger.hxx"
+#include "TFEL/Check/PCRecordDriver.hxx"
+
+namespace tfel::check {
+
+  /*!
+   * Each event is made of a tag identifying the kind of event followed by
+   * its arguments. Strings are preceded by their sizes, so that they may
+   * contain any character.
+   */
+  static constexpr char recordedMessage = 'M';
+  static constexpr char recordedSkippedTest = 'S';
+  static constexpr char recordedTestResult = 'R';
+
+  static void writeRecordedString(std::ostream& os, const std::string& s) {
+    os << s.size() << ' ';
+    os.write(s.data(), static_cast<std::streamsize>(s.size()));
+  }  // end of writeRecordedString
+
+  static bool readRecordedString(std::istream& is, std::string& s) {
+    auto n = std::string::size_type{};
+    if ((!(is >> n)) || (is.get() != ' ')) {
+      return false;
+    }
+    s.resize(n);
+    return static_cast<bool>(
+        is.read(s.data(), static_cast<std::streamsize>(n)));
+  }  // end of readRecordedString
+
+  bool PCRecordDriver::replay(PCLogger& l, const std::string& f) {
+    std::ifstream file(f, std::ios::in | std::ios::binary);
+    if (!file) {
+      return false;
+    }
+    auto tag = char{};
+    while (file.get(tag)) {
+      if (tag == recordedMessage) {
+        auto m = std::string{};
+        if (!readRecordedString(file, m)) {
+          return false;
+        }
+        l.addMessage(m);
+      } else if (tag == recordedSkippedTest) {
+        auto d = std::string{};
+        if (!readRecordedString(file, d)) {
+          return false;
+        }
+        l.reportSkippedTest(d);
+      } else if (tag == recordedTestResult) {
+        auto n = std::string{};
+        auto s = std::string{};
+        auto c = std::string{};
+        auto m = std::string{};
+        auto t = float{};
+        auto b = int{};
+        if ((!readRecordedString(file, n)) ||
+            (!readRecordedString(file, s)) ||
+            (!readRecordedString(file, c)) || (!(file >> t >> b)) ||
+            (!readRecordedString(file, m))) {
+          return false;
+        }
+        l.addTestResult(n, s, c, t, b != 0, m);
+      } else {
+        return false;
+      }
+    }
+    return file.eof();
+  }  // end of replay
+
+  PCRecordDriver::PCRecordDriver(const std::string& f) : PCILogDriver(f) {
+    this->getStream().precision(std::numeric_limits<float>::max_digits10);
+  }  // end of PCRecordDriver
+
+  void PCRecordDriver::addMessage(const std::string& m) {
+    auto& os = this->getStream();
+    os << recordedMessage;
+    writeRecordedString(os, m);
+    os.flush();
+  }  // end of addMessage
+
+  void PCRecordDriver::reportSkippedTest(const std::string& d) {
+    auto& os = this->getStream();
+    os << recordedSkippedTest;
+    writeRecordedString(os, d);
+    os.flush();
+  }  // end of reportSkippedTest
+
+  void PCRecordDriver::addTestResult(const std::string& n,
+                                     const std::string& s,
+                                     const std::string& c,
+                                     const float t,
+                                     const bool b,
+                                     const std::string& m) {
+    auto& os = this->getStream();
+    os << recordedTestResult;
+    writeRecordedString(os, n);
+    writeRecordedString(os, s);
+    writeRecordedString(os, c);
+    os << t << ' ' << (b ? 1 : 0) << ' ';
+    writeRecordedString(os, m);
+    os.flush();
+  }  // end of addTestResult
+
+  PCRecordDriver::~PCRecordDriver() = default;
+
+}  // end of namespace tfel::check
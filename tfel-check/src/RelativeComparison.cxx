@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <limits>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Check/RelativeComparison.hxx"
 
 namespace tfel::check {
@@ -26,32 +27,27 @@ namespace tfel::check {
   void RelativeComparison::compare() {
     using namespace std;
     constexpr const double eps = 100. * numeric_limits<double>::min();
-    unsigned int errorLineNumber = 0;
-    unsigned int errorLinesCount = 0;
     float errorLinesPercent = 0.;
-    double relativeError;
-    double maxRelativeError = 0.;
     unsigned int lineOffset =
         (!this->c2->getData()->getLegends().empty()) ? 2u : 1u;
     this->msgLog += '\n';
-
-    bool s = true;
-    for (vector<double>::size_type index = 0;
-         index != this->c1->getValues().size(); ++index) {
-      relativeError = std::abs(this->c1->getValues()[index] -
-                               this->c2->getValues()[index]) /
-                      (min(abs(this->c1->getValues()[index]),
-                           abs(this->c2->getValues()[index])) +
-                       eps);
-      if (maxRelativeError < relativeError) {
-        maxRelativeError = relativeError;
-        errorLineNumber = index + lineOffset;
-      }
-      if (relativeError > (this->prec)) {
-        errorLinesCount++;
-        s = false;
-      }
-    }
+    const auto& va = this->c1->getValues();
+    const auto& vb = this->c2->getValues();
+    raise_if(vb.size() < va.size(),
+             "RelativeComparison::compare: "
+             "the columns don't have the same size");
+    const auto* const a = va.data();
+    const auto* const b = vb.data();
+    const auto stats = Comparison::analyseErrors(
+        a, b, va.size(), 0, this->prec,
+        [](const double x, const double y) {
+          return std::abs(x - y) / (std::min(std::abs(x), std::abs(y)) + eps);
+        });
+    const auto maxRelativeError = stats.maximum;
+    const auto errorLinesCount = stats.failures;
+    const auto errorLineNumber =
+        (stats.position != va.size()) ? stats.position + lineOffset : 0;
+    const auto s = errorLinesCount == 0;
 
     if (!s) this->msgLog += "*** ";
     this->msgLog += "comparison of files " + this->c1->getFilename() + " and " +
@@ -11,6 +11,8 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Check/SplineLocalInterpolation.hxx"
 
 namespace tfel::check {
@@ -28,39 +30,70 @@ namespace tfel::check {
 
   void SplineLocalInterpolation::interpolate(
       const std::vector<double>& times, const std::vector<double>& values) {
+    raise_if(times.size() != values.size(),
+             "SplineLocalInterpolation::interpolate: "
+             "the number of times does not match the number of values");
+    raise_if(times.size() < 3,
+             "SplineLocalInterpolation::interpolate: "
+             "at least three points are required");
+    this->splines.clear();
+    this->timesBefore.clear();
     // starts at second element, and stops before the last to prevent
     // duplicated splines
-    for (unsigned i = 1; i < (times.size() - 1); ++i) {
-      std::vector<double> timesTmp;
-      std::vector<double> valuesTmp;
-
-      timesTmp.push_back(times[i - 1]);
-      timesTmp.push_back(times[i]);
-      timesTmp.push_back(times[i + 1]);
-      valuesTmp.push_back(values[i - 1]);
-      valuesTmp.push_back(values[i]);
-      valuesTmp.push_back(values[i + 1]);
-
+    for (std::vector<double>::size_type i = 1; i < (times.size() - 1); ++i) {
+      const double timesTmp[3] = {times[i - 1], times[i], times[i + 1]};
+      const double valuesTmp[3] = {values[i - 1], values[i], values[i + 1]};
       tfel::math::CubicSpline<double> spline;
-      spline.setCollocationPoints(timesTmp, valuesTmp);
-      this->splines[times[i - 1]] = spline;
+      spline.setCollocationPoints(timesTmp, timesTmp + 3, valuesTmp);
+      this->splines.push_back(std::move(spline));
       this->timesBefore.push_back(times[i - 1]);
     }
   }
 
+  /*!
+   * \return the index of the spline to be used
+   * \param[in] p: number of groups whose first time is lower than or
+   * equal to the considered time
+   */
+  static std::vector<double>::size_type getSplineIndex(
+      const std::vector<double>::size_type p) {
+    // before the first group, the first spline is extrapolated
+    return (p == 0) ? 0 : p - 1;
+  }  // end of getSplineIndex
+
   double SplineLocalInterpolation::getValue(const double x) const {
-    // if we have only one spline, return it
-    if (this->timesBefore.size() == 1) {
-      return (this->splines.find(this->timesBefore.at(0)))->second.getValue(x);
-    }
-    // else, we search the right spline
-    for (unsigned i = 0; i < this->timesBefore.size(); ++i) {
-      if (this->timesBefore.at(i) > x) {
-        return (this->splines.find(this->timesBefore.at(i - 1)))
-            ->second.getValue(x);
+    raise_if(this->splines.empty(),
+             "SplineLocalInterpolation::getValue: "
+             "no spline defined");
+    const auto p = std::upper_bound(this->timesBefore.begin(),
+                                    this->timesBefore.end(), x) -
+                   this->timesBefore.begin();
+    const auto i = static_cast<std::vector<double>::size_type>(p);
+    return this->splines[getSplineIndex(i)].getValue(x);
+  }
+
+  std::vector<double> SplineLocalInterpolation::getValues(
+      const std::vector<double>& x) const {
+    using size_type = std::vector<double>::size_type;
+    raise_if(this->splines.empty(),
+             "SplineLocalInterpolation::getValues: "
+             "no spline defined");
+    auto r = std::vector<double>(x.size());
+    const auto& tb = this->timesBefore;
+    auto p = size_type{};
+    for (size_type i = 0; i != x.size(); ++i) {
+      if ((i != 0) && (!(x[i] >= x[i - 1]))) {
+        // the times are not sorted, the search is restarted
+        p = static_cast<size_type>(
+            std::upper_bound(tb.begin(), tb.end(), x[i]) - tb.begin());
+      } else {
+        while ((p != tb.size()) && (tb[p] <= x[i])) {
+          ++p;
+        }
       }
+      r[i] = this->splines[getSplineIndex(p)].getValue(x[i]);
     }
-    return this->splines.find(this->timesBefore.back())->second.getValue(x);
+    return r;
   }
 
   std::string SplineLocalInterpolation::getType() const {
@@ -106,10 +106,13 @@ namespace tfel::check {
 
   void Test::applyInterpolation() {
     using namespace std;
-    using size_type = std::vector<double>::size_type;
 
     this->c1->setFilename(this->f1);
-    this->c2->setFilename(this->f2);
+    if (this->f2 == this->f1) {
+      this->c2->setData(this->f2, this->c1->getData());
+    } else {
+      this->c2->setFilename(this->f2);
+    }
 
     std::ostringstream msg;
     msg.str("");  // wipe stream
@@ -141,14 +144,11 @@ namespace tfel::check {
       std::shared_ptr<Column> ci2(
           colInterpolatedTmpB); /**!< abscissa column for .res */
 
-      // Opening the files to get the times columns
-      ci1->setFilename(this->f1);
-      ci2->setFilename(this->f2);
+      // the times columns are extracted from the data already read
+      ci1->setData(this->f1, this->c1->getData());
+      ci2->setData(this->f2, this->c2->getData());
 
       if (this->c1->getValues().size() <= this->c2->getValues().size()) {
-        vector<double> cXBTmp = ci2->getValues();
-        vector<double> cbTmp = this->c2->getValues();
-        vector<double> cXATmp = ci1->getValues();
 
         //      if (beforeInterFile)		// stores the before
         //      interpolation values
@@ -158,15 +158,10 @@ namespace tfel::check {
         //      else
         //        msg << "\nProblem saving file\n";
 
-        this->interpolation->interpolate(cXBTmp,
-                                         cbTmp);  // interpolation of col B
-        this->c2->clearValues();
-        this->c2->resizeValues(this->c1->getValues().size());
-
-        for (size_type i = 0; i < ci1->getValues().size(); ++i) {
-          this->c2->setValue(
-              i, this->interpolation->getValue(ci1->getValues().at(i)));
-        }
+        // interpolation of col B
+        this->interpolation->interpolate(ci2->getValues(),
+                                         this->c2->getValues());
+        this->c2->setValues(this->interpolation->getValues(ci1->getValues()));
         //      if (afterInterFile)		// stores the after
         //      interpolation values
         //        for(size_type i = 0; i < ci1->getValues().size(); ++i)
@@ -188,20 +183,10 @@ namespace tfel::check {
         //      else
         //        msg << "\nProblem saving file\n";
 
-        vector<double> cXATmp = ci1->getValues();
-        vector<double> caTmp = this->c1->getValues();
-        vector<double> cXBTmp = ci2->getValues();
-
-        this->interpolation->interpolate(cXATmp,
-                                         caTmp);  // interpolation of col A
-
-        this->c1->clearValues();
-        this->c1->resizeValues(this->c2->getValues().size());
-
-        for (size_type i = 0; i < ci2->getValues().size(); ++i) {
-          this->c1->setValue(
-              i, this->interpolation->getValue(ci2->getValues().at(i)));
-        }
+        // interpolation of col A
+        this->interpolation->interpolate(ci1->getValues(),
+                                         this->c1->getValues());
+        this->c1->setValues(this->interpolation->getValues(ci2->getValues()));
 
         //      if (afterInterFile)
         //        for(size_type i = 0; i < ci2->getValues().size(); ++i)
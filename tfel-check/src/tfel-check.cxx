@@ -22,8 +22,12 @@
 #include <algorithm>
 #include <iostream>
 #include <climits>
+#include <chrono>
+#include <thread>
+#include <csignal>
 #include <unistd.h>
 #include <libgen.h>
+#include <sys/wait.h>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -43,6 +47,7 @@
 #include "TFEL/Check/PCLogger.hxx"
 #include "TFEL/Check/PCTextDriver.hxx"
 #include "TFEL/Check/PCJUnitDriver.hxx"
+#include "TFEL/Check/PCRecordDriver.hxx"
 
 namespace tfel::check {
 
@@ -114,6 +119,34 @@ namespace tfel::check {
     ~TFELCheck() override;
 
    protected:
+    //! \brief description of a test
+    struct TestDescription {
+      //! \brief directory
+      std::string directory;
+      //! \brief input file
+      std::string file;
+    };
+    /*!
+     * \brief execute a test
+     * \param[in] log: logger
+     * \param[in] t: test
+     * \return true on success
+     */
+    bool executeTest(PCLogger&, const TestDescription&);
+    /*!
+     * \brief execute the tests in separate processes.
+     * \return true on success
+     * \param[in] log: logger
+     * \param[in] tests: tests
+     *
+     * At most `numberOfJobs` tests are executed concurrently. Tests
+     * defined in the same directory are executed one after the other,
+     * since they generally share some files. The events reported by each
+     * test are replayed in the order of the tests, so that the logs are
+     * identical to the ones of a sequential execution.
+     */
+    bool executeTestsInSeparateProcesses(PCLogger&,
+                                         const std::vector<TestDescription>&);
     /*!
      * \brief method called while parsing unregistred command line
      * arguments.
@@ -133,6 +166,10 @@ namespace tfel::check {
     std::vector<std::string> configFiles;
     //! list of input files
     std::vector<std::string> inputs;
+    //! \brief maximum time allowed for each test, in seconds
+    unsigned int timeout = 0;
+    //! \brief number of tests executed in parallel
+    unsigned short numberOfJobs = 1;
   };  // end of struct TFELCheck
 
   bool TFELCheck::treatSubstitution() {
@@ -190,6 +227,42 @@ namespace tfel::check {
                         parse(this->configurations, f);
                       },
                       true));
+    auto readPositiveInteger = [this](const char* const n, const int m) {
+      const auto& o = this->currentArgument->getOption();
+      const auto v = [&o] {
+        try {
+          auto pos = std::size_t{};
+          const auto r = std::stoi(o, &pos);
+          if (pos == o.size()) {
+            return r;
+          }
+        } catch (std::exception&) {
+        }
+        return 0;
+      }();
+      tfel::raise_if((v < 1) || (v > m), "TFELCheck: invalid argument '" +
+                                             o + "' given to the " +
+                                             std::string(n) + " option");
+      return v;
+    };
+    this->registerCallBack(
+        "--jobs", "-j",
+        CallBack("number of tests executed in parallel (default: 1)",
+                 [this, readPositiveInteger] {
+                   this->numberOfJobs = static_cast<unsigned short>(
+                       readPositiveInteger("--jobs", 1024));
+                 },
+                 true));
+    this->registerCallBack(
+        "--timeout",
+        CallBack("maximum time, in seconds, allowed for each test. Tests "
+                 "exceeding this time are killed and reported as failed "
+                 "(default: no timeout)",
+                 [this, readPositiveInteger] {
+                   this->timeout = static_cast<unsigned int>(
+                       readPositiveInteger("--timeout", INT_MAX));
+                 },
+                 true));
     this->registerCallBack(
         "--list-default-components",
         CallBack("list all default components",
@@ -222,62 +295,220 @@ namespace tfel::check {
     declareTFELExecutables(this->configurations);
   }  // end of TFELCheck::TFELCheck
 
-  int TFELCheck::execute() {
-    using namespace std;
-    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
-    log.addDriver(std::make_shared<PCTextDriver>());
-    auto exe = [this, &log](const std::string& d, const std::string& f) {
-      using namespace tfel::system;
-      const auto cpath = systemCall::getCurrentWorkingDirectory();
-      const auto path = systemCall::getAbsolutePath(d);
-      log.addMessage("entering directory '" + path + "'");
-      try {
-        systemCall::changeCurrentWorkingDirectory(d);
-      } catch (std::exception& e) {
-        log.addMessage("can't move to directory '" + d + "' (" +
-                       std::string(e.what()) + ")");
-        log.addSimpleTestResult("* result of test '" + d + '/' + f + "'",
-                                false);
-        return false;
+  bool TFELCheck::executeTest(PCLogger& log, const TestDescription& t) {
+    using namespace tfel::system;
+    const auto& d = t.directory;
+    const auto& f = t.file;
+    const auto cpath = systemCall::getCurrentWorkingDirectory();
+    const auto path = systemCall::getAbsolutePath(d);
+    log.addMessage("entering directory '" + path + "'");
+    try {
+      systemCall::changeCurrentWorkingDirectory(d);
+    } catch (std::exception& e) {
+      log.addMessage("can't move to directory '" + d + "' (" +
+                     std::string(e.what()) + ")");
+      log.addSimpleTestResult("* result of test '" + d + '/' + f + "'", false);
+      return false;
+    }
+    log.addMessage("* beginning of test '" + d + '/' + f + "'");
+    auto success = true;
+    try {
+      auto c = this->configurations.getConfiguration(d);
+      c.log = log;
+      TestLauncher l(c, f);
+      success = l.execute(c);
+    } catch (std::exception& e) {
+      log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+      success = false;
+    }
+    log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
+    log.addMessage("======");
+    try {
+      systemCall::changeCurrentWorkingDirectory(cpath);
+    } catch (std::exception& e) {
+      log.addMessage("can't move back to top directory '" + cpath + "' (" +
+                     std::string(e.what()) + ")");
+      log.addMessage("Aborting");
+      exit(EXIT_FAILURE);
+    }
+    return success;
+  }  // end of executeTest
+
+  bool TFELCheck::executeTestsInSeparateProcesses(
+      PCLogger& log, const std::vector<TestDescription>& tests) {
+    using clock = std::chrono::steady_clock;
+    enum TestStatus { PENDING, RUNNING, DONE };
+    struct TestExecution {
+      //! \brief status of the test
+      TestStatus status = PENDING;
+      //! \brief identifier of the process executing the test
+      pid_t pid = -1;
+      //! \brief start time
+      clock::time_point start;
+      //! \brief file in which the events reported by the test are recorded
+      std::string record;
+      //! \brief status returned by `waitpid`
+      int process_status = 0;
+      //! \brief if true, the test has been killed
+      bool timed_out = false;
+    };
+    auto executions = std::vector<TestExecution>(tests.size());
+    // directories in which a test is running
+    auto busy = std::vector<std::string>{};
+    auto isBusy = [&busy](const std::string& d) {
+      return std::find(busy.begin(), busy.end(), d) != busy.end();
+    };
+    auto tmpdir = std::string{"/tmp"};
+    if (const auto* const e = ::getenv("TMPDIR")) {
+      if (*e != '\0') {
+        tmpdir = e;
       }
-      log.addMessage("* beginning of test '" + d + '/' + f + "'");
-      const auto name = d + '/' + f;
-      auto success = true;
-      try {
-        // if(this->file_version==TestLauncher::V1){
-        // 	TestLauncherV1 c(f,log);
-        // 	success = c.execute();
-        // } else {
-        auto c = this->configurations.getConfiguration(d);
-        c.log = log;
-        TestLauncher t(c, f);
-        success = t.execute(c);
-        //      }
-      } catch (std::exception& e) {
-        log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
-        success = false;
+    }
+    auto start = [this, &tests, &executions, &busy,
+                  &tmpdir](const std::size_t i) {
+      auto& ex = executions[i];
+      auto name = tmpdir + "/tfel-check-XXXXXX";
+      const auto fd = ::mkstemp(name.data());
+      tfel::raise_if(fd == -1,
+                     "TFELCheck::executeTestsInSeparateProcesses: "
+                     "can't create a temporary file");
+      ::close(fd);
+      ex.record = name;
+      // avoid duplicating buffered outputs in the child process
+      std::cout.flush();
+      std::cerr.flush();
+      const auto pid = ::fork();
+      tfel::raise_if(pid == -1,
+                     "TFELCheck::executeTestsInSeparateProcesses: "
+                     "can't create a new process");
+      if (pid == 0) {
+        // child process. A new process group is created so that the
+        // commands launched by the test can be killed with it.
+        ::setpgid(0, 0);
+        auto status = EXIT_FAILURE;
+        try {
+          auto l = PCLogger(std::make_shared<PCRecordDriver>(ex.record));
+          if (this->executeTest(l, tests[i])) {
+            status = EXIT_SUCCESS;
+          }
+        } catch (...) {
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        ::_exit(status);
       }
-      log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
-      log.addMessage("======");
-      try {
-        systemCall::changeCurrentWorkingDirectory(cpath);
-      } catch (std::exception& e) {
-        log.addMessage("can't move back to top directory '" + cpath + "' (" +
-                       std::string(e.what()) + ")");
-        log.addMessage("Aborting");
-        exit(EXIT_FAILURE);
+      ::setpgid(pid, pid);
+      ex.pid = pid;
+      ex.start = clock::now();
+      ex.status = RUNNING;
+      busy.push_back(tests[i].directory);
+    };
+    auto report = [&log, &tests, &executions, this](const std::size_t i) {
+      const auto& ex = executions[i];
+      const auto& t = tests[i];
+      const auto n = t.directory + '/' + t.file;
+      const auto complete = PCRecordDriver::replay(log, ex.record);
+      ::unlink(ex.record.c_str());
+      if ((!ex.timed_out) && (WIFEXITED(ex.process_status)) && (complete)) {
+        return WEXITSTATUS(ex.process_status) == EXIT_SUCCESS;
       }
-      return success;
+      if (ex.timed_out) {
+        log.addMessage("test '" + n + "' killed after " +
+                       std::to_string(this->timeout) + " seconds");
+      } else {
+        log.addMessage("test '" + n + "' terminated abnormally");
+      }
+      log.addSimpleTestResult("* end of test '" + n + "'", false);
+      log.addMessage("======");
+      return false;
+    };
+    auto success = true;
+    auto nrunning = std::size_t{};
+    auto first_pending = std::size_t{};
+    auto next_report = std::size_t{};
+    auto finish = [&tests, &executions, &busy, &nrunning](const std::size_t i,
+                                                          const int status) {
+      auto& ex = executions[i];
+      ex.status = DONE;
+      ex.process_status = status;
+      busy.erase(std::find(busy.begin(), busy.end(), tests[i].directory));
+      --nrunning;
     };
-    int status = EXIT_SUCCESS;
+    while (next_report != tests.size()) {
+      auto progress = false;
+      // starting new tests
+      for (auto i = first_pending;
+           (i != tests.size()) && (nrunning < this->numberOfJobs); ++i) {
+        if ((executions[i].status != PENDING) ||
+            (isBusy(tests[i].directory))) {
+          continue;
+        }
+        start(i);
+        ++nrunning;
+        progress = true;
+      }
+      while ((first_pending != tests.size()) &&
+             (executions[first_pending].status != PENDING)) {
+        ++first_pending;
+      }
+      // collecting finished tests
+      auto status = int{};
+      auto pid = pid_t{};
+      while ((nrunning != 0) && ((pid = ::waitpid(-1, &status, WNOHANG)) > 0)) {
+        for (std::size_t i = 0; i != tests.size(); ++i) {
+          auto& ex = executions[i];
+          if ((ex.status == RUNNING) && (ex.pid == pid)) {
+            finish(i, status);
+            progress = true;
+            break;
+          }
+        }
+      }
+      // killing tests exceeding the timeout. A test which terminated after
+      // the previous calls to `waitpid` is collected rather than killed.
+      if (this->timeout != 0) {
+        const auto now = clock::now();
+        for (std::size_t i = 0; i != tests.size(); ++i) {
+          auto& ex = executions[i];
+          if ((ex.status != RUNNING) || (ex.timed_out) ||
+              (now - ex.start <= std::chrono::seconds(this->timeout))) {
+            continue;
+          }
+          if (::waitpid(ex.pid, &status, WNOHANG) == ex.pid) {
+            finish(i, status);
+            progress = true;
+            continue;
+          }
+          ::killpg(ex.pid, SIGKILL);
+          ex.timed_out = true;
+        }
+      }
+      // reporting finished tests in order
+      while ((next_report != tests.size()) &&
+             (executions[next_report].status == DONE)) {
+        if (!report(next_report)) {
+          success = false;
+        }
+        ++next_report;
+        progress = true;
+      }
+      if (!progress) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+    return success;
+  }  // end of executeTestsInSeparateProcesses
+
+  int TFELCheck::execute() {
+    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
+    log.addDriver(std::make_shared<PCTextDriver>());
+    auto tests = std::vector<TestDescription>{};
     if (this->inputs.empty()) {
       std::regex re(".+\\.check", std::regex_constants::extended);
       const auto& files = tfel::system::recursiveFind(re, ".", 0);
       for (const auto& d : files) {
         for (const auto& f : d.second) {
-          if (!exe(d.first, f)) {
-            status = EXIT_FAILURE;
-          }
+          tests.push_back({d.first, f});
         }
       }
     } else {
@@ -288,14 +519,21 @@ namespace tfel::check {
         const auto f = std::string(::basename(path2));
         ::free(path);
         ::free(path2);
-        // basename
-        if (!exe(d, f)) {
-          status = EXIT_FAILURE;
+        tests.push_back({d, f});
+      }
+    }
+    auto success = true;
+    if ((this->numberOfJobs > 1) || (this->timeout != 0)) {
+      success = this->executeTestsInSeparateProcesses(log, tests);
+    } else {
+      for (const auto& t : tests) {
+        if (!this->executeTest(log, t)) {
+          success = false;
         }
       }
     }
     log.terminate();
-    return status;
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
   TFELCheck::~TFELCheck() = default;
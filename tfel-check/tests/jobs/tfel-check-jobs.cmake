@@ -0,0 +1,144 @@
+# This script checks the execution of the tests in separate processes
+# (`--jobs` and `--timeout` options of `tfel-check`). The following cases
+# are considered:
+#
+# - jobs: the tests of a tree of several directories are executed
+#   concurrently. The log file and the standard output shall be the same
+#   as the ones of a serial execution. Some tests fail and one of them
+#   reports a message spanning several lines, which is recorded by the
+#   child process and replayed by the main process.
+# - timeout: a test exceeding the timeout is killed and reported as
+#   failed, while the other tests are not affected.
+#
+# arguments checking
+if(NOT TFEL_CHECK)
+  message(FATAL_ERROR "Require TFEL_CHECK to be defined")
+endif(NOT TFEL_CHECK)
+if(NOT JOBS_TEST)
+  message(FATAL_ERROR "Require JOBS_TEST to be defined")
+endif(NOT JOBS_TEST)
+
+file(REMOVE_RECURSE "${JOBS_TEST}")
+file(MAKE_DIRECTORY "${JOBS_TEST}")
+
+# write a test file in the given directory. The instructions of the test
+# file are given as additional arguments, without their final semicolons
+# which would be interpreted as list separators by cmake.
+function(write_check_file directory name)
+  file(MAKE_DIRECTORY "${JOBS_TEST}/${directory}")
+  set(contents "")
+  foreach(i ${ARGN})
+    string(APPEND contents "${i}" ";\n")
+  endforeach(i)
+  file(WRITE "${JOBS_TEST}/${directory}/${name}.check" "${contents}")
+endfunction(write_check_file)
+
+# call tfel-check with the given arguments and set the variables
+# `tfel_check_result`, `tfel_check_output` and `tfel_check_log` in the
+# parent scope
+function(call_tfel_check)
+  file(REMOVE "${JOBS_TEST}/tfel-check.log")
+  execute_process(
+    COMMAND ${TFEL_CHECK} ${ARGN}
+    WORKING_DIRECTORY "${JOBS_TEST}"
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE error
+    RESULT_VARIABLE result)
+  if(NOT EXISTS "${JOBS_TEST}/tfel-check.log")
+    message(FATAL_ERROR "Failed: file 'tfel-check.log' not generated\n"
+      "${error}")
+  endif(NOT EXISTS "${JOBS_TEST}/tfel-check.log")
+  file(READ "${JOBS_TEST}/tfel-check.log" log)
+  set(tfel_check_result "${result}" PARENT_SCOPE)
+  set(tfel_check_output "${output}" PARENT_SCOPE)
+  set(tfel_check_log "${log}" PARENT_SCOPE)
+endfunction(call_tfel_check)
+
+# check that the given string contains the given value
+function(check_contains name value expected)
+  string(FIND "${value}" "${expected}" pos)
+  if(pos EQUAL -1)
+    message(FATAL_ERROR "Failed: '${expected}' not found in the ${name}:\n"
+      "${value}")
+  endif(pos EQUAL -1)
+endfunction(check_contains)
+
+set(cmd "${CMAKE_COMMAND} -E")
+if(JOBS_TEST STREQUAL "jobs")
+  foreach(d dir1 dir2 dir3 dir4)
+    # the first test of each directory lasts longer than the second one
+    write_check_file(${d} "test1"
+      "@Command \"${cmd} sleep 1\""
+      "@Command \"${cmd} echo ${d}-test1\" {expected_output : \"${d}-test1\"}")
+    write_check_file(${d} "test2"
+      "@Command \"${cmd} echo ${d}-test2\" {expected_output : \"${d}-test2\"}")
+  endforeach(d)
+  # failing tests
+  write_check_file(dir2 "test3"
+    "@Command \"${cmd} echo dir2-test3\" {
+  expected_output : {\"first line\", \"second line\"}
+}")
+  write_check_file(dir4/subdir "test1"
+    "@Command \"${cmd} false\"")
+  # an invalid test file, reported by a message spanning several lines
+  write_check_file(dir3 "test3" "@Command")
+  call_tfel_check()
+  if(NOT tfel_check_result)
+    message(FATAL_ERROR "Failed: the serial execution shall fail")
+  endif(NOT tfel_check_result)
+  check_contains("log file" "${tfel_check_log}"
+    "test failed : 'test3.check', reason:\ntest3.check:")
+  set(serial_output "${tfel_check_output}")
+  set(serial_log "${tfel_check_log}")
+  foreach(n 2 3 8)
+    call_tfel_check(--jobs=${n})
+    if(NOT tfel_check_result)
+      message(FATAL_ERROR "Failed: the execution with ${n} jobs shall fail")
+    endif(NOT tfel_check_result)
+    if(NOT tfel_check_log STREQUAL serial_log)
+      message(FATAL_ERROR "Failed: the log file of the execution with "
+        "${n} jobs differs from the one of the serial execution:\n"
+        "${tfel_check_log}\nversus\n${serial_log}")
+    endif(NOT tfel_check_log STREQUAL serial_log)
+    if(NOT tfel_check_output STREQUAL serial_output)
+      message(FATAL_ERROR "Failed: the output of the execution with "
+        "${n} jobs differs from the one of the serial execution:\n"
+        "${tfel_check_output}\nversus\n${serial_output}")
+    endif(NOT tfel_check_output STREQUAL serial_output)
+  endforeach(n)
+elseif(JOBS_TEST STREQUAL "timeout")
+  write_check_file(dir1 "test1"
+    "@Command \"${cmd} sleep 60\"")
+  write_check_file(dir2 "test1"
+    "@Command \"${cmd} echo dir2-test1\" {expected_output : \"dir2-test1\"}")
+  string(TIMESTAMP start "%s")
+  call_tfel_check(--jobs=2 --timeout=1)
+  string(TIMESTAMP end "%s")
+  if(NOT tfel_check_result)
+    message(FATAL_ERROR "Failed: the execution shall fail")
+  endif(NOT tfel_check_result)
+  math(EXPR duration "${end} - ${start}")
+  if(duration GREATER 30)
+    message(FATAL_ERROR "Failed: the test exceeding the timeout "
+      "has not been killed")
+  endif(duration GREATER 30)
+  foreach(v "${tfel_check_log}" "${tfel_check_output}")
+    check_contains("log" "${v}" "test './dir1/test1.check' killed after 1 seconds")
+  endforeach(v)
+  string(REGEX MATCH "end of test './dir1/test1.check'[ ]+\\[ FAILED\\]"
+    killed "${tfel_check_log}")
+  if(NOT killed)
+    message(FATAL_ERROR "Failed: the killed test shall be reported as failed\n"
+      "${tfel_check_log}")
+  endif(NOT killed)
+  string(REGEX MATCH "end of test './dir2/test1.check'[ ]+\\[SUCCESS\\]"
+    passed "${tfel_check_log}")
+  if(NOT passed)
+    message(FATAL_ERROR "Failed: the second test shall succeed\n"
+      "${tfel_check_log}")
+  endif(NOT passed)
+else(JOBS_TEST STREQUAL "jobs")
+  message(FATAL_ERROR "Unsupported test '${JOBS_TEST}'")
+endif(JOBS_TEST STREQUAL "jobs")
+
+message(STATUS "Passed")
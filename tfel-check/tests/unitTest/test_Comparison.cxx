@@ -0,0 +1,80 @@
+/*!
+ * \file   tfel-check/tests/unitTest/test_Comparison.cxx
+ * \brief  This test checks the statistics computed by the
+ * `Comparison::analyseErrors` method.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Check/Comparison.hxx"
+
+//! \brief a comparison giving access to the `analyseErrors` method
+struct ErrorsAnalyser final : public tfel::check::Comparison {
+  void compare() override {}
+  /*!
+   * \return the statistics on the absolute errors between two arrays
+   * \param[in] a: first array
+   * \param[in] b: second array
+   * \param[in] m0: initial value of the maximum error
+   * \param[in] t: threshold
+   */
+  static ErrorStatistics analyse(const std::vector<double>& a,
+                                 const std::vector<double>& b,
+                                 const double m0,
+                                 const double t) {
+    return Comparison::analyseErrors(
+        a.data(), b.data(), a.size(), m0, t,
+        [](const double x, const double y) { return std::abs(x - y); });
+  }  // end of analyse
+};  // end of struct ErrorsAnalyser
+
+struct test_Comparison final : public tfel::tests::TestCase {
+  test_Comparison() : tfel::tests::TestCase("TFEL/Check", "Comparison") {}
+  tfel::tests::TestResult execute() override {
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    // the number of values is not a multiple of the number of lanes used to
+    // compute the maximum, and the maximum is reached twice, the second time
+    // in the remaining values
+    const auto a = std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto b = a;
+    b[2] += 0.5;
+    b[6] -= 3;
+    b[7] += 1;
+    b[9] += 3;
+    const auto s = ErrorsAnalyser::analyse(a, b, 0, 0.75);
+    TFEL_TESTS_ASSERT(std::abs(s.maximum - 3) < 1.e-14);
+    TFEL_TESTS_ASSERT(s.position == 6u);
+    TFEL_TESTS_ASSERT(s.failures == 3u);
+    // identical values
+    const auto s2 = ErrorsAnalyser::analyse(a, a, 0, 0);
+    TFEL_TESTS_ASSERT(std::abs(s2.maximum) < 1.e-14);
+    TFEL_TESTS_ASSERT(s2.position == a.size());
+    TFEL_TESTS_ASSERT(s2.failures == 0u);
+    // negative initial value of the maximum
+    const auto s3 = ErrorsAnalyser::analyse(a, a, -1, 0);
+    TFEL_TESTS_ASSERT(std::abs(s3.maximum) < 1.e-14);
+    TFEL_TESTS_ASSERT(s3.position == 0u);
+    // NaN errors are ignored
+    b[1] = nan;
+    b[10] = nan;
+    const auto s4 = ErrorsAnalyser::analyse(a, b, 0, 0.75);
+    TFEL_TESTS_ASSERT(std::abs(s4.maximum - 3) < 1.e-14);
+    TFEL_TESTS_ASSERT(s4.position == 6u);
+    TFEL_TESTS_ASSERT(s4.failures == 3u);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(test_Comparison, "Comparison");
@@ -11,6 +11,7 @@
  */
 
 #include <cmath>
+#include <vector>
 #include <stdexcept>
 
 #include "TFEL/Tests/TestCase.hxx"
@@ -26,6 +27,14 @@ struct test_LinearInterpolation final : public tfel::tests::TestCase {
     i.interpolate({1., 2.}, {2., 4.});
     TFEL_TESTS_ASSERT(std::abs(3. - i.getValue(1.5)) < eps);
     TFEL_TESTS_ASSERT(std::abs(10. - i.getValue(1.5)) > eps);
+    // interpolation on a set of (possibly unsorted) abscissae
+    i.interpolate({1., 2., 4.}, {2., 4., 0.});
+    const auto x = std::vector<double>{0.5, 1.5, 3., 3.5, 2., 1., 5.};
+    const auto v = i.getValues(x);
+    TFEL_TESTS_ASSERT(v.size() == x.size());
+    for (std::vector<double>::size_type j = 0; j != x.size(); ++j) {
+      TFEL_TESTS_ASSERT(std::abs(v[j] - i.getValue(x[j])) < eps);
+    }
     TFEL_TESTS_CHECK_THROW(i.interpolate({1., 2., 3.}, {2., 4.}),
                            std::runtime_error);
     TFEL_TESTS_CHECK_THROW(i.interpolate({}, {2., 4.}), std::runtime_error);
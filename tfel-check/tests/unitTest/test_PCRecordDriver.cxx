@@ -0,0 +1,110 @@
+/*!
+ * \file   tfel-check/tests/unitTest/test_PCRecordDriver.cxx
+ * \brief  This test checks that the events recorded by the `PCRecordDriver`
+ * class are replayed identically, including messages spanning several lines.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Check/PCLogger.hxx"
+#include "TFEL/Check/PCILogDriver.hxx"
+#include "TFEL/Check/PCRecordDriver.hxx"
+
+//! \brief a driver storing the events in memory
+struct EventsStorageDriver final : public tfel::check::PCILogDriver {
+  void addMessage(const std::string& m) override {
+    this->events.push_back("message:" + m);
+  }  // end of addMessage
+  void reportSkippedTest(const std::string& d) override {
+    this->events.push_back("skipped:" + d);
+  }  // end of reportSkippedTest
+  void addTestResult(const std::string& n,
+                     const std::string& s,
+                     const std::string& c,
+                     const float t,
+                     const bool b,
+                     const std::string& m) override {
+    this->events.push_back("result:" + n + "|" + s + "|" + c + "|" +
+                           std::to_string(t) + "|" + (b ? "1" : "0") + "|" +
+                           m);
+  }  // end of addTestResult
+  //! \brief stored events
+  std::vector<std::string> events;
+};  // end of struct EventsStorageDriver
+
+struct test_PCRecordDriver final : public tfel::tests::TestCase {
+  test_PCRecordDriver()
+      : tfel::tests::TestCase("TFEL/Check", "PCRecordDriver") {
+  }  // end of test_PCRecordDriver
+
+  tfel::tests::TestResult execute() override {
+    using namespace tfel::check;
+    const auto f = std::string{"test_PCRecordDriver.rec"};
+    // the events are sent to the record driver and to a storage driver
+    auto reference = std::make_shared<EventsStorageDriver>();
+    {
+      auto l = PCLogger(std::make_shared<PCRecordDriver>(f));
+      l.addDriver(reference);
+      l.addMessage("entering directory '/tmp/a directory'");
+      l.addMessage("test failed : 'test.check', reason:\nfirst line\n"
+                   "second line\n");
+      l.addMessage("");
+      l.addMessage("a message containing tags: M 3 S R 12 \n\n");
+      l.reportSkippedTest("** Exec-1 a skipped\ncommand");
+      l.addTestResult("test", "Exec-1", "./test --option", 0.25f, true);
+      l.addTestResult("test", "Compare-1", "Comparing 'a' and 'b'", 1.5f,
+                      false,
+                      "Unexpected command output.\n"
+                      "# Expected output:\n\n'first line'\n'second line'\n");
+      l.addSimpleTestResult("* end of test './test.check'", false);
+      l.terminate();
+    }
+    TFEL_TESTS_ASSERT(reference->events.size() == 8u);
+    // complete replay
+    auto replayed = std::make_shared<EventsStorageDriver>();
+    auto l = PCLogger(replayed);
+    TFEL_TESTS_ASSERT(PCRecordDriver::replay(l, f));
+    TFEL_TESTS_ASSERT(replayed->events == reference->events);
+    // a truncated record, as written by a killed process, is partially
+    // replayed and reported as incomplete
+    auto record = std::string{};
+    {
+      std::ifstream in(f, std::ios::in | std::ios::binary);
+      record.assign(std::istreambuf_iterator<char>(in),
+                    std::istreambuf_iterator<char>());
+    }
+    {
+      std::ofstream out(f, std::ios::out | std::ios::binary);
+      out.write(record.data(),
+                static_cast<std::streamsize>(record.size() - 10));
+    }
+    auto partial = std::make_shared<EventsStorageDriver>();
+    auto l2 = PCLogger(partial);
+    TFEL_TESTS_ASSERT(!PCRecordDriver::replay(l2, f));
+    TFEL_TESTS_ASSERT(partial->events.size() == 7u);
+    TFEL_TESTS_ASSERT(std::equal(partial->events.begin(),
+                                 partial->events.end(),
+                                 reference->events.begin()));
+    // a missing record
+    auto l3 = PCLogger(std::make_shared<EventsStorageDriver>());
+    TFEL_TESTS_ASSERT(!PCRecordDriver::replay(l3, "missing.rec"));
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(test_PCRecordDriver, "PCRecordDriver");
@@ -11,6 +11,8 @@
  */
 
 #include <cmath>
+#include <vector>
+#include <stdexcept>
 #include "TFEL/Tests/TestCase.hxx"
 #include "TFEL/Tests/TestProxy.hxx"
 #include "TFEL/Check/SplineLocalInterpolation.hxx"
@@ -25,6 +27,16 @@ struct test_SplineLocalInterpolation : public tfel::tests::TestCase {
     i.interpolate({1., 2., 3.}, {3., 5., 7.});
     TFEL_TESTS_ASSERT(std::abs(4. - i.getValue(1.5)) < eps);
     TFEL_TESTS_ASSERT(std::abs(10. - i.getValue(1.5)) > eps);
+    // interpolation on a set of (possibly unsorted) abscissae
+    i.interpolate({1., 2., 3., 5.}, {3., 5., 4., 1.});
+    const auto x = std::vector<double>{1., 1.5, 2.5, 4., 2., 4.5, 5.};
+    const auto v = i.getValues(x);
+    TFEL_TESTS_ASSERT(v.size() == x.size());
+    for (std::vector<double>::size_type j = 0; j != x.size(); ++j) {
+      TFEL_TESTS_ASSERT(std::abs(v[j] - i.getValue(x[j])) < eps);
+    }
+    TFEL_TESTS_CHECK_THROW(i.interpolate({1., 2.}, {3., 5.}),
+                           std::runtime_error);
     return this->result;
   }  // end of execute
 };